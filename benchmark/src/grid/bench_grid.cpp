@@ -0,0 +1,261 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/chunked_grid.hpp"
+#include "hex/grid/grid.hpp"
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/grid/soa_grid.hpp"
+#include "hex/grid/sparse_grid.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/neighbors/neighbors_view.hpp"
+#include "hex/views/offset_rows/offset_rows_parameters.hpp"
+#include "hex/views/offset_rows/offset_rows_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+using convex_grid           = grid<int, convex_polygon_view<int>>;
+using rectangular_grid      = grid<int, offset_rows_view<int>>;
+using hexagonal_sparse_grid = sparse_grid<int>;
+using world_grid            = chunked_grid<int>;
+
+auto make_convex_grid(benchmark::State const& state) -> convex_grid
+{
+    return convex_grid(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))));
+}
+
+auto make_rectangular_grid(benchmark::State const& state) -> rectangular_grid
+{
+    auto const side = static_cast<std::size_t>(state.range(0));
+    return rectangular_grid(views::offset_rows(offset_rows_parameters<int>(side, side)));
+}
+
+auto make_sparse_grid(benchmark::State const& state) -> hexagonal_sparse_grid
+{
+    hexagonal_sparse_grid g;
+    for (auto const& key : views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))))
+        g[key] = 0;
+    return g;
+}
+
+auto make_chunked_grid(benchmark::State const& state) -> world_grid
+{
+    world_grid g;
+    for (auto const& key : views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))))
+        g[key] = 0;
+    return g;
+}
+
+template<class Grid>
+auto shuffled_keys(Grid const& g) -> std::vector<typename Grid::key_type>
+{
+    std::vector<typename Grid::key_type> keys;
+    keys.reserve(g.size());
+    for (auto const& [k, v] : g)
+        keys.push_back(k);
+    std::ranges::shuffle(keys, std::mt19937(42)); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    return keys;
+}
+
+template<class Grid, auto Make>
+void grid_subscript(benchmark::State& state)
+{
+    Grid       g    = Make(state);
+    auto const keys = shuffled_keys(g);
+    for (auto _ : state)
+    {
+        for (auto const& k : keys)
+            benchmark::DoNotOptimize(++g[k]);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * g.size()));
+}
+
+template<class Grid, auto Make>
+void grid_find(benchmark::State& state)
+{
+    Grid const g    = Make(state);
+    auto const keys = shuffled_keys(g);
+    for (auto _ : state)
+    {
+        for (auto const& k : keys)
+            benchmark::DoNotOptimize(g.find(k));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * g.size()));
+}
+
+template<class Grid, auto Make>
+void grid_iterate(benchmark::State& state)
+{
+    Grid g = Make(state);
+    for (auto _ : state)
+    {
+        for (auto&& [k, v] : g)
+        {
+            benchmark::DoNotOptimize(k);
+            benchmark::DoNotOptimize(++v);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * g.size()));
+}
+
+template<class Grid, auto Make>
+void grid_increment_iterate(benchmark::State& state)
+{
+    Grid g = Make(state);
+    for (auto _ : state)
+    {
+        for (auto&& [k, v] : g)
+            ++v;
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * g.size()));
+}
+
+template<class Grid, auto Make>
+void grid_increment_rows(benchmark::State& state)
+{
+    Grid g = Make(state);
+    for (auto _ : state)
+    {
+        for (auto const row : g.rows())
+        {
+            for (auto& v : row)
+                ++v;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * g.size()));
+}
+
+struct tile
+{
+    int           terrain  = 0;
+    float         height   = 0;
+    std::uint32_t owner    = 0;
+    std::uint32_t flags    = 0;
+    double        moisture = 0;
+};
+
+using tile_grid     = grid<tile, convex_polygon_view<int>>;
+using tile_soa_grid = soa_grid<convex_polygon_view<int>, int, float, std::uint32_t, std::uint32_t, double>;
+
+void grid_single_field_sum_aos(benchmark::State& state)
+{
+    tile_grid const g(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))));
+    for (auto _ : state)
+    {
+        float sum = 0;
+        for (auto&& [k, v] : g)
+            sum += v.height;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * g.size()));
+}
+
+void grid_single_field_sum_soa(benchmark::State& state)
+{
+    tile_soa_grid const g(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))));
+    for (auto _ : state)
+    {
+        auto const heights = g.field<1>();
+        benchmark::DoNotOptimize(std::reduce(heights.begin(), heights.end(), 0.F));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * g.size()));
+}
+
+using float_grid = grid<float, convex_polygon_view<int>>;
+
+void grid_diffusion_lookup(benchmark::State& state)
+{
+    float_grid const   src(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))));
+    std::vector<float> dst(src.size());
+    auto const&        shape = src.shape();
+    for (auto _ : state)
+    {
+        for (auto&& [k, v] : src)
+        {
+            float sum = 0;
+            for (auto const& n : views::neighbors(k))
+                sum += shape.contains(n) ? src[n] : v;
+            dst[shape[k]] = sum / 6;
+        }
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * src.size()));
+}
+
+void grid_diffusion_table(benchmark::State& state)
+{
+    float_grid const   src(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))));
+    std::vector<float> dst(src.size());
+    neighbor_table<> const table(src.shape());
+    float const*           values = src.data();
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < table.size(); ++i)
+        {
+            float sum = 0;
+            for (auto const n : table[i])
+                sum += n == neighbor_table<>::no_neighbor ? values[i] : values[n];
+            dst[i] = sum / 6;
+        }
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * src.size()));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(grid_subscript<convex_grid, make_convex_grid>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_subscript<rectangular_grid, make_rectangular_grid>)->RangeMultiplier(8)->Range(8, 1024);
+BENCHMARK(grid_find<convex_grid, make_convex_grid>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_find<rectangular_grid, make_rectangular_grid>)->RangeMultiplier(8)->Range(8, 1024);
+BENCHMARK(grid_iterate<convex_grid, make_convex_grid>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_iterate<rectangular_grid, make_rectangular_grid>)->RangeMultiplier(8)->Range(8, 1024);
+BENCHMARK(grid_increment_iterate<convex_grid, make_convex_grid>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_increment_iterate<rectangular_grid, make_rectangular_grid>)->RangeMultiplier(8)->Range(8, 1024);
+BENCHMARK(grid_increment_rows<convex_grid, make_convex_grid>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_increment_rows<rectangular_grid, make_rectangular_grid>)->RangeMultiplier(8)->Range(8, 1024);
+BENCHMARK(grid_subscript<hexagonal_sparse_grid, make_sparse_grid>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_find<hexagonal_sparse_grid, make_sparse_grid>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_iterate<hexagonal_sparse_grid, make_sparse_grid>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_subscript<world_grid, make_chunked_grid>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_find<world_grid, make_chunked_grid>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_iterate<world_grid, make_chunked_grid>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_single_field_sum_aos)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_single_field_sum_soa)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_diffusion_lookup)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(grid_diffusion_table)->RangeMultiplier(8)->Range(8, 512);
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
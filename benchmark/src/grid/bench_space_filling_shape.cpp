@@ -0,0 +1,118 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/grid/space_filling_order.hpp"
+#include "hex/grid/space_filling_shape.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+// A regular hexagon of radius range(0), in the row order of convex_polygon_view or along a space-filling curve.
+// range(1) is -1 for row order, otherwise the space_filling_order.
+struct map
+{
+    explicit map(benchmark::State const& state)
+        : hexagon(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))))
+    {
+        if (state.range(1) < 0)
+        {
+            table = neighbor_table<>(hexagon);
+            return;
+        }
+        auto const curve = space_filling_shape(hexagon, static_cast<space_filling_order>(state.range(1)));
+        table            = neighbor_table<>(curve);
+    }
+
+    convex_polygon_view<int> hexagon;
+    neighbor_table<>         table;
+};
+
+// Floods from random tiles until 4096 tiles are reached, as a local search or area effect would.
+void local_flood(benchmark::State& state)
+{
+    map const                  m(state);
+    std::vector<std::uint32_t> visited(m.table.size());
+    std::vector<std::uint32_t> values(m.table.size(), 1);
+    std::vector<std::uint32_t> queue;
+    std::mt19937               gen(42); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::uniform_int_distribution<std::uint32_t> start(0, static_cast<std::uint32_t>(m.table.size() - 1));
+    std::uint32_t                                epoch = 0;
+    for (auto _ : state)
+    {
+        ++epoch;
+        queue.assign(1, start(gen));
+        visited[queue.front()] = epoch;
+        std::uint64_t sum      = 0;
+        for (std::size_t head = 0; head < queue.size() && queue.size() < 4096; ++head) // NOLINT(*-magic-numbers)
+        {
+            sum += values[queue[head]];
+            for (auto const neighbor : m.table[queue[head]])
+            {
+                if (neighbor != neighbor_table<>::no_neighbor && visited[neighbor] != epoch)
+                {
+                    visited[neighbor] = epoch;
+                    queue.push_back(neighbor);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+// Sums the neighbors of every tile, in storage order.
+void stencil(benchmark::State& state)
+{
+    map const                  m(state);
+    std::vector<std::uint32_t> values(m.table.size(), 1);
+    std::vector<std::uint32_t> out(m.table.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < m.table.size(); ++i)
+        {
+            std::uint32_t sum = 0;
+            for (auto const neighbor : m.table[i])
+                sum += neighbor != neighbor_table<>::no_neighbor ? values[neighbor] : 0;
+            out[i] = sum;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(m.table.size()));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(local_flood)->ArgsProduct({{64, 1024}, {-1, 0, 1}});
+BENCHMARK(stencil)->ArgsProduct({{1024}, {-1, 0, 1}});
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
@@ -0,0 +1,104 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/parallel/algorithms.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+using float_grid = grid<float, convex_polygon_view<int>>;
+
+auto make_grid(benchmark::State const& state) -> float_grid
+{
+    return float_grid(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))));
+}
+
+auto shade(vector<int> const& key, float value) -> float
+{
+    return std::sin(static_cast<float>(key.q().value())) * std::cos(static_cast<float>(key.r().value())) + value;
+}
+
+void serial_for_each(benchmark::State& state)
+{
+    float_grid g = make_grid(state);
+    for (auto _ : state)
+    {
+        for (auto&& [k, v] : g)
+            v = shade(k, v);
+        benchmark::DoNotOptimize(g.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * g.size()));
+}
+
+void parallel_for_each(benchmark::State& state)
+{
+    float_grid g = make_grid(state);
+    for (auto _ : state)
+    {
+        parallel::for_each(g, [](auto const& k, float& v) { v = shade(k, v); });
+        benchmark::DoNotOptimize(g.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * g.size()));
+}
+
+void serial_reduce(benchmark::State& state)
+{
+    float_grid const g = make_grid(state);
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (auto&& [k, v] : g)
+            sum += shade(k, v);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * g.size()));
+}
+
+void parallel_transform_reduce(benchmark::State& state)
+{
+    float_grid const g = make_grid(state);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parallel::transform_reduce(
+            g, 0., [](double a, double b) { return a + b; }, [](auto const& k, float v) { return shade(k, v); }));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * g.size()));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(serial_for_each)->RangeMultiplier(8)->Range(64, 512)->UseRealTime();
+BENCHMARK(parallel_for_each)->RangeMultiplier(8)->Range(64, 512)->UseRealTime();
+BENCHMARK(serial_reduce)->RangeMultiplier(8)->Range(64, 512)->UseRealTime();
+BENCHMARK(parallel_transform_reduce)->RangeMultiplier(8)->Range(64, 512)->UseRealTime();
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
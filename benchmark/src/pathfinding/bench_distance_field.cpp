@@ -0,0 +1,120 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/grid/grid.hpp"
+#include "hex/pathfinding/distance_field.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/neighbors/neighbors_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <limits>
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+using cost_grid = grid<std::uint8_t, convex_polygon_view<int>>;
+
+// A hexagon of radius range(0) with one in ten tiles impassable and the others costing 1 to range(1).
+auto make_costs(benchmark::State const& state) -> cost_grid
+{
+    cost_grid    costs(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))));
+    std::mt19937 gen(42); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::uniform_int_distribution<int> impassable(0, 9); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    std::uniform_int_distribution<int> cost(1, static_cast<int>(state.range(1)));
+    for (auto& c : costs | std::views::values)
+        c = static_cast<std::uint8_t>(impassable(gen) == 0 ? 0 : cost(gen));
+    return costs;
+}
+
+auto make_sources(benchmark::State const& state) -> std::vector<vector<int>>
+{
+    auto const r  = static_cast<int>(state.range(0)) / 2;
+    auto const at = [](int q, int r) { return vector{q_coordinate<int>(q), r_coordinate<int>(r)}; };
+    return {at(0, 0), at(r, -r), at(-r, 0), at(0, r)};
+}
+
+// Unit-cost BFS looking up every neighbor in the shape, as distance_field replaces.
+void distance_field_shape_lookup(benchmark::State& state)
+{
+    auto const costs   = make_costs(state);
+    auto const sources = make_sources(state);
+    auto const shape   = costs.shape();
+    for (auto _ : state)
+    {
+        grid<std::uint32_t, convex_polygon_view<int>> field(shape);
+        std::ranges::fill(field | std::views::values, std::numeric_limits<std::uint32_t>::max());
+        std::vector<vector<int>> frontier(sources);
+        for (auto const& source : sources)
+            field[source] = 0;
+        for (std::size_t head = 0; head < frontier.size(); ++head)
+        {
+            auto const position = frontier[head];
+            for (auto const& next : views::neighbors(position))
+            {
+                if (shape.contains(next) && costs[next] != 0
+                    && field[next] == std::numeric_limits<std::uint32_t>::max())
+                {
+                    field[next] = field[position] + 1;
+                    frontier.push_back(next);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(field.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * costs.size()));
+}
+
+void distance_field_costs(benchmark::State& state)
+{
+    auto const costs   = make_costs(state);
+    auto const sources = make_sources(state);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(distance_field(costs.shape(), sources, costs));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * costs.size()));
+}
+
+void distance_field_unit(benchmark::State& state)
+{
+    auto const costs   = make_costs(state);
+    auto const sources = make_sources(state);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(distance_field(costs.shape(), sources));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * costs.size()));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(distance_field_shape_lookup)->ArgsProduct({{64, 512}, {1}});
+BENCHMARK(distance_field_costs)->ArgsProduct({{64, 512}, {1, 4, 16}});
+BENCHMARK(distance_field_unit)->ArgsProduct({{64, 512}, {1}});
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
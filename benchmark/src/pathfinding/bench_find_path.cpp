@@ -0,0 +1,120 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/grid/grid.hpp"
+#include "hex/pathfinding/find_path.hpp"
+#include "hex/pathfinding/search_workspace.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <optional>
+#include <random>
+#include <utility>
+#include <ranges>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+using terrain_grid = grid<std::uint8_t, convex_polygon_view<int>>;
+
+// Tiles cost their value to enter, 0 is impassable.
+auto terrain_cost(std::uint8_t value) -> std::optional<std::uint32_t>
+{
+    if (value == 0)
+        return std::nullopt;
+    return value;
+}
+
+// A hexagon of radius range(0) with one in ten tiles impassable and the others costing 1 to 4.
+auto make_terrain(benchmark::State const& state) -> terrain_grid
+{
+    terrain_grid terrain(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))));
+    std::mt19937 gen(42); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::uniform_int_distribution<int> value(0, 39); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    for (auto& v : terrain | std::views::values)
+    {
+        auto const roll = value(gen);
+        v               = static_cast<std::uint8_t>(roll < 4 ? 0 : 1 + (roll % 4));
+    }
+    return terrain;
+}
+
+// Paths across the whole hexagon.
+auto make_queries(benchmark::State const& state) -> std::vector<std::pair<vector<int>, vector<int>>>
+{
+    auto const r  = static_cast<int>(state.range(0)) - 1;
+    auto const at = [](int q, int r) { return vector{q_coordinate<int>(q), r_coordinate<int>(r)}; };
+    return {{at(-r, 0), at(r, 0)},
+            {at(0, -r), at(0, r)},
+            {at(r, -r), at(-r, r)},
+            {at(-r / 2, -r / 2), at(r / 2, r / 2)}};
+}
+
+void find_path_workspace(benchmark::State& state)
+{
+    auto                     terrain = make_terrain(state);
+    auto const               queries = make_queries(state);
+    search_workspace         workspace(terrain.shape());
+    std::vector<vector<int>> path;
+    for (auto const& [from, to] : queries)
+        terrain[from] = terrain[to] = 1;
+    std::size_t expanded = 0;
+    for (auto _ : state)
+    {
+        for (auto const& [from, to] : queries)
+        {
+            benchmark::DoNotOptimize(find_path(terrain, from, to, terrain_cost, workspace, path));
+            expanded += workspace.expanded();
+        }
+    }
+    state.counters["expanded"] = benchmark::Counter(static_cast<double>(expanded), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * queries.size()));
+}
+
+void find_path_temporary(benchmark::State& state)
+{
+    auto       terrain = make_terrain(state);
+    auto const queries = make_queries(state);
+    for (auto const& [from, to] : queries)
+        terrain[from] = terrain[to] = 1;
+    for (auto _ : state)
+    {
+        for (auto const& [from, to] : queries)
+            benchmark::DoNotOptimize(find_path(terrain, from, to, terrain_cost));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * queries.size()));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(find_path_workspace)->Arg(32)->Arg(256);
+BENCHMARK(find_path_temporary)->Arg(32)->Arg(256);
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
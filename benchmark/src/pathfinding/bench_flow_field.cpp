@@ -0,0 +1,97 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/pathfinding/distance_field.hpp"
+#include "hex/pathfinding/flow_field.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+using cost_grid = grid<std::uint8_t, convex_polygon_view<int>>;
+
+// A hexagon of radius range(0) with one in ten tiles impassable and the others costing 1 to 4.
+auto make_costs(benchmark::State const& state) -> cost_grid
+{
+    cost_grid    costs(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))));
+    std::mt19937 gen(42); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::uniform_int_distribution<int> value(0, 39); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    for (auto& c : costs | std::views::values)
+    {
+        auto const roll = value(gen);
+        c               = static_cast<std::uint8_t>(roll < 4 ? 0 : 1 + (roll % 4));
+    }
+    return costs;
+}
+
+auto const sources = std::array{vector<int>{}};
+
+void flow_field_rebuild(benchmark::State& state)
+{
+    auto const costs = make_costs(state);
+    for (auto _ : state)
+    {
+        flow_field const field(distance_field(costs.shape(), sources, costs));
+        benchmark::DoNotOptimize(field.directions().data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * costs.size()));
+}
+
+// Toggles a few tiles between impassable and passable, then repairs the field.
+void flow_field_update(benchmark::State& state)
+{
+    auto       costs = make_costs(state);
+    flow_field field(distance_field(costs.shape(), sources, costs));
+    auto const r       = static_cast<int>(state.range(0)) / 2;
+    auto const at      = [](int q, int r) { return vector{q_coordinate<int>(q), r_coordinate<int>(r)}; };
+    auto const changed = std::array{at(r, 0), at(-r, r), at(1 - r, r), at(0, -r)};
+    std::size_t recomputed = 0;
+    for (auto _ : state)
+    {
+        for (auto const& position : changed)
+            costs[position] = costs[position] == 0 ? 2 : 0;
+        recomputed += field.update(costs, changed);
+    }
+    state.counters["recomputed"] = benchmark::Counter(static_cast<double>(recomputed),
+                                                      benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * costs.size()));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(flow_field_rebuild)->Arg(64)->Arg(256);
+BENCHMARK(flow_field_update)->Arg(64)->Arg(256);
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
@@ -0,0 +1,153 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/pathfinding/find_path.hpp"
+#include "hex/pathfinding/hierarchical_pathfinder.hpp"
+#include "hex/pathfinding/search_workspace.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+using cost_grid = grid<std::uint8_t, convex_polygon_view<int>>;
+using shape     = convex_polygon_view<int>;
+
+// A hexagon of radius range(0) with one in ten tiles impassable and the others costing 1 to 4.
+auto make_costs(benchmark::State const& state) -> cost_grid
+{
+    cost_grid    costs(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))));
+    std::mt19937 gen(42); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::uniform_int_distribution<int> value(0, 39); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    for (auto& c : costs | std::views::values)
+    {
+        auto const roll = value(gen);
+        c               = static_cast<std::uint8_t>(roll < 4 ? 0 : 1 + (roll % 4));
+    }
+    return costs;
+}
+
+auto at(int q, int r) -> vector<int>
+{
+    return vector{q_coordinate<int>(q), r_coordinate<int>(r)};
+}
+
+// Queries between opposite corners of the map, made passable.
+auto make_queries(cost_grid& costs, int radius) -> std::array<std::array<vector<int>, 2>, 3>
+{
+    auto const queries = std::array{std::array{at(-radius, 0), at(radius, 0)},
+                                    std::array{at(0, -radius), at(0, radius)},
+                                    std::array{at(radius, -radius), at(-radius, radius)}};
+    for (auto const& [from, to] : queries)
+    {
+        costs[from] = 1;
+        costs[to]   = 1;
+    }
+    return queries;
+}
+
+void find_path_flat(benchmark::State& state)
+{
+    auto                       costs   = make_costs(state);
+    auto const                 queries = make_queries(costs, static_cast<int>(state.range(0)));
+    search_workspace<shape>    workspace(costs.shape());
+    std::vector<vector<int>>   path;
+    auto const entering = [](std::uint8_t c) { return c == 0 ? std::nullopt : std::optional<std::uint32_t>(c); };
+    std::size_t expanded = 0;
+    for (auto _ : state)
+    {
+        for (auto const& [from, to] : queries)
+        {
+            benchmark::DoNotOptimize(hex::find_path(costs, from, to, entering, workspace, path));
+            expanded += workspace.expanded();
+        }
+    }
+    state.counters["expanded"] = benchmark::Counter(static_cast<double>(expanded), benchmark::Counter::kAvgIterations);
+}
+
+void find_path_hierarchical(benchmark::State& state)
+{
+    auto                             costs   = make_costs(state);
+    auto const                       queries = make_queries(costs, static_cast<int>(state.range(0)));
+    hierarchical_pathfinder<shape>   pathfinder(costs, static_cast<int>(state.range(1)));
+    std::vector<vector<int>>         path;
+    std::size_t                      expanded = 0;
+    for (auto _ : state)
+    {
+        for (auto const& [from, to] : queries)
+        {
+            benchmark::DoNotOptimize(pathfinder.find_path(costs, from, to, path));
+            expanded += pathfinder.expanded();
+        }
+    }
+    state.counters["expanded"] = benchmark::Counter(static_cast<double>(expanded), benchmark::Counter::kAvgIterations);
+}
+
+void hierarchical_pathfinder_build(benchmark::State& state)
+{
+    auto const costs = make_costs(state);
+    for (auto _ : state)
+    {
+        hierarchical_pathfinder<shape> const pathfinder(costs, static_cast<int>(state.range(1)));
+        benchmark::DoNotOptimize(pathfinder.transition_count());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * costs.size()));
+}
+
+// Toggles a few tiles between impassable and passable, then rebuilds the clusters around them.
+void hierarchical_pathfinder_update(benchmark::State& state)
+{
+    auto                           costs = make_costs(state);
+    hierarchical_pathfinder<shape> pathfinder(costs, static_cast<int>(state.range(1)));
+    auto const                     r       = static_cast<int>(state.range(0)) / 2;
+    auto const                     changed = std::array{at(r, 0), at(-r, r), at(1 - r, r), at(0, -r)};
+    std::size_t                    rebuilt = 0;
+    for (auto _ : state)
+    {
+        for (auto const& position : changed)
+            costs[position] = costs[position] == 0 ? 2 : 0;
+        rebuilt += pathfinder.update(costs, changed);
+    }
+    state.counters["rebuilt"] = benchmark::Counter(static_cast<double>(rebuilt), benchmark::Counter::kAvgIterations);
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(find_path_flat)->Arg(256)->Arg(1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(find_path_hierarchical)->Args({256, 8})->Args({1024, 8})->Args({1024, 16})->Unit(benchmark::kMicrosecond);
+BENCHMARK(hierarchical_pathfinder_build)->Args({256, 8})->Args({256, 16})->Unit(benchmark::kMillisecond);
+BENCHMARK(hierarchical_pathfinder_update)->Args({256, 8})->Args({256, 16})->Unit(benchmark::kMicrosecond);
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
@@ -0,0 +1,141 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/pathfinding/find_path.hpp"
+#include "hex/pathfinding/incremental_pathfinder.hpp"
+#include "hex/pathfinding/search_workspace.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+using cost_grid = grid<std::uint8_t, convex_polygon_view<int>>;
+using shape     = convex_polygon_view<int>;
+
+// A hexagon of radius range(0) with one in ten tiles impassable and the others costing 1 to 4.
+auto make_costs(benchmark::State const& state) -> cost_grid
+{
+    cost_grid    costs(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))));
+    std::mt19937 gen(42); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::uniform_int_distribution<int> value(0, 39); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    for (auto& c : costs | std::views::values)
+    {
+        auto const roll = value(gen);
+        c               = static_cast<std::uint8_t>(roll < 4 ? 0 : 1 + (roll % 4));
+    }
+    return costs;
+}
+
+auto at(int q, int r) -> vector<int>
+{
+    return vector{q_coordinate<int>(q), r_coordinate<int>(r)};
+}
+
+// Walks a unit across the map, closing a door halfway along its path every tick and opening the previous one, and
+// replans with plan() after every change. Stops at the goal or after 8 ticks per tile of the radius. Returns the number
+// of ticks.
+template<typename Plan>
+auto walk(cost_grid& costs, Plan plan) -> std::size_t
+{
+    auto const               radius = costs.shape().parameters().qmax().value();
+    auto                     door   = at(-radius, 0);
+    auto const               closed = costs[door];
+    std::vector<vector<int>> path;
+    std::size_t              ticks = 0;
+    plan(door, std::array<vector<int>, 0>{}, path);
+    while (path.size() > 2 && ticks < static_cast<std::size_t>(8 * radius))
+    {
+        auto const opened = door;
+        auto const next   = path[1];
+        costs[opened]     = closed;
+        door              = path[(path.size() / 2) + 1];
+        costs[door]       = 0;
+        plan(next, std::array{opened, door}, path);
+        ++ticks;
+    }
+    return ticks;
+}
+
+void replan_from_scratch(benchmark::State& state)
+{
+    std::size_t ticks = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto costs = make_costs(state);
+        auto const goal = at(static_cast<int>(state.range(0)), 0);
+        costs[goal]     = 1;
+        search_workspace<shape> workspace(costs.shape());
+        state.ResumeTiming();
+        auto const entering = [](std::uint8_t c) { return c == 0 ? std::nullopt : std::optional<std::uint32_t>(c); };
+        ticks += walk(costs,
+                      [&](vector<int> const& start, auto const&, std::vector<vector<int>>& path)
+                      { hex::find_path(costs, start, goal, entering, workspace, path); });
+    }
+    state.counters["ticks"] = benchmark::Counter(static_cast<double>(ticks), benchmark::Counter::kAvgIterations);
+}
+
+void replan_incrementally(benchmark::State& state)
+{
+    std::size_t ticks    = 0;
+    std::size_t expanded = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto costs = make_costs(state);
+        auto const goal = at(static_cast<int>(state.range(0)), 0);
+        costs[goal]     = 1;
+        incremental_pathfinder<shape> pathfinder(costs, at(-static_cast<int>(state.range(0)), 0), goal);
+        state.ResumeTiming();
+        ticks += walk(costs,
+                      [&](vector<int> const& start, auto const& changed, std::vector<vector<int>>& path)
+                      {
+                          pathfinder.move_start(start);
+                          pathfinder.update(costs, changed);
+                          pathfinder.find_path(costs, path);
+                          expanded += pathfinder.expanded();
+                      });
+    }
+    state.counters["ticks"]    = benchmark::Counter(static_cast<double>(ticks), benchmark::Counter::kAvgIterations);
+    state.counters["expanded"] = benchmark::Counter(static_cast<double>(expanded), benchmark::Counter::kAvgIterations);
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(replan_from_scratch)->Arg(32)->Arg(64)->Unit(benchmark::kMillisecond);
+BENCHMARK(replan_incrementally)->Arg(32)->Arg(64)->Unit(benchmark::kMillisecond);
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
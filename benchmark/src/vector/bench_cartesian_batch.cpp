@@ -0,0 +1,122 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/vector/cartesian_batch.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+// range(0) random points within 1000 units of the origin.
+template<typename T>
+auto make_points(benchmark::State const& state) -> std::vector<std::array<T, 2>>
+{
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::mt19937                      gen(42);
+    std::uniform_real_distribution<T> coordinate(-1000, 1000);
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::vector<std::array<T, 2>> points;
+    for (std::int64_t i = 0; i < state.range(0); ++i)
+        points.push_back({coordinate(gen), coordinate(gen)});
+    return points;
+}
+
+template<typename T>
+void pixel_to_hex_single(benchmark::State& state)
+{
+    auto const               points = make_points<T>(state);
+    std::vector<vector<int>> out(points.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < points.size(); ++i)
+            out[i] = round<int>(from_cartesian<T>(points[i]));
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+void pixel_to_hex_batch(benchmark::State& state)
+{
+    auto const               points = make_points<T>(state);
+    std::vector<vector<int>> out(points.size());
+    for (auto _ : state)
+    {
+        pixel_to_hex(std::span(points), std::span(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename R>
+void to_cartesian_single(benchmark::State& state)
+{
+    std::vector<vector<int>> positions;
+    for (auto const& point : make_points<double>(state))
+        positions.push_back(round<int>(from_cartesian<double>(point)));
+    std::vector<std::array<R, 2>> out(positions.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < positions.size(); ++i)
+            out[i] = to_cartesian<R>(positions[i]);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename R>
+void to_cartesian_batch(benchmark::State& state)
+{
+    std::vector<vector<int>> positions;
+    for (auto const& point : make_points<double>(state))
+        positions.push_back(round<int>(from_cartesian<double>(point)));
+    std::vector<std::array<R, 2>> out(positions.size());
+    for (auto _ : state)
+    {
+        to_cartesian(std::span<vector<int> const>(positions), std::span(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(pixel_to_hex_single<float>)->Arg(1 << 16);
+BENCHMARK(pixel_to_hex_batch<float>)->Arg(1 << 16);
+BENCHMARK(pixel_to_hex_single<double>)->Arg(1 << 16);
+BENCHMARK(pixel_to_hex_batch<double>)->Arg(1 << 16);
+BENCHMARK(to_cartesian_single<float>)->Arg(1 << 16);
+BENCHMARK(to_cartesian_batch<float>)->Arg(1 << 16);
+BENCHMARK(to_cartesian_single<double>)->Arg(1 << 16);
+BENCHMARK(to_cartesian_batch<double>)->Arg(1 << 16);
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
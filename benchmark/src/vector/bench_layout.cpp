@@ -0,0 +1,126 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/vector/cartesian_batch.hpp"
+#include "hex/vector/layout.hpp"
+#include "hex/vector/layout_orientation.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+// range(0) random screen points of a pointy map with tiles of size 24, zoomed and panned.
+auto make_pixels(benchmark::State const& state) -> std::vector<std::array<float, 2>>
+{
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::mt19937                          gen(42);
+    std::uniform_real_distribution<float> coordinate(0, 4096);
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::vector<std::array<float, 2>> pixels;
+    for (std::int64_t i = 0; i < state.range(0); ++i)
+        pixels.push_back({coordinate(gen), coordinate(gen)});
+    return pixels;
+}
+
+constexpr float                 tile_size = 24;
+constexpr std::array<float, 2> origin{512, 384};
+
+// Hit-testing by undoing zoom, pan and the pointy rotation by hand before from_cartesian().
+void pixel_to_hex_by_hand(benchmark::State& state)
+{
+    auto const               pixels = make_pixels(state);
+    std::vector<vector<int>> out(pixels.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < pixels.size(); ++i)
+        {
+            auto const x = (pixels[i][0] - origin[0]) / tile_size;
+            auto const y = (pixels[i][1] - origin[1]) / tile_size;
+            // A pointy tile is a flat one with x and y swapped, which mirrors q and r.
+            auto const flat = round<int>(from_cartesian<float>(std::array{y, x}));
+            out[i]          = vector{q_coordinate(flat.r().value()), r_coordinate(flat.q().value())};
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void pixel_to_hex_single(benchmark::State& state)
+{
+    auto const               pixels = make_pixels(state);
+    auto const               layout = hex::layout<float>(layout_orientation::pointy, tile_size, origin);
+    std::vector<vector<int>> out(pixels.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < pixels.size(); ++i)
+            out[i] = layout.pixel_to_hex(pixels[i]);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void pixel_to_hex_batch(benchmark::State& state)
+{
+    auto const               pixels = make_pixels(state);
+    auto const               layout = hex::layout<float>(layout_orientation::pointy, tile_size, origin);
+    std::vector<vector<int>> out(pixels.size());
+    for (auto _ : state)
+    {
+        layout.pixel_to_hex(std::span(pixels), std::span(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void to_pixel_batch(benchmark::State& state)
+{
+    auto const               layout = hex::layout<float>(layout_orientation::pointy, tile_size, origin);
+    auto const               pixels = make_pixels(state);
+    std::vector<vector<int>> positions(pixels.size());
+    layout.pixel_to_hex(std::span(pixels), std::span(positions));
+    std::vector<std::array<float, 2>> out(positions.size());
+    for (auto _ : state)
+    {
+        layout.to_pixel(std::span<vector<int> const>(positions), std::span(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(pixel_to_hex_by_hand)->Arg(1 << 16);
+BENCHMARK(pixel_to_hex_single)->Arg(1 << 16);
+BENCHMARK(pixel_to_hex_batch)->Arg(1 << 16);
+BENCHMARK(to_pixel_batch)->Arg(1 << 16);
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
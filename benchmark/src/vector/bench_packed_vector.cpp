@@ -0,0 +1,155 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/vector/packed_vector.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+// range(0) random vectors within 1000 tiles of the origin.
+auto make_vectors(benchmark::State const& state) -> std::vector<vector<int>>
+{
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::mt19937                       gen(42);
+    std::uniform_int_distribution<int> coordinate(-1000, 1000);
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::vector<vector<int>> vectors;
+    for (std::int64_t i = 0; i < state.range(0); ++i)
+        vectors.push_back(vector{q_coordinate(coordinate(gen)), r_coordinate(coordinate(gen))});
+    return vectors;
+}
+
+auto make_packed(benchmark::State const& state) -> std::vector<packed_vector<>>
+{
+    std::vector<packed_vector<>> packed;
+    for (auto const& vec : make_vectors(state))
+        packed.emplace_back(vec);
+    return packed;
+}
+
+// Sorts the words of packed vectors in four passes of 8 bits each, least significant first.
+void radix_sort(std::vector<std::uint32_t>& words, std::vector<std::uint32_t>& buffer)
+{
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    buffer.resize(words.size());
+    for (unsigned shift = 0; shift < 32; shift += 8)
+    {
+        std::array<std::size_t, 257> offsets{};
+        for (auto const word : words)
+            ++offsets[((word >> shift) & 0xFFU) + 1];
+        for (std::size_t i = 1; i < offsets.size(); ++i)
+            offsets[i] += offsets[i - 1];
+        for (auto const word : words)
+            buffer[offsets[(word >> shift) & 0xFFU]++] = word;
+        words.swap(buffer);
+    }
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+}
+
+void sort_vectors(benchmark::State& state)
+{
+    auto const vectors = make_vectors(state);
+    for (auto _ : state)
+    {
+        auto sorted = vectors;
+        std::ranges::sort(sorted);
+        benchmark::DoNotOptimize(sorted.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void sort_packed(benchmark::State& state)
+{
+    auto const packed = make_packed(state);
+    for (auto _ : state)
+    {
+        auto sorted = packed;
+        std::ranges::sort(sorted);
+        benchmark::DoNotOptimize(sorted.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void radix_sort_packed(benchmark::State& state)
+{
+    std::vector<std::uint32_t> words;
+    for (auto const& packed : make_packed(state))
+        words.push_back(packed.word());
+    std::vector<std::uint32_t> buffer;
+    for (auto _ : state)
+    {
+        auto sorted = words;
+        radix_sort(sorted, buffer);
+        benchmark::DoNotOptimize(sorted.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void lookup_vectors(benchmark::State& state)
+{
+    auto const                      vectors = make_vectors(state);
+    std::unordered_set<vector<int>> set(vectors.begin(), vectors.end());
+    for (auto _ : state)
+    {
+        std::size_t found = 0;
+        for (auto const& vec : vectors)
+            found += set.count(vec);
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void lookup_packed(benchmark::State& state)
+{
+    auto const                          packed = make_packed(state);
+    std::unordered_set<packed_vector<>> set(packed.begin(), packed.end());
+    for (auto _ : state)
+    {
+        std::size_t found = 0;
+        for (auto const& vec : packed)
+            found += set.count(vec);
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(sort_vectors)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(sort_packed)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(radix_sort_packed)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(lookup_vectors)->Arg(1 << 16);
+BENCHMARK(lookup_packed)->Arg(1 << 16);
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
@@ -0,0 +1,137 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/vector/coordinate_axis.hpp"
+#include "hex/vector/rotation_steps.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/vector/vector_batch.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+// range(0) random positions within 1000 tiles of the origin, one vector at a time and as a batch.
+auto make_positions(benchmark::State const& state) -> std::vector<vector<int>>
+{
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::mt19937                       gen(42);
+    std::uniform_int_distribution<int> coordinate(-1000, 1000);
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::vector<vector<int>>           positions;
+    for (std::int64_t i = 0; i < state.range(0); ++i)
+        positions.push_back(vector{q_coordinate(coordinate(gen)), r_coordinate(coordinate(gen))});
+    return positions;
+}
+
+auto const target = vector{q_coordinate(17), r_coordinate(-4)}; // NOLINT(cert-err58-cpp)
+
+void distance_single(benchmark::State& state)
+{
+    auto const       positions = make_positions(state);
+    std::vector<int> out(positions.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < positions.size(); ++i)
+            out[i] = distance(positions[i], target);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void distance_batch(benchmark::State& state)
+{
+    auto const        positions = make_positions(state);
+    vector_batch<int> batch(positions.begin(), positions.end());
+    std::vector<int>  out(positions.size());
+    for (auto _ : state)
+    {
+        distance(batch, target, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void translate_rotate_single(benchmark::State& state)
+{
+    auto positions = make_positions(state);
+    for (auto _ : state)
+    {
+        for (auto& position : positions)
+            position = rotate(position + target, rot_60_cw);
+        benchmark::DoNotOptimize(positions.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void translate_rotate_batch(benchmark::State& state)
+{
+    auto const        positions = make_positions(state);
+    vector_batch<int> batch(positions.begin(), positions.end());
+    for (auto _ : state)
+    {
+        batch = rotate(std::move(batch) + target, rot_60_cw);
+        benchmark::DoNotOptimize(batch.q_data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void reflect_single(benchmark::State& state)
+{
+    auto positions = make_positions(state);
+    for (auto _ : state)
+    {
+        for (auto& position : positions)
+            position = reflect(position, coordinate_axis::r);
+        benchmark::DoNotOptimize(positions.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void reflect_batch(benchmark::State& state)
+{
+    auto const        positions = make_positions(state);
+    vector_batch<int> batch(positions.begin(), positions.end());
+    for (auto _ : state)
+    {
+        batch = reflect(std::move(batch), coordinate_axis::r);
+        benchmark::DoNotOptimize(batch.q_data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(distance_single)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(distance_batch)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(translate_rotate_single)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(translate_rotate_batch)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(reflect_single)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(reflect_batch)->Arg(1 << 16)->Arg(1 << 20);
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
@@ -0,0 +1,137 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+// Enough rows for the largest benchmarked radius.
+constexpr std::size_t max_rows = 1025;
+
+template<typename T, std::size_t MaxRows = 0>
+auto make_view(benchmark::State const& state) -> convex_polygon_view<T, MaxRows>
+{
+    return convex_polygon_view<T, MaxRows>(make_regular_hexagon_parameters(static_cast<T>(state.range(0))));
+}
+
+auto shuffled_indices(std::size_t size) -> std::vector<std::size_t>
+{
+    std::vector<std::size_t> indices(size);
+    for (std::size_t i = 0; i < size; ++i)
+        indices[i] = i;
+    std::ranges::shuffle(indices, std::mt19937(42)); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    return indices;
+}
+
+template<typename T>
+void convex_polygon_view_iterate_forward(benchmark::State& state)
+{
+    auto const view = make_view<T>(state);
+    for (auto _ : state)
+    {
+        for (auto const& v : view)
+            benchmark::DoNotOptimize(v);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * view.size()));
+}
+
+template<typename T>
+void convex_polygon_view_iterate_backward(benchmark::State& state)
+{
+    auto const view = make_view<T>(state);
+    for (auto _ : state)
+    {
+        for (auto const& v : view | std::views::reverse)
+            benchmark::DoNotOptimize(v);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * view.size()));
+}
+
+template<typename T, std::size_t MaxRows = 0>
+void convex_polygon_view_iterate_random(benchmark::State& state)
+{
+    auto const view    = make_view<T, MaxRows>(state);
+    auto const indices = shuffled_indices(view.size());
+    auto const begin   = view.begin();
+    for (auto _ : state)
+    {
+        for (auto const idx : indices)
+            benchmark::DoNotOptimize(begin[static_cast<std::ptrdiff_t>(idx)]);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * view.size()));
+}
+
+template<typename T, std::size_t MaxRows = 0>
+void convex_polygon_view_index_to_vector(benchmark::State& state)
+{
+    auto const view    = make_view<T, MaxRows>(state);
+    auto const indices = shuffled_indices(view.size());
+    for (auto _ : state)
+    {
+        for (auto const idx : indices)
+            benchmark::DoNotOptimize(view[idx]);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * view.size()));
+}
+
+template<typename T, std::size_t MaxRows = 0>
+void convex_polygon_view_vector_to_index(benchmark::State& state)
+{
+    auto const view = make_view<T, MaxRows>(state);
+    auto       keys = std::vector<vector<T>>(view.begin(), view.end());
+    std::ranges::shuffle(keys, std::mt19937(42)); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    for (auto _ : state)
+    {
+        for (auto const& v : keys)
+            benchmark::DoNotOptimize(view[v]);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * view.size()));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(convex_polygon_view_iterate_forward<int>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(convex_polygon_view_iterate_forward<std::int64_t>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(convex_polygon_view_iterate_backward<int>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(convex_polygon_view_iterate_random<int>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(convex_polygon_view_iterate_random<int, max_rows>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(convex_polygon_view_index_to_vector<int>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(convex_polygon_view_index_to_vector<std::int64_t>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(convex_polygon_view_index_to_vector<int, max_rows>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(convex_polygon_view_vector_to_index<int>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(convex_polygon_view_vector_to_index<std::int64_t>)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(convex_polygon_view_vector_to_index<int, max_rows>)->RangeMultiplier(8)->Range(8, 512);
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
@@ -0,0 +1,117 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/vector/coordinate.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/line/detail/detail_line_iterator.hpp"
+#include "hex/views/line/line_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+// Iterates lines of the given length in all six sextants, so every rasterization branch is exercised.
+template<typename T>
+void line_view_iterate(benchmark::State& state)
+{
+    auto const length = static_cast<T>(state.range(0));
+    auto const half   = static_cast<T>(length / 2);
+
+    vector<T> const targets[] = {
+        vector{q_coordinate<T>(length), r_coordinate<T>(-half)},
+        vector{q_coordinate<T>(half), r_coordinate<T>(half)},
+        vector{q_coordinate<T>(-half), r_coordinate<T>(length)},
+        vector{q_coordinate<T>(-length), r_coordinate<T>(half)},
+        vector{q_coordinate<T>(-half), r_coordinate<T>(-half)},
+        vector{q_coordinate<T>(half), r_coordinate<T>(-length)},
+    };
+
+    std::int64_t items = 0;
+    for (auto _ : state)
+    {
+        for (auto const& to : targets)
+        {
+            for (auto const& v : views::line(vector<T>{}, to))
+                benchmark::DoNotOptimize(v);
+            items += static_cast<std::int64_t>(views::line(vector<T>{}, to).size());
+        }
+    }
+    state.SetItemsProcessed(items);
+}
+
+// As above, with the sextant dispatched once per line and the positions produced by a sextant-specialized loop.
+template<typename T>
+void line_for_each_position(benchmark::State& state)
+{
+    auto const length = static_cast<T>(state.range(0));
+    auto const half   = static_cast<T>(length / 2);
+
+    vector<T> const targets[] = {
+        vector{q_coordinate<T>(length), r_coordinate<T>(-half)},
+        vector{q_coordinate<T>(half), r_coordinate<T>(half)},
+        vector{q_coordinate<T>(-half), r_coordinate<T>(length)},
+        vector{q_coordinate<T>(-length), r_coordinate<T>(half)},
+        vector{q_coordinate<T>(-half), r_coordinate<T>(-half)},
+        vector{q_coordinate<T>(half), r_coordinate<T>(-length)},
+    };
+
+    std::int64_t items = 0;
+    for (auto _ : state)
+    {
+        for (auto const& to : targets)
+        {
+            detail::for_each_line_position(vector<T>{}, to, [](vector<T> const& v) { benchmark::DoNotOptimize(v); });
+            items += static_cast<std::int64_t>(views::line(vector<T>{}, to).size());
+        }
+    }
+    state.SetItemsProcessed(items);
+}
+
+// Samples every 16th position of a line through random access.
+template<typename T>
+void line_view_sample(benchmark::State& state)
+{
+    auto const length = static_cast<T>(state.range(0));
+    auto const line   = views::line(vector<T>{}, vector{q_coordinate<T>(length), r_coordinate<T>(-length / 3)});
+
+    std::int64_t items = 0;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < line.size(); i += 16)
+            benchmark::DoNotOptimize(line[i]);
+        items += static_cast<std::int64_t>((line.size() + 15) / 16);
+    }
+    state.SetItemsProcessed(items);
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(line_view_iterate<int>)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK(line_for_each_position<int>)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK(line_view_sample<int>)->RangeMultiplier(8)->Range(64, 4096);
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
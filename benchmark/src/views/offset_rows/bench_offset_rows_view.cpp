@@ -0,0 +1,102 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/vector/coordinate_axis.hpp"
+#include "hex/views/offset_rows/offset_parity.hpp"
+#include "hex/views/offset_rows/offset_rows_parameters.hpp"
+#include "hex/views/offset_rows/offset_rows_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+template<coordinate_axis Axis, offset_parity Parity>
+void offset_rows_view_iterate(benchmark::State& state)
+{
+    auto const side = static_cast<std::size_t>(state.range(0));
+    auto const view = views::offset_rows(offset_rows_parameters<int>(side, side, Axis, Parity));
+    for (auto _ : state)
+    {
+        for (auto const& v : view)
+            benchmark::DoNotOptimize(v);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * view.size()));
+}
+
+template<coordinate_axis Axis, offset_parity Parity>
+void offset_rows_view_vector_to_index(benchmark::State& state)
+{
+    auto const side = static_cast<std::size_t>(state.range(0));
+    auto const view = views::offset_rows(offset_rows_parameters<int>(side, side, Axis, Parity));
+    for (auto _ : state)
+    {
+        for (auto const& v : view)
+            benchmark::DoNotOptimize(view[v]);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * view.size()));
+}
+
+template<coordinate_axis Axis, offset_parity Parity>
+void static_offset_rows_view_iterate(benchmark::State& state)
+{
+    auto const side = static_cast<std::size_t>(state.range(0));
+    auto const view = views::offset_rows<Axis, Parity>(side, side);
+    for (auto _ : state)
+    {
+        for (auto const& v : view)
+            benchmark::DoNotOptimize(v);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * view.size()));
+}
+
+template<coordinate_axis Axis, offset_parity Parity>
+void static_offset_rows_view_vector_to_index(benchmark::State& state)
+{
+    auto const side = static_cast<std::size_t>(state.range(0));
+    auto const view = views::offset_rows<Axis, Parity>(side, side);
+    for (auto _ : state)
+    {
+        for (auto const& v : view)
+            benchmark::DoNotOptimize(view[v]);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * view.size()));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(offset_rows_view_iterate<coordinate_axis::q, offset_parity::odd>)->RangeMultiplier(8)->Range(8, 1024);
+BENCHMARK(offset_rows_view_iterate<coordinate_axis::r, offset_parity::even>)->RangeMultiplier(8)->Range(8, 1024);
+BENCHMARK(offset_rows_view_iterate<coordinate_axis::s, offset_parity::odd>)->RangeMultiplier(8)->Range(8, 1024);
+BENCHMARK(offset_rows_view_vector_to_index<coordinate_axis::q, offset_parity::odd>)->RangeMultiplier(8)->Range(8, 1024);
+BENCHMARK(static_offset_rows_view_iterate<coordinate_axis::q, offset_parity::odd>)->RangeMultiplier(8)->Range(8, 1024);
+BENCHMARK(static_offset_rows_view_iterate<coordinate_axis::r, offset_parity::even>)->RangeMultiplier(8)->Range(8, 1024);
+BENCHMARK(static_offset_rows_view_iterate<coordinate_axis::s, offset_parity::odd>)->RangeMultiplier(8)->Range(8, 1024);
+BENCHMARK(static_offset_rows_view_vector_to_index<coordinate_axis::q, offset_parity::odd>)
+    ->RangeMultiplier(8)
+    ->Range(8, 1024);
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
@@ -0,0 +1,94 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/vector/coordinate.hpp"
+#include "hex/vector/coordinate_axis.hpp"
+#include "hex/vector/reflection.hpp"
+#include "hex/vector/rotation_steps.hpp"
+#include "hex/vector/transformation.hpp"
+#include "hex/vector/translation.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/transform/transform_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+// The input radius is kept small enough for all coordinates to be valid std::int8_t coordinates.
+constexpr int input_radius = 20;
+
+template<typename T>
+auto make_input() -> std::vector<vector<T>>
+{
+    std::vector<vector<T>> input;
+    for (auto const& v : views::convex_polygon(make_regular_hexagon_parameters(input_radius)))
+        input.push_back(coordinate_cast<T>(v));
+    return input;
+}
+
+template<typename T>
+void transform_rotation_steps(benchmark::State& state)
+{
+    auto const input = make_input<T>();
+    for (auto _ : state)
+    {
+        for (auto const& v : input | views::transform(rot_60_cw))
+            benchmark::DoNotOptimize(v);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+}
+
+template<typename T>
+void transform_combined(benchmark::State& state)
+{
+    auto const input = make_input<T>();
+    auto const t     = combine(transformation<T>(rot_120_cw),
+                           transformation<T>(reflection(coordinate_axis::r)),
+                           transformation<T>(translation(vector{q_coordinate<T>(1), r_coordinate<T>(-1)})));
+    for (auto _ : state)
+    {
+        for (auto const& v : input | views::transform(t))
+            benchmark::DoNotOptimize(v);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(transform_rotation_steps<std::int8_t>);
+BENCHMARK(transform_rotation_steps<int>);
+BENCHMARK(transform_rotation_steps<std::int64_t>);
+BENCHMARK(transform_rotation_steps<double>);
+BENCHMARK(transform_combined<std::int8_t>);
+BENCHMARK(transform_combined<int>);
+BENCHMARK(transform_combined<std::int64_t>);
+BENCHMARK(transform_combined<double>);
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
@@ -0,0 +1,112 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/grid/grid.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/line/line_view.hpp"
+#include "hex/visibility/field_of_view.hpp"
+#include "hex/visibility/field_of_view_mode.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <ranges>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+using opacity_grid = grid<std::uint8_t, convex_polygon_view<int>>;
+
+// A hexagon of radius range(0) with range(1) of every 1000 tiles opaque.
+auto make_opacity(benchmark::State const& state) -> opacity_grid
+{
+    opacity_grid opacity(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))));
+    std::mt19937 gen(42); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::bernoulli_distribution opaque(static_cast<double>(state.range(1)) / 1000.0);
+    for (auto& o : opacity | std::views::values)
+        o = opaque(gen) ? 1 : 0;
+    opacity[vector<int>{}] = 0;
+    return opacity;
+}
+
+// Casts a line to every position, as field_of_view replaces.
+void field_of_view_lines(benchmark::State& state)
+{
+    auto const   opacity = make_opacity(state);
+    opacity_grid visible(opacity.shape());
+    for (auto _ : state)
+    {
+        for (auto const& to : opacity.shape())
+        {
+            auto const line = views::line(vector<int>{}, to);
+            auto const lit  = std::ranges::none_of(line | std::views::drop(1) | std::views::take(line.size() - 1),
+                                                  [&](auto const& v) { return opacity[v] != 0; });
+            visible[to]     = line.size() <= 1 || lit ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(visible.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * opacity.size()));
+}
+
+void field_of_view_grid(benchmark::State& state)
+{
+    auto const   opacity = make_opacity(state);
+    auto const   mode    = static_cast<field_of_view_mode>(state.range(2));
+    auto const   radius  = static_cast<std::ptrdiff_t>(state.range(0));
+    opacity_grid visible(opacity.shape());
+    for (auto _ : state)
+    {
+        field_of_view(opacity, vector<int>{}, radius, visible, mode);
+        benchmark::DoNotOptimize(visible.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * opacity.size()));
+}
+
+void field_of_view_visit(benchmark::State& state)
+{
+    auto const     opacity = make_opacity(state);
+    auto const     mode    = static_cast<field_of_view_mode>(state.range(2));
+    auto const     radius  = static_cast<std::ptrdiff_t>(state.range(0));
+    std::ptrdiff_t count   = 0;
+    for (auto _ : state)
+    {
+        field_of_view(opacity, vector<int>{}, radius, [&](vector<int> const&) { ++count; }, mode);
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * opacity.size()));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(field_of_view_lines)->ArgsProduct({{8, 32}, {10, 125}});
+BENCHMARK(field_of_view_grid)->ArgsProduct({{8, 32}, {10, 125}, {0, 1}});
+BENCHMARK(field_of_view_visit)->ArgsProduct({{8, 32}, {10, 125}, {0, 1}});
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
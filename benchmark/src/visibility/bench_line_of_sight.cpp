@@ -0,0 +1,119 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/visibility/line_of_sight.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+using blocker_grid = grid<std::uint8_t, convex_polygon_view<int>>;
+
+// A hexagon of radius range(0) with range(1) of every 1000 tiles blocking, and all of its tiles as targets.
+struct scene
+{
+    blocker_grid             blockers;
+    neighbor_table<>         neighbors;
+    std::vector<vector<int>> targets;
+    std::unique_ptr<bool[]>  visible; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+
+    explicit scene(benchmark::State const& state)
+        : blockers(views::convex_polygon(make_regular_hexagon_parameters(static_cast<int>(state.range(0)))))
+        , neighbors(blockers.shape())
+        , targets(blockers.shape().begin(), blockers.shape().end())
+        , visible(std::make_unique<bool[]>(targets.size())) // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    {
+        std::mt19937 gen(42); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        std::bernoulli_distribution blocked(static_cast<double>(state.range(1)) / 1000.0);
+        for (auto& b : blockers | std::views::values)
+            b = blocked(gen) ? 1 : 0;
+    }
+
+    [[nodiscard]] auto output() const -> std::span<bool> { return {visible.get(), targets.size()}; }
+};
+
+void line_of_sight_each(benchmark::State& state)
+{
+    scene s(state);
+    for (auto _ : state)
+    {
+        for (auto const& to : s.targets)
+            benchmark::DoNotOptimize(line_of_sight(s.blockers, vector<int>{}, to));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * s.targets.size()));
+}
+
+void line_of_sight_each_with_table(benchmark::State& state)
+{
+    scene s(state);
+    for (auto _ : state)
+    {
+        for (auto const& to : s.targets)
+            benchmark::DoNotOptimize(line_of_sight(s.blockers, s.neighbors, vector<int>{}, to));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * s.targets.size()));
+}
+
+void line_of_sight_many(benchmark::State& state)
+{
+    scene s(state);
+    for (auto _ : state)
+    {
+        line_of_sight_many(s.blockers, vector<int>{}, s.targets, s.output());
+        benchmark::DoNotOptimize(s.visible.get());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * s.targets.size()));
+}
+
+void line_of_sight_many_with_table(benchmark::State& state)
+{
+    scene s(state);
+    for (auto _ : state)
+    {
+        line_of_sight_many(s.blockers, s.neighbors, vector<int>{}, s.targets, s.output());
+        benchmark::DoNotOptimize(s.visible.get());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * s.targets.size()));
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+BENCHMARK(line_of_sight_each)->ArgsProduct({{8, 64}, {10, 125}});
+BENCHMARK(line_of_sight_each_with_table)->ArgsProduct({{8, 64}, {10, 125}});
+BENCHMARK(line_of_sight_many)->ArgsProduct({{8, 64}, {10, 125}});
+BENCHMARK(line_of_sight_many_with_table)->ArgsProduct({{8, 64}, {10, 125}});
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,cert-err58-cpp)
+} // namespace
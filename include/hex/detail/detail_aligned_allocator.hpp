@@ -0,0 +1,94 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_DETAIL_ALIGNED_ALLOCATOR_HPP
+#define HEX_DETAIL_ALIGNED_ALLOCATOR_HPP
+
+#include <memory>
+#include <new>
+
+#include <cstddef>
+
+namespace hex::detail
+{
+// An allocator returning storage aligned to Alignment bytes, so that vector instructions can load whole registers from
+// the start of an array. Falls back to std::allocator during constant evaluation.
+template<typename T, std::size_t Alignment>
+class aligned_allocator
+{
+  public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    constexpr aligned_allocator() noexcept = default;
+    template<typename U>
+    constexpr explicit aligned_allocator(aligned_allocator<U, Alignment> const& /*other*/) noexcept
+    {
+    }
+
+    [[nodiscard]] constexpr auto allocate(std::size_t n) -> T*;
+    constexpr void               deallocate(T* p, std::size_t n) noexcept;
+
+    template<typename U>
+    [[nodiscard]] constexpr auto operator==(aligned_allocator<U, Alignment> const& /*other*/) const noexcept -> bool
+    {
+        return true;
+    }
+};
+} // namespace hex::detail
+
+// ------------------------------ implementation below ------------------------------
+
+template<typename T, std::size_t Alignment>
+constexpr auto hex::detail::aligned_allocator<T, Alignment>::allocate(std::size_t n) -> T*
+{
+    if consteval
+    {
+        return std::allocator<T>{}.allocate(n);
+    }
+    else
+    {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+}
+
+template<typename T, std::size_t Alignment>
+constexpr void hex::detail::aligned_allocator<T, Alignment>::deallocate(T* p, std::size_t n) noexcept
+{
+    if consteval
+    {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+    else
+    {
+        ::operator delete(p, n * sizeof(T), std::align_val_t{Alignment});
+    }
+}
+
+#endif // HEX_DETAIL_ALIGNED_ALLOCATOR_HPP
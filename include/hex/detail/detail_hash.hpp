@@ -0,0 +1,81 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef HEX_DETAIL_HASH_HPP
+#define HEX_DETAIL_HASH_HPP
+
+#include <concepts>
+
+#include <cstdint>
+
+namespace hex::detail
+{
+// The 64 bit finalizer of MurmurHash3. Every input bit affects every output bit, so consecutive keys (as produced by
+// neighboring hex coordinates) are scattered uniformly.
+constexpr auto hash_mix(std::uint64_t x) noexcept -> std::uint64_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    x ^= x >> 33U;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33U;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    return x ^ (x >> 33U);
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+}
+
+// Combines two hash values into one. Not commutative, i.e. hash_combine(a, b) != hash_combine(b, a) in general.
+constexpr auto hash_combine(std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    return hash_mix(a ^ (hash_mix(b) + 0x9e3779b97f4a7c15ULL + (a << 6U) + (a >> 2U)));
+}
+
+// Packs two integers of at most 32 bits into a single word without loss of information.
+template<std::signed_integral T>
+    requires(sizeof(T) <= sizeof(std::int32_t))
+constexpr auto pack_qr(T q, T r) noexcept -> std::uint64_t
+{
+    auto const hi = static_cast<std::uint32_t>(static_cast<std::int32_t>(q));
+    auto const lo = static_cast<std::uint32_t>(static_cast<std::int32_t>(r));
+    return (std::uint64_t{hi} << 32U) | lo; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+}
+
+// Inverse of pack_qr. Returns the q component.
+template<std::signed_integral T>
+    requires(sizeof(T) <= sizeof(std::int32_t))
+constexpr auto unpack_q(std::uint64_t packed) noexcept -> T
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    return static_cast<T>(static_cast<std::int32_t>(static_cast<std::uint32_t>(packed >> 32U)));
+}
+
+// Inverse of pack_qr. Returns the r component.
+template<std::signed_integral T>
+    requires(sizeof(T) <= sizeof(std::int32_t))
+constexpr auto unpack_r(std::uint64_t packed) noexcept -> T
+{
+    return static_cast<T>(static_cast<std::int32_t>(static_cast<std::uint32_t>(packed)));
+}
+} // namespace hex::detail
+
+#endif // HEX_DETAIL_HASH_HPP
@@ -0,0 +1,507 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef HEX_CHUNKED_GRID_HPP
+#define HEX_CHUNKED_GRID_HPP
+
+#include "hex/grid/detail/detail_chunked_grid_iterator.hpp"
+#include "hex/grid/sparse_grid.hpp"
+#include "hex/vector/coordinate.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+#include <cstddef>
+
+namespace hex
+{
+// An unbounded associative container mapping hex positions to user-defined data, meant for maps that grow as they are
+// explored. The plane is partitioned into ChunkSize x ChunkSize parallelogram chunks in axial coordinates. Each chunk
+// is a single contiguous block of default-constructed values, allocated on first write to any of its positions, and
+// ordered like convex_polygon_view over the chunk's parallelogram: by q, then by r. Only positions in allocated chunks
+// are contained. Chunks are addressed through a hashed chunk directory, so lookups are O(1), and iteration walks only
+// the allocated chunks, in allocation order. References stay valid until clear().
+// This type models std::ranges::sized_range, std::ranges::bidirectional_range, std::ranges::common_range.
+template<typename T, std::size_t ChunkSize = 16, class Allocator = std::allocator<T>>
+    requires(std::has_single_bit(ChunkSize))
+class chunked_grid
+{
+  public:
+    using allocator_type         = Allocator;
+    using key_type               = vector<int>;
+    using mapped_type            = T;
+    using value_type             = std::pair<key_type const, T>;
+    using reference              = std::pair<key_type const, mapped_type&>;
+    using const_reference        = std::pair<key_type const, mapped_type const&>;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using iterator               = detail::chunked_grid_iterator<chunked_grid, false>;
+    using const_iterator         = detail::chunked_grid_iterator<chunked_grid, true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type chunk_size   = ChunkSize;             // Side length of a chunk
+    static constexpr size_type chunk_volume = ChunkSize * ChunkSize; // Number of values stored per chunk
+
+    constexpr ~chunked_grid() = default;
+
+    // Initializes an empty grid. Does not allocate.
+    constexpr chunked_grid() = default;
+
+    constexpr chunked_grid(chunked_grid const&) = default;
+    constexpr chunked_grid(chunked_grid const& other, Allocator const& alloc);
+    // Leaves other empty.
+    constexpr chunked_grid(chunked_grid&& other) noexcept;
+    constexpr chunked_grid(chunked_grid&& other, Allocator const& alloc);
+
+    // Initializes an empty grid with the given allocator. Does not allocate.
+    constexpr explicit chunked_grid(Allocator const& alloc);
+
+    // Initializes the grid with the given allocator, setting all values from the given range. Chunks touched by the
+    // range are allocated; positions in them not mentioned in the range are default-constructed.
+    template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    constexpr chunked_grid(InputIt first, Sentinel last, Allocator const& alloc = Allocator());
+
+    // Initializes the grid with the given allocator, setting all values from the given initializer_list. Chunks touched
+    // by the list are allocated; positions in them not mentioned in the list are default-constructed.
+    constexpr chunked_grid(std::initializer_list<value_type> init, Allocator const& alloc = Allocator());
+
+    constexpr auto operator=(chunked_grid const&) -> chunked_grid& = default;
+    // Leaves other empty.
+    constexpr auto operator=(chunked_grid&& other) noexcept(
+        std::is_nothrow_move_assignable_v<std::vector<T, Allocator>>) -> chunked_grid&;
+
+    // Returns reference to value associated with the given key, allocating its chunk if necessary.
+    constexpr auto operator[](key_type const& key) -> T&;
+    // Returns const reference to value associated with the given key. UB if key not contained.
+    constexpr auto operator[](key_type const& key) const -> T const&;
+
+    // Returns reference to value associated with the given key. Throws std::out_of_range if key not contained.
+    constexpr auto at(key_type const& key) -> T&;
+    // Returns const reference to value associated with the given key. Throws std::out_of_range if key not contained.
+    constexpr auto at(key_type const& key) const -> T const&;
+
+    constexpr auto begin() noexcept -> iterator;
+    constexpr auto begin() const noexcept -> const_iterator;
+    constexpr auto cbegin() const noexcept -> const_iterator;
+
+    constexpr auto end() noexcept -> iterator;
+    constexpr auto end() const noexcept -> const_iterator;
+    constexpr auto cend() const noexcept -> const_iterator;
+
+    constexpr auto rbegin() noexcept -> reverse_iterator;
+    constexpr auto rbegin() const noexcept -> const_reverse_iterator;
+    constexpr auto crbegin() const noexcept -> const_reverse_iterator;
+
+    constexpr auto rend() noexcept -> reverse_iterator;
+    constexpr auto rend() const noexcept -> const_reverse_iterator;
+    constexpr auto crend() const noexcept -> const_reverse_iterator;
+
+    // Returns true if no chunk is allocated, otherwise false.
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool;
+    // Returns number of keys in the grid, i.e. the number of allocated chunks times chunk_volume.
+    [[nodiscard]] constexpr auto size() const noexcept -> size_type;
+    // Returns the maximum number of keys the grid could ever hold.
+    [[nodiscard]] constexpr auto max_size() const noexcept -> size_type;
+    // Returns the number of allocated chunks.
+    [[nodiscard]] constexpr auto chunk_count() const noexcept -> size_type;
+
+    // Ensures the chunk directory can hold at least count chunks without reallocating.
+    constexpr void reserve_chunks(size_type count);
+    // Releases all chunks.
+    constexpr void clear() noexcept;
+
+    constexpr void swap(chunked_grid& other) noexcept;
+
+    // Returns an iterator to the given key, if its chunk is allocated. Otherwise, returns end(). O(1).
+    constexpr auto find(key_type const& key) -> iterator;
+    // Returns an iterator to the given key, if its chunk is allocated. Otherwise, returns end(). O(1).
+    constexpr auto find(key_type const& key) const -> const_iterator;
+
+    // Returns 1 if the key is in the grid, otherwise 0. O(1).
+    constexpr auto count(key_type const& key) const -> size_type;
+
+    // Returns true if the chunk containing the given key is allocated, otherwise false. O(1).
+    constexpr auto contains(key_type const& key) const -> bool;
+
+    // Returns a copy of the allocator used for the values.
+    [[nodiscard]] constexpr auto get_allocator() const noexcept -> allocator_type;
+
+    // Returns the position with the lowest q and r coordinates in the chunk containing the given key.
+    [[nodiscard]] static constexpr auto chunk_origin(key_type const& key) noexcept -> key_type;
+
+  private:
+    struct chunk
+    {
+        key_type                  origin;
+        std::vector<T, Allocator> values;
+    };
+
+    using chunk_allocator     = typename std::allocator_traits<Allocator>::template rebind_alloc<chunk>;
+    using directory_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<size_type>;
+
+    static constexpr int s_chunk_shift = std::countr_zero(ChunkSize);
+    static constexpr int s_local_mask  = static_cast<int>(ChunkSize - 1);
+
+    std::vector<chunk, chunk_allocator>              m_chunks;
+    sparse_grid<size_type, int, directory_allocator> m_directory; // chunk key -> index into m_chunks
+
+    [[nodiscard]] static constexpr auto chunk_key(key_type const& key) noexcept -> key_type;
+    [[nodiscard]] static constexpr auto local_index(key_type const& key) noexcept -> size_type;
+    [[nodiscard]] static constexpr auto chunk_key_at(key_type const& origin, size_type index) noexcept -> key_type;
+
+    // Returns the index of the chunk containing key, or m_chunks.size() if it is not allocated.
+    [[nodiscard]] constexpr auto find_chunk(key_type const& key) const -> size_type;
+    // Returns the index of the chunk containing key, allocating it if necessary.
+    constexpr auto allocate_chunk(key_type const& key) -> size_type;
+
+    friend iterator;
+    friend const_iterator;
+};
+
+// Swaps the contents of both grids. Not a friend, as it only needs the public member swap().
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr void swap(chunked_grid<T, ChunkSize, Allocator>& lhs, chunked_grid<T, ChunkSize, Allocator>& rhs) noexcept;
+
+// ------------------------------ implementation below ------------------------------
+
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr chunked_grid<T, ChunkSize, Allocator>::chunked_grid(chunked_grid const& other, Allocator const& alloc)
+    : m_chunks(other.m_chunks, chunk_allocator(alloc))
+    , m_directory(other.m_directory, directory_allocator(alloc))
+{
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr chunked_grid<T, ChunkSize, Allocator>::chunked_grid(chunked_grid&& other) noexcept
+    : m_chunks(std::move(other).m_chunks)
+    , m_directory(std::move(other).m_directory)
+{
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr chunked_grid<T, ChunkSize, Allocator>::chunked_grid(chunked_grid&& other, Allocator const& alloc)
+    : m_chunks(std::move(other).m_chunks, chunk_allocator(alloc))
+    , m_directory(std::move(other).m_directory, directory_allocator(alloc))
+{
+    // With unequal allocators the chunks are moved element-wise and other keeps them.
+    other.m_chunks.clear();
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr chunked_grid<T, ChunkSize, Allocator>::chunked_grid(Allocator const& alloc)
+    : m_chunks(chunk_allocator(alloc))
+    , m_directory(directory_allocator(alloc))
+{
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+constexpr chunked_grid<T, ChunkSize, Allocator>::chunked_grid(InputIt first, Sentinel last, Allocator const& alloc)
+    : chunked_grid(alloc)
+{
+    for (auto&& iter = first; iter != last; ++iter)
+        (*this)[iter->first] = iter->second;
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr chunked_grid<T, ChunkSize, Allocator>::chunked_grid(std::initializer_list<value_type> init,
+                                                            Allocator const&                  alloc)
+    : chunked_grid(alloc)
+{
+    for (auto const& [key, value] : init)
+        (*this)[key] = value;
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::operator=(chunked_grid&& other) noexcept(
+    std::is_nothrow_move_assignable_v<std::vector<T, Allocator>>) -> chunked_grid&
+{
+    if (this != &other)
+    {
+        // The directory leaves itself empty, but chunks moved element-wise between unequal allocators stay in other.
+        m_chunks    = std::move(other).m_chunks;
+        m_directory = std::move(other).m_directory;
+        other.m_chunks.clear();
+    }
+    return *this;
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::operator[](key_type const& key) -> T&
+{
+    return m_chunks[allocate_chunk(key)].values[local_index(key)];
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::operator[](key_type const& key) const -> T const&
+{
+    auto const chunk = find_chunk(key);
+    assert(chunk != m_chunks.size());
+    return m_chunks[chunk].values[local_index(key)];
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::at(key_type const& key) -> T&
+{
+    auto const chunk = find_chunk(key);
+    if (chunk == m_chunks.size())
+        throw std::out_of_range("chunked_grid::at");
+    return m_chunks[chunk].values[local_index(key)];
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::at(key_type const& key) const -> T const&
+{
+    auto const chunk = find_chunk(key);
+    if (chunk == m_chunks.size())
+        throw std::out_of_range("chunked_grid::at");
+    return m_chunks[chunk].values[local_index(key)];
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::begin() noexcept -> iterator
+{
+    return iterator(this, 0, 0);
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::begin() const noexcept -> const_iterator
+{
+    return const_iterator(this, 0, 0);
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::cbegin() const noexcept -> const_iterator
+{
+    return const_iterator(this, 0, 0);
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::end() noexcept -> iterator
+{
+    return iterator(this, m_chunks.size(), 0);
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::end() const noexcept -> const_iterator
+{
+    return const_iterator(this, m_chunks.size(), 0);
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::cend() const noexcept -> const_iterator
+{
+    return const_iterator(this, m_chunks.size(), 0);
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::rbegin() noexcept -> reverse_iterator
+{
+    return reverse_iterator(end());
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::rbegin() const noexcept -> const_reverse_iterator
+{
+    return const_reverse_iterator(cend());
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::crbegin() const noexcept -> const_reverse_iterator
+{
+    return const_reverse_iterator(cend());
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::rend() noexcept -> reverse_iterator
+{
+    return reverse_iterator(begin());
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::rend() const noexcept -> const_reverse_iterator
+{
+    return const_reverse_iterator(cbegin());
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::crend() const noexcept -> const_reverse_iterator
+{
+    return const_reverse_iterator(cbegin());
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::empty() const noexcept -> bool
+{
+    return m_chunks.empty();
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::size() const noexcept -> size_type
+{
+    return m_chunks.size() * chunk_volume;
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::max_size() const noexcept -> size_type
+{
+    return std::min(m_chunks.max_size(), std::numeric_limits<size_type>::max() / chunk_volume) * chunk_volume;
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::chunk_count() const noexcept -> size_type
+{
+    return m_chunks.size();
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr void chunked_grid<T, ChunkSize, Allocator>::reserve_chunks(size_type count)
+{
+    m_chunks.reserve(count);
+    m_directory.reserve(count);
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr void chunked_grid<T, ChunkSize, Allocator>::clear() noexcept
+{
+    m_chunks.clear();
+    m_directory.clear();
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr void chunked_grid<T, ChunkSize, Allocator>::swap(chunked_grid& other) noexcept
+{
+    m_chunks.swap(other.m_chunks);
+    m_directory.swap(other.m_directory);
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::find(key_type const& key) -> iterator
+{
+    auto const chunk = find_chunk(key);
+    return chunk == m_chunks.size() ? end() : iterator(this, chunk, local_index(key));
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::find(key_type const& key) const -> const_iterator
+{
+    auto const chunk = find_chunk(key);
+    return chunk == m_chunks.size() ? end() : const_iterator(this, chunk, local_index(key));
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::count(key_type const& key) const -> size_type
+{
+    return contains(key);
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::contains(key_type const& key) const -> bool
+{
+    return find_chunk(key) != m_chunks.size();
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::get_allocator() const noexcept -> allocator_type
+{
+    return allocator_type(m_chunks.get_allocator());
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::chunk_origin(key_type const& key) noexcept -> key_type
+{
+    return key_type{q_coordinate<int>(key.q().value() & ~s_local_mask),
+                    r_coordinate<int>(key.r().value() & ~s_local_mask)};
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::chunk_key(key_type const& key) noexcept -> key_type
+{
+    // Arithmetic right shift rounds towards negative infinity, so negative coordinates land in the correct chunk.
+    return key_type{q_coordinate<int>(key.q().value() >> s_chunk_shift),
+                    r_coordinate<int>(key.r().value() >> s_chunk_shift)};
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::local_index(key_type const& key) noexcept -> size_type
+{
+    return static_cast<size_type>(key.q().value() & s_local_mask) * chunk_size
+           + static_cast<size_type>(key.r().value() & s_local_mask);
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::chunk_key_at(key_type const& origin,
+                                                                  size_type       index) noexcept -> key_type
+{
+    return key_type{q_coordinate<int>(origin.q().value() + static_cast<int>(index / chunk_size)),
+                    r_coordinate<int>(origin.r().value() + static_cast<int>(index % chunk_size))};
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::find_chunk(key_type const& key) const -> size_type
+{
+    auto const iter = m_directory.find(chunk_key(key));
+    return iter == m_directory.end() ? m_chunks.size() : (*iter).second;
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr auto chunked_grid<T, ChunkSize, Allocator>::allocate_chunk(key_type const& key) -> size_type
+{
+    if (auto const index = find_chunk(key); index != m_chunks.size())
+        return index;
+    m_chunks.push_back(chunk{chunk_origin(key), std::vector<T, Allocator>(chunk_volume, get_allocator())});
+    try
+    {
+        m_directory[chunk_key(key)] = m_chunks.size() - 1;
+    }
+    catch (...)
+    {
+        // A chunk missing from the directory would still be iterated, so it must not be kept.
+        m_chunks.pop_back();
+        throw;
+    }
+    return m_chunks.size() - 1;
+}
+template<typename T, std::size_t ChunkSize, class Allocator>
+    requires(std::has_single_bit(ChunkSize))
+constexpr void swap(chunked_grid<T, ChunkSize, Allocator>& lhs, chunked_grid<T, ChunkSize, Allocator>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace hex
+
+#endif // HEX_CHUNKED_GRID_HPP
@@ -0,0 +1,119 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef HEX_DETAIL_CHUNKED_GRID_ITERATOR_HPP
+#define HEX_DETAIL_CHUNKED_GRID_ITERATOR_HPP
+
+#include <iterator>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace hex::detail
+{
+template<class Grid, bool Const>
+class chunked_grid_iterator
+{
+  public:
+    using value_type        = typename Grid::value_type;
+    using reference         = std::conditional_t<Const, typename Grid::const_reference, typename Grid::reference>;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_concept  = std::bidirectional_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+
+    constexpr chunked_grid_iterator() = default;
+
+    template<bool WasConst>
+        requires(Const && !WasConst)
+    constexpr chunked_grid_iterator(chunked_grid_iterator<Grid, WasConst> const& rhs)
+        : m_grid(rhs.m_grid)
+        , m_chunk(rhs.m_chunk)
+        , m_index(rhs.m_index)
+    {
+    }
+
+    constexpr auto operator++() noexcept -> chunked_grid_iterator&
+    {
+        if (++m_index == Grid::chunk_volume)
+        {
+            ++m_chunk;
+            m_index = 0;
+        }
+        return *this;
+    }
+    constexpr auto operator++(int) noexcept -> chunked_grid_iterator
+    {
+        auto cp = *this;
+        ++(*this);
+        return cp;
+    }
+
+    constexpr auto operator--() noexcept -> chunked_grid_iterator&
+    {
+        if (m_index == 0)
+        {
+            --m_chunk;
+            m_index = Grid::chunk_volume;
+        }
+        --m_index;
+        return *this;
+    }
+    constexpr auto operator--(int) noexcept -> chunked_grid_iterator
+    {
+        auto cp = *this;
+        --(*this);
+        return cp;
+    }
+
+    constexpr auto operator*() const noexcept -> reference
+    {
+        auto&& chunk = m_grid->m_chunks[m_chunk];
+        return {Grid::chunk_key_at(chunk.origin, m_index), chunk.values[m_index]};
+    }
+
+    constexpr auto operator==(chunked_grid_iterator const& other) const -> bool
+    {
+        return !m_grid || !other.m_grid
+               || (m_grid == other.m_grid && m_chunk == other.m_chunk && m_index == other.m_index);
+    }
+
+  private:
+    using GridPtr = std::conditional_t<Const, Grid const*, Grid*>;
+
+    GridPtr     m_grid  = nullptr;
+    std::size_t m_chunk = 0;
+    std::size_t m_index = 0;
+
+    constexpr chunked_grid_iterator(GridPtr grid, std::size_t chunk, std::size_t index)
+        : m_grid(grid)
+        , m_chunk(chunk)
+        , m_index(index)
+    {
+    }
+
+    friend Grid;
+    friend chunked_grid_iterator<Grid, !Const>;
+};
+} // namespace hex::detail
+
+#endif // HEX_DETAIL_CHUNKED_GRID_ITERATOR_HPP
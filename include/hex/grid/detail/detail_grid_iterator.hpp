@@ -25,6 +25,7 @@
 #ifndef HEX_DETAIL_GRID_ITERATOR_HPP
 #define HEX_DETAIL_GRID_ITERATOR_HPP
 
+#include <compare>
 #include <iterator>
 #include <ranges>
 #include <type_traits>
@@ -33,14 +34,21 @@
 
 namespace hex::detail
 {
+// Iterates a grid in the order of its shape. Besides the shape iterator, it carries the linear index of the current
+// element, so dereferencing reads the grid's storage directly instead of looking the key up in the shape. Models
+// std::random_access_iterator if the shape's iterator does, otherwise std::bidirectional_iterator.
 template<class Grid, bool Const>
 class grid_iterator
 {
+    using BaseIter = std::ranges::const_iterator_t<typename Grid::shape_type>;
+
   public:
     using value_type        = typename Grid::value_type;
     using reference         = std::conditional_t<Const, typename Grid::const_reference, typename Grid::reference>;
     using difference_type   = std::ptrdiff_t;
-    using iterator_concept  = std::bidirectional_iterator_tag;
+    using iterator_concept  = std::conditional_t<std::random_access_iterator<BaseIter>,
+                                                 std::random_access_iterator_tag,
+                                                 std::bidirectional_iterator_tag>;
     using iterator_category = std::input_iterator_tag;
 
     constexpr grid_iterator() = default;
@@ -50,12 +58,14 @@ class grid_iterator
     constexpr grid_iterator(grid_iterator<Grid, WasConst> const& rhs)
         : m_grid(rhs.m_grid)
         , m_iter(rhs.m_iter)
+        , m_index(rhs.m_index)
     {
     }
 
     constexpr auto operator++() noexcept -> grid_iterator&
     {
         ++m_iter;
+        ++m_index;
         return *this;
     }
     constexpr auto operator++(int) noexcept -> grid_iterator
@@ -68,6 +78,7 @@ class grid_iterator
     constexpr auto operator--() noexcept -> grid_iterator&
     {
         --m_iter;
+        --m_index;
         return *this;
     }
     constexpr auto operator--(int) noexcept -> grid_iterator
@@ -77,23 +88,77 @@ class grid_iterator
         return cp;
     }
 
-    constexpr auto operator*() const noexcept -> reference { return {*m_iter, (*m_grid)[*m_iter]}; }
+    constexpr auto operator+=(difference_type n) noexcept -> grid_iterator&
+        requires std::random_access_iterator<BaseIter>
+    {
+        m_iter += static_cast<std::iter_difference_t<BaseIter>>(n);
+        m_index = static_cast<std::size_t>(static_cast<difference_type>(m_index) + n);
+        return *this;
+    }
+    constexpr auto operator-=(difference_type n) noexcept -> grid_iterator&
+        requires std::random_access_iterator<BaseIter>
+    {
+        return *this += -n;
+    }
+
+    [[nodiscard]] constexpr auto operator[](difference_type n) const noexcept -> reference
+        requires std::random_access_iterator<BaseIter>
+    {
+        return *(*this + n);
+    }
+
+    [[nodiscard]] constexpr auto operator*() const noexcept -> reference
+    {
+        if constexpr (requires { m_grid->data(); })
+            return {*m_iter, m_grid->data()[m_index]};
+        else
+            return {*m_iter, m_grid->element(m_index)};
+    }
 
     constexpr auto operator==(grid_iterator const& other) const -> bool
     {
-        return !m_grid || !other.m_grid || (m_grid == other.m_grid && m_iter == other.m_iter);
+        return !m_grid || !other.m_grid || (m_grid == other.m_grid && m_index == other.m_index);
+    }
+
+    constexpr auto operator<=>(grid_iterator const& other) const noexcept -> std::strong_ordering
+        requires std::random_access_iterator<BaseIter>
+    {
+        return m_index <=> other.m_index;
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(grid_iterator iter, difference_type n) noexcept -> grid_iterator
+        requires std::random_access_iterator<BaseIter>
+    {
+        return iter += n;
+    }
+    [[nodiscard]] friend constexpr auto operator+(difference_type n, grid_iterator iter) noexcept -> grid_iterator
+        requires std::random_access_iterator<BaseIter>
+    {
+        return iter += n;
+    }
+    [[nodiscard]] friend constexpr auto operator-(grid_iterator iter, difference_type n) noexcept -> grid_iterator
+        requires std::random_access_iterator<BaseIter>
+    {
+        return iter -= n;
+    }
+    [[nodiscard]] friend constexpr auto operator-(grid_iterator const& lhs,
+                                                  grid_iterator const& rhs) noexcept -> difference_type
+        requires std::random_access_iterator<BaseIter>
+    {
+        return static_cast<difference_type>(lhs.m_index) - static_cast<difference_type>(rhs.m_index);
     }
 
   private:
-    using GridPtr  = std::conditional_t<Const, Grid const*, Grid*>;
-    using BaseIter = std::ranges::const_iterator_t<typename Grid::shape_type>;
+    using GridPtr = std::conditional_t<Const, Grid const*, Grid*>;
 
-    GridPtr  m_grid = nullptr;
-    BaseIter m_iter;
+    GridPtr     m_grid = nullptr;
+    BaseIter    m_iter;
+    std::size_t m_index = 0;
 
-    constexpr grid_iterator(GridPtr grid, std::ranges::const_iterator_t<typename Grid::shape_type> iter)
+    constexpr grid_iterator(GridPtr grid, BaseIter iter, std::size_t index)
         : m_grid(grid)
         , m_iter(iter)
+        , m_index(index)
     {
     }
 
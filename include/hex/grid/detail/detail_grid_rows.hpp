@@ -0,0 +1,58 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_DETAIL_GRID_ROWS_HPP
+#define HEX_DETAIL_GRID_ROWS_HPP
+
+#include <concepts>
+#include <ranges>
+#include <span>
+
+#include <cstddef>
+
+namespace hex::detail
+{
+// Matches shapes providing a rows() view of row_spans.
+template<class Shape>
+concept shape_with_rows = requires(Shape const& shape) {
+    { shape.rows() } -> std::ranges::random_access_range;
+    { (*std::ranges::begin(shape.rows())).offset } -> std::convertible_to<std::size_t>;
+    { (*std::ranges::begin(shape.rows())).size } -> std::convertible_to<std::size_t>;
+};
+
+// Maps a row_span of a grid's shape to the span of the grid's values in that row.
+template<typename T>
+struct row_values
+{
+    T* data; // NOLINT(misc-non-private-member-variables-in-classes)
+
+    template<typename Row>
+    constexpr auto operator()(Row const& row) const noexcept -> std::span<T>
+    {
+        return std::span<T>(data + row.offset, row.size);
+    }
+};
+} // namespace hex::detail
+
+#endif // HEX_DETAIL_GRID_ROWS_HPP
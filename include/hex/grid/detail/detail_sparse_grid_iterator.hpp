@@ -0,0 +1,109 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef HEX_DETAIL_SPARSE_GRID_ITERATOR_HPP
+#define HEX_DETAIL_SPARSE_GRID_ITERATOR_HPP
+
+#include <iterator>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace hex::detail
+{
+template<class Grid, bool Const>
+class sparse_grid_iterator
+{
+  public:
+    using value_type        = typename Grid::value_type;
+    using reference         = std::conditional_t<Const, typename Grid::const_reference, typename Grid::reference>;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_concept  = std::bidirectional_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+
+    constexpr sparse_grid_iterator() = default;
+
+    template<bool WasConst>
+        requires(Const && !WasConst)
+    constexpr sparse_grid_iterator(sparse_grid_iterator<Grid, WasConst> const& rhs)
+        : m_grid(rhs.m_grid)
+        , m_slot(rhs.m_slot)
+    {
+    }
+
+    constexpr auto operator++() noexcept -> sparse_grid_iterator&
+    {
+        m_slot = m_grid->next_occupied(m_slot + 1);
+        return *this;
+    }
+    constexpr auto operator++(int) noexcept -> sparse_grid_iterator
+    {
+        auto cp = *this;
+        ++(*this);
+        return cp;
+    }
+
+    constexpr auto operator--() noexcept -> sparse_grid_iterator&
+    {
+        m_slot = m_grid->prev_occupied(m_slot);
+        return *this;
+    }
+    constexpr auto operator--(int) noexcept -> sparse_grid_iterator
+    {
+        auto cp = *this;
+        --(*this);
+        return cp;
+    }
+
+    constexpr auto operator*() const noexcept -> reference
+    {
+        return {m_grid->key_at(m_slot), m_grid->m_values[m_slot]};
+    }
+
+    constexpr auto operator==(sparse_grid_iterator const& other) const -> bool
+    {
+        if (!m_grid || !other.m_grid)
+            return at_end() && other.at_end();
+        return m_grid == other.m_grid && m_slot == other.m_slot;
+    }
+
+  private:
+    using GridPtr = std::conditional_t<Const, Grid const*, Grid*>;
+
+    GridPtr     m_grid = nullptr;
+    std::size_t m_slot = 0;
+
+    [[nodiscard]] constexpr auto at_end() const noexcept -> bool { return !m_grid || m_slot == m_grid->slot_count(); }
+
+    constexpr sparse_grid_iterator(GridPtr grid, std::size_t slot)
+        : m_grid(grid)
+        , m_slot(slot)
+    {
+    }
+
+    friend Grid;
+    friend sparse_grid_iterator<Grid, !Const>;
+};
+} // namespace hex::detail
+
+#endif // HEX_DETAIL_SPARSE_GRID_ITERATOR_HPP
@@ -26,6 +26,7 @@
 #define HEX_GRID_HPP
 
 #include "hex/grid/detail/detail_grid_iterator.hpp"
+#include "hex/grid/detail/detail_grid_rows.hpp"
 
 #include <algorithm>
 #include <concepts>
@@ -33,6 +34,7 @@
 #include <iterator>
 #include <memory>
 #include <ranges>
+#include <span>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -41,7 +43,8 @@
 
 namespace hex
 {
-// Matches types usable as a shape for hex::grid
+// Matches types usable as a shape for hex::grid. Semantic requirement: the index t[v] of every element v equals the
+// position of v in the range.
 template<class T>
 concept grid_shape = std::ranges::sized_range<T> && std::ranges::common_range<T> && std::ranges::bidirectional_range<T>
                      && requires(T t, std::ranges::range_value_t<T> v) { // clang-format off: requires on single line
@@ -50,7 +53,8 @@ concept grid_shape = std::ranges::sized_range<T> && std::ranges::common_range<T>
 
 // A fixed-size associative container mapping hex positions to user-defined data. All storage is contiguous, and
 // allocations are only made on construction and copy.
-// This type models std::ranges::sized_range, std::ranges::bidirectional_range, std::ranges::common_range.
+// This type models std::ranges::sized_range, std::ranges::bidirectional_range, std::ranges::common_range, and
+// std::ranges::random_access_range if Shape does.
 template<typename T, grid_shape Shape, class Allocator = std::allocator<T>>
 class grid
 {
@@ -160,6 +164,23 @@ class grid
     // Returns size().
     [[nodiscard]] constexpr auto max_size() const noexcept -> size_type;
 
+    // Returns the shape of this grid.
+    [[nodiscard]] constexpr auto shape() const noexcept -> Shape const&;
+
+    // Returns pointer to the underlying storage. The value of a key is stored at data()[shape()[key]].
+    [[nodiscard]] constexpr auto data() noexcept -> T*;
+    // Returns pointer to the underlying storage. The value of a key is stored at data()[shape()[key]].
+    [[nodiscard]] constexpr auto data() const noexcept -> T const*;
+
+    // Returns a random-access view with one std::span<T> per row of shape().rows(), holding the values of that row.
+    // Only available if Shape provides rows().
+    [[nodiscard]] constexpr auto rows() noexcept
+        requires detail::shape_with_rows<Shape>;
+    // Returns a random-access view with one std::span<T const> per row of shape().rows(), holding the values of that
+    // row. Only available if Shape provides rows().
+    [[nodiscard]] constexpr auto rows() const noexcept
+        requires detail::shape_with_rows<Shape>;
+
     constexpr void swap(grid& other) noexcept;
 
     // Returns an iterator to the given key, if found. Otherwise, returns end(). If Shape implements a find() function,
@@ -295,32 +316,32 @@ constexpr auto grid<T, Shape, Allocator>::at(key_type const& key) const -> T con
 template<typename T, grid_shape Shape, class Allocator>
 constexpr auto grid<T, Shape, Allocator>::begin() noexcept -> iterator
 {
-    return iterator(this, std::ranges::begin(m_shape));
+    return iterator(this, std::ranges::begin(m_shape), 0);
 }
 template<typename T, grid_shape Shape, class Allocator>
 constexpr auto grid<T, Shape, Allocator>::begin() const noexcept -> const_iterator
 {
-    return const_iterator(this, std::ranges::cbegin(m_shape));
+    return const_iterator(this, std::ranges::cbegin(m_shape), 0);
 }
 template<typename T, grid_shape Shape, class Allocator>
 constexpr auto grid<T, Shape, Allocator>::cbegin() const noexcept -> const_iterator
 {
-    return const_iterator(this, std::ranges::cbegin(m_shape));
+    return const_iterator(this, std::ranges::cbegin(m_shape), 0);
 }
 template<typename T, grid_shape Shape, class Allocator>
 constexpr auto grid<T, Shape, Allocator>::end() noexcept -> iterator
 {
-    return iterator(this, std::ranges::end(m_shape));
+    return iterator(this, std::ranges::end(m_shape), size());
 }
 template<typename T, grid_shape Shape, class Allocator>
 constexpr auto grid<T, Shape, Allocator>::end() const noexcept -> const_iterator
 {
-    return const_iterator(this, std::ranges::cend(m_shape));
+    return const_iterator(this, std::ranges::cend(m_shape), size());
 }
 template<typename T, grid_shape Shape, class Allocator>
 constexpr auto grid<T, Shape, Allocator>::cend() const noexcept -> const_iterator
 {
-    return const_iterator(this, std::ranges::cend(m_shape));
+    return const_iterator(this, std::ranges::cend(m_shape), size());
 }
 template<typename T, grid_shape Shape, class Allocator>
 constexpr auto grid<T, Shape, Allocator>::rbegin() noexcept -> reverse_iterator
@@ -368,6 +389,33 @@ constexpr auto grid<T, Shape, Allocator>::max_size() const noexcept -> size_type
     return size();
 }
 template<typename T, grid_shape Shape, class Allocator>
+constexpr auto grid<T, Shape, Allocator>::shape() const noexcept -> Shape const&
+{
+    return m_shape;
+}
+template<typename T, grid_shape Shape, class Allocator>
+constexpr auto grid<T, Shape, Allocator>::data() noexcept -> T*
+{
+    return m_data.data();
+}
+template<typename T, grid_shape Shape, class Allocator>
+constexpr auto grid<T, Shape, Allocator>::data() const noexcept -> T const*
+{
+    return m_data.data();
+}
+template<typename T, grid_shape Shape, class Allocator>
+constexpr auto grid<T, Shape, Allocator>::rows() noexcept
+    requires detail::shape_with_rows<Shape>
+{
+    return std::views::transform(m_shape.rows(), detail::row_values<T>{m_data.data()});
+}
+template<typename T, grid_shape Shape, class Allocator>
+constexpr auto grid<T, Shape, Allocator>::rows() const noexcept
+    requires detail::shape_with_rows<Shape>
+{
+    return std::views::transform(m_shape.rows(), detail::row_values<T const>{m_data.data()});
+}
+template<typename T, grid_shape Shape, class Allocator>
 constexpr void grid<T, Shape, Allocator>::swap(grid& other) noexcept
 {
     m_data.swap(other.m_data);
@@ -378,17 +426,31 @@ template<typename T, grid_shape Shape, class Allocator>
 constexpr auto grid<T, Shape, Allocator>::find(key_type const& key) -> iterator
 {
     if constexpr (requires(Shape s) { s.find(key); })
-        return iterator(this, m_shape.find(key));
+    {
+        auto const iter = m_shape.find(key);
+        return iterator(this, iter, iter == std::ranges::end(m_shape) ? size() : m_shape[key]);
+    }
     else
-        return iterator(this, std::ranges::find(m_shape, key));
+    {
+        auto const iter = std::ranges::find(m_shape, key);
+        auto const idx  = std::ranges::distance(std::ranges::begin(m_shape), iter);
+        return iterator(this, iter, static_cast<size_type>(idx));
+    }
 }
 template<typename T, grid_shape Shape, class Allocator>
 constexpr auto grid<T, Shape, Allocator>::find(key_type const& key) const -> const_iterator
 {
     if constexpr (requires(Shape s) { s.find(key); })
-        return const_iterator(this, m_shape.find(key));
+    {
+        auto const iter = m_shape.find(key);
+        return const_iterator(this, iter, iter == std::ranges::end(m_shape) ? size() : m_shape[key]);
+    }
     else
-        return const_iterator(this, std::ranges::find(m_shape, key));
+    {
+        auto const iter = std::ranges::find(m_shape, key);
+        auto const idx  = std::ranges::distance(std::ranges::begin(m_shape), iter);
+        return const_iterator(this, iter, static_cast<size_type>(idx));
+    }
 }
 template<typename T, grid_shape Shape, class Allocator>
 constexpr auto grid<T, Shape, Allocator>::count(key_type const& key) const -> size_type
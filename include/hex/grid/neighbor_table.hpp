@@ -0,0 +1,148 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef HEX_NEIGHBOR_TABLE_HPP
+#define HEX_NEIGHBOR_TABLE_HPP
+
+#include "hex/grid/grid.hpp"
+#include "hex/views/neighbors/neighbors_view.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hex
+{
+// A precomputed table of the 6 neighbor indices of every element of a grid_shape, so neighbor stencils over a grid
+// become plain indexed loads instead of repeated shape lookups. Row i holds the shape indices of the neighbors of the
+// element with shape index i, in the order of views::neighbors(); neighbors outside the shape are no_neighbor.
+template<std::unsigned_integral Index = std::uint32_t>
+class neighbor_table
+{
+  public:
+    using index_type     = Index;
+    using size_type      = std::size_t;
+    using row_type       = std::array<index_type, 6>; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    using const_iterator = typename std::vector<row_type>::const_iterator;
+
+    // Marks a neighbor outside of the shape.
+    static constexpr index_type no_neighbor = std::numeric_limits<index_type>::max();
+
+    // Initializes an empty table.
+    constexpr neighbor_table() = default;
+
+    // Builds the table for the given shape. Throws std::length_error if the shape has too many elements to be indexed
+    // by index_type. O(n) calls to the shape's contains() and operator[].
+    template<grid_shape Shape>
+    constexpr explicit neighbor_table(Shape const& shape);
+
+    // Returns the neighbor indices of the element with the given shape index. UB if index >= size().
+    [[nodiscard]] constexpr auto operator[](size_type index) const noexcept -> row_type const&;
+
+    // Returns the number of rows, i.e. the size of the shape the table was built for.
+    [[nodiscard]] constexpr auto size() const noexcept -> size_type;
+    // Returns true if the table has no rows, otherwise false.
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool;
+
+    // Returns a pointer to the first row. Rows are stored contiguously, in shape index order.
+    [[nodiscard]] constexpr auto data() const noexcept -> row_type const*;
+
+    [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator;
+    [[nodiscard]] constexpr auto end() const noexcept -> const_iterator;
+
+    friend constexpr auto operator==(neighbor_table const& lhs, neighbor_table const& rhs) -> bool = default;
+
+  private:
+    std::vector<row_type> m_rows;
+};
+
+// ------------------------------ implementation below ------------------------------
+
+template<std::unsigned_integral Index>
+template<grid_shape Shape>
+constexpr neighbor_table<Index>::neighbor_table(Shape const& shape)
+{
+    auto const size = static_cast<size_type>(std::ranges::size(shape));
+    if (size >= no_neighbor)
+        throw std::length_error("neighbor_table");
+
+    m_rows.resize(size);
+    auto const contains = [&shape](auto const& key)
+    {
+        if constexpr (requires { shape.contains(key); })
+            return shape.contains(key);
+        else
+            return std::ranges::contains(shape, key);
+    };
+    for (auto const& key : shape)
+    {
+        auto& row = m_rows[shape[key]];
+        std::ranges::transform(views::neighbors(key),
+                               row.begin(),
+                               [&](auto const& neighbor)
+                               {
+                                   return contains(neighbor) ? static_cast<index_type>(shape[neighbor])
+                                                             : no_neighbor;
+                               });
+    }
+}
+template<std::unsigned_integral Index>
+constexpr auto neighbor_table<Index>::operator[](size_type index) const noexcept -> row_type const&
+{
+    return m_rows[index];
+}
+template<std::unsigned_integral Index>
+constexpr auto neighbor_table<Index>::size() const noexcept -> size_type
+{
+    return m_rows.size();
+}
+template<std::unsigned_integral Index>
+constexpr auto neighbor_table<Index>::empty() const noexcept -> bool
+{
+    return m_rows.empty();
+}
+template<std::unsigned_integral Index>
+constexpr auto neighbor_table<Index>::data() const noexcept -> row_type const*
+{
+    return m_rows.data();
+}
+template<std::unsigned_integral Index>
+constexpr auto neighbor_table<Index>::begin() const noexcept -> const_iterator
+{
+    return m_rows.begin();
+}
+template<std::unsigned_integral Index>
+constexpr auto neighbor_table<Index>::end() const noexcept -> const_iterator
+{
+    return m_rows.end();
+}
+} // namespace hex
+
+#endif // HEX_NEIGHBOR_TABLE_HPP
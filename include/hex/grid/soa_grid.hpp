@@ -0,0 +1,464 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef HEX_SOA_GRID_HPP
+#define HEX_SOA_GRID_HPP
+
+#include "hex/grid/detail/detail_grid_iterator.hpp"
+#include "hex/grid/grid.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace hex
+{
+// A fixed-size associative container mapping hex positions to several fields of user-defined data. Like grid, it is
+// indexed through a grid_shape, but every field is stored in its own contiguous array (struct of arrays), so a pass
+// touching a single field streams over exactly that field's memory. Element access yields a tuple of references to
+// all fields of one position; field<I>() exposes a whole field as a span, indexed like the shape. Fields must not be
+// bool, since every field needs contiguous, addressable storage.
+// This type models std::ranges::sized_range, std::ranges::bidirectional_range, std::ranges::common_range, and
+// std::ranges::random_access_range if Shape does.
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+class soa_grid
+{
+  public:
+    using shape_type             = Shape;
+    using key_type               = std::ranges::range_value_t<Shape>;
+    using mapped_type            = std::tuple<Fields...>;
+    using value_type             = std::pair<key_type const, mapped_type>;
+    using reference              = std::pair<std::ranges::range_const_reference_t<Shape>, std::tuple<Fields&...>>;
+    using const_reference        = std::pair<std::ranges::range_const_reference_t<Shape>, std::tuple<Fields const&...>>;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using iterator               = detail::grid_iterator<soa_grid, false>;
+    using const_iterator         = detail::grid_iterator<soa_grid, true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // The type of the I-th field.
+    template<std::size_t I>
+    using field_type = std::tuple_element_t<I, mapped_type>;
+
+    constexpr ~soa_grid() = default;
+
+    // Initializes the grid using a default-constructed shape, with all fields value-initialized.
+    constexpr soa_grid();
+
+    constexpr soa_grid(soa_grid const&) = default;
+    constexpr soa_grid(soa_grid&&)      = default;
+
+    // Initializes the grid with the given shape, with all fields value-initialized.
+    constexpr explicit soa_grid(Shape const& shape);
+
+    // Initializes the grid with the given shape, setting all values from the given range; keys contained in the grid
+    // not mentioned in the range are value-initialized. The range must not contain any keys outside the given shape.
+    template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    constexpr soa_grid(InputIt first, Sentinel last, Shape const& shape = Shape());
+
+    // Initializes the grid with the given shape, setting all values from the given initializer_list; keys contained in
+    // the grid not mentioned in the list are value-initialized. The list must not contain any keys outside the given
+    // shape.
+    constexpr soa_grid(std::initializer_list<value_type> init, Shape const& shape = Shape());
+
+    constexpr auto operator=(soa_grid const&) -> soa_grid& = default;
+    constexpr auto operator=(soa_grid&&) -> soa_grid&      = default;
+
+    // Returns references to all fields associated with the given key. UB if key outside of shape.
+    constexpr auto operator[](key_type const& key) -> std::tuple<Fields&...>;
+    // Returns const references to all fields associated with the given key. UB if key outside of shape.
+    constexpr auto operator[](key_type const& key) const -> std::tuple<Fields const&...>;
+
+    // Returns references to all fields associated with the given key. Throws std::out_of_range if key outside of
+    // shape. Has the same performance characteristics as contains().
+    constexpr auto at(key_type const& key) -> std::tuple<Fields&...>;
+    // Returns const references to all fields associated with the given key. Throws std::out_of_range if key outside of
+    // shape. Has the same performance characteristics as contains().
+    constexpr auto at(key_type const& key) const -> std::tuple<Fields const&...>;
+
+    // Returns references to all fields at the given linear index, as returned by index_of(). UB if index >= size().
+    constexpr auto element(size_type index) noexcept -> std::tuple<Fields&...>;
+    // Returns const references to all fields at the given linear index, as returned by index_of(). UB if index >=
+    // size().
+    constexpr auto element(size_type index) const noexcept -> std::tuple<Fields const&...>;
+
+    // Returns the I-th field of all positions as one contiguous span, indexed like the shape.
+    template<std::size_t I>
+        requires(I < sizeof...(Fields))
+    constexpr auto field() noexcept -> std::span<field_type<I>>;
+    // Returns the I-th field of all positions as one contiguous span, indexed like the shape.
+    template<std::size_t I>
+        requires(I < sizeof...(Fields))
+    constexpr auto field() const noexcept -> std::span<field_type<I> const>;
+
+    // Returns reference to the I-th field associated with the given key. UB if key outside of shape.
+    template<std::size_t I>
+        requires(I < sizeof...(Fields))
+    constexpr auto field(key_type const& key) -> field_type<I>&;
+    // Returns const reference to the I-th field associated with the given key. UB if key outside of shape.
+    template<std::size_t I>
+        requires(I < sizeof...(Fields))
+    constexpr auto field(key_type const& key) const -> field_type<I> const&;
+
+    // Returns the linear index of the given key into the field spans. UB if key outside of shape.
+    [[nodiscard]] constexpr auto index_of(key_type const& key) const -> size_type;
+
+    // Returns the shape of this grid.
+    [[nodiscard]] constexpr auto shape() const noexcept -> Shape const&;
+
+    constexpr auto begin() noexcept -> iterator;
+    constexpr auto begin() const noexcept -> const_iterator;
+    constexpr auto cbegin() const noexcept -> const_iterator;
+
+    constexpr auto end() noexcept -> iterator;
+    constexpr auto end() const noexcept -> const_iterator;
+    constexpr auto cend() const noexcept -> const_iterator;
+
+    constexpr auto rbegin() noexcept -> reverse_iterator;
+    constexpr auto rbegin() const noexcept -> const_reverse_iterator;
+    constexpr auto crbegin() const noexcept -> const_reverse_iterator;
+
+    constexpr auto rend() noexcept -> reverse_iterator;
+    constexpr auto rend() const noexcept -> const_reverse_iterator;
+    constexpr auto crend() const noexcept -> const_reverse_iterator;
+
+    // Returns true if shape has no elements, otherwise false.
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool;
+    // Returns number of keys in the grid.
+    [[nodiscard]] constexpr auto size() const noexcept -> size_type;
+    // Returns size().
+    [[nodiscard]] constexpr auto max_size() const noexcept -> size_type;
+
+    constexpr void swap(soa_grid& other) noexcept;
+
+    // Returns an iterator to the given key, if found. Otherwise, returns end(). Has the same performance
+    // characteristics as grid::find().
+    constexpr auto find(key_type const& key) -> iterator;
+    // Returns an iterator to the given key, if found. Otherwise, returns end(). Has the same performance
+    // characteristics as grid::find().
+    constexpr auto find(key_type const& key) const -> const_iterator;
+
+    // Returns 1 if the key is in the grid, otherwise 0. Has the same performance characteristics as contains().
+    constexpr auto count(key_type const& key) const -> size_type;
+
+    // Returns true if the given key is in the grid, otherwise false. Has the same performance characteristics as
+    // grid::contains().
+    constexpr auto contains(key_type const& key) const -> bool;
+
+    friend constexpr auto operator==(soa_grid const& lhs, soa_grid const& rhs) -> bool = default;
+
+    template<grid_shape S, typename... F>
+    friend constexpr void swap(soa_grid<S, F...>& lhs, soa_grid<S, F...>& rhs) noexcept;
+
+  private:
+    // std::vector<bool> packs its values into bits, so it can neither hand out bool& nor back a span.
+    static_assert((!std::same_as<std::remove_cv_t<Fields>, bool> && ...),
+                  "soa_grid does not support bool fields; use an integral type such as std::uint8_t instead");
+
+    std::tuple<std::vector<Fields>...> m_fields;
+    Shape                              m_shape;
+};
+
+// ------------------------------ implementation below ------------------------------
+
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr soa_grid<Shape, Fields...>::soa_grid()
+    : soa_grid(Shape())
+{
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr soa_grid<Shape, Fields...>::soa_grid(Shape const& shape)
+    : m_fields(std::vector<Fields>(shape.size())...)
+    , m_shape(shape)
+{
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+constexpr soa_grid<Shape, Fields...>::soa_grid(InputIt first, Sentinel last, Shape const& shape)
+    : soa_grid(shape)
+{
+    for (auto&& iter = first; iter != last; ++iter)
+        (*this)[iter->first] = iter->second;
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr soa_grid<Shape, Fields...>::soa_grid(std::initializer_list<value_type> init, Shape const& shape)
+    : soa_grid(init.begin(), init.end(), shape)
+{
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::operator[](key_type const& key) -> std::tuple<Fields&...>
+{
+    return element(m_shape[key]);
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::operator[](key_type const& key) const -> std::tuple<Fields const&...>
+{
+    return element(m_shape[key]);
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::at(key_type const& key) -> std::tuple<Fields&...>
+{
+    if (!contains(key))
+        throw std::out_of_range("soa_grid::at");
+    return (*this)[key];
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::at(key_type const& key) const -> std::tuple<Fields const&...>
+{
+    if (!contains(key))
+        throw std::out_of_range("soa_grid::at");
+    return (*this)[key];
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::element(size_type index) noexcept -> std::tuple<Fields&...>
+{
+    return std::apply([index](auto&... field) { return std::tuple<Fields&...>(field[index]...); }, m_fields);
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::element(size_type index) const noexcept -> std::tuple<Fields const&...>
+{
+    return std::apply([index](auto const&... field) { return std::tuple<Fields const&...>(field[index]...); },
+                      m_fields);
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+template<std::size_t I>
+    requires(I < sizeof...(Fields))
+constexpr auto soa_grid<Shape, Fields...>::field() noexcept -> std::span<field_type<I>>
+{
+    return std::get<I>(m_fields);
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+template<std::size_t I>
+    requires(I < sizeof...(Fields))
+constexpr auto soa_grid<Shape, Fields...>::field() const noexcept -> std::span<field_type<I> const>
+{
+    return std::get<I>(m_fields);
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+template<std::size_t I>
+    requires(I < sizeof...(Fields))
+constexpr auto soa_grid<Shape, Fields...>::field(key_type const& key) -> field_type<I>&
+{
+    return std::get<I>(m_fields)[m_shape[key]];
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+template<std::size_t I>
+    requires(I < sizeof...(Fields))
+constexpr auto soa_grid<Shape, Fields...>::field(key_type const& key) const -> field_type<I> const&
+{
+    return std::get<I>(m_fields)[m_shape[key]];
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::index_of(key_type const& key) const -> size_type
+{
+    return m_shape[key];
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::shape() const noexcept -> Shape const&
+{
+    return m_shape;
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::begin() noexcept -> iterator
+{
+    return iterator(this, std::ranges::begin(m_shape), 0);
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::begin() const noexcept -> const_iterator
+{
+    return const_iterator(this, std::ranges::cbegin(m_shape), 0);
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::cbegin() const noexcept -> const_iterator
+{
+    return const_iterator(this, std::ranges::cbegin(m_shape), 0);
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::end() noexcept -> iterator
+{
+    return iterator(this, std::ranges::end(m_shape), size());
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::end() const noexcept -> const_iterator
+{
+    return const_iterator(this, std::ranges::cend(m_shape), size());
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::cend() const noexcept -> const_iterator
+{
+    return const_iterator(this, std::ranges::cend(m_shape), size());
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::rbegin() noexcept -> reverse_iterator
+{
+    return reverse_iterator(end());
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::rbegin() const noexcept -> const_reverse_iterator
+{
+    return const_reverse_iterator(cend());
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::crbegin() const noexcept -> const_reverse_iterator
+{
+    return const_reverse_iterator(cend());
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::rend() noexcept -> reverse_iterator
+{
+    return reverse_iterator(begin());
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::rend() const noexcept -> const_reverse_iterator
+{
+    return const_reverse_iterator(cbegin());
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::crend() const noexcept -> const_reverse_iterator
+{
+    return const_reverse_iterator(cbegin());
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::empty() const noexcept -> bool
+{
+    return size() == 0;
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::size() const noexcept -> size_type
+{
+    return std::get<0>(m_fields).size();
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::max_size() const noexcept -> size_type
+{
+    return size();
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr void soa_grid<Shape, Fields...>::swap(soa_grid& other) noexcept
+{
+    using std::swap;
+    swap(m_fields, other.m_fields);
+    swap(m_shape, other.m_shape);
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::find(key_type const& key) -> iterator
+{
+    if constexpr (requires(Shape s) { s.find(key); })
+    {
+        auto const iter = m_shape.find(key);
+        return iterator(this, iter, iter == std::ranges::end(m_shape) ? size() : m_shape[key]);
+    }
+    else
+    {
+        auto const iter = std::ranges::find(m_shape, key);
+        auto const idx  = std::ranges::distance(std::ranges::begin(m_shape), iter);
+        return iterator(this, iter, static_cast<size_type>(idx));
+    }
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::find(key_type const& key) const -> const_iterator
+{
+    if constexpr (requires(Shape s) { s.find(key); })
+    {
+        auto const iter = m_shape.find(key);
+        return const_iterator(this, iter, iter == std::ranges::end(m_shape) ? size() : m_shape[key]);
+    }
+    else
+    {
+        auto const iter = std::ranges::find(m_shape, key);
+        auto const idx  = std::ranges::distance(std::ranges::begin(m_shape), iter);
+        return const_iterator(this, iter, static_cast<size_type>(idx));
+    }
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::count(key_type const& key) const -> size_type
+{
+    return contains(key);
+}
+template<grid_shape Shape, typename... Fields>
+    requires(sizeof...(Fields) > 0)
+constexpr auto soa_grid<Shape, Fields...>::contains(key_type const& key) const -> bool
+{
+    if constexpr (requires(Shape s) { s.contains(key); })
+        return m_shape.contains(key);
+    else if constexpr (requires(Shape s) { s.find(key); })
+        return find(key) != end();
+    else
+        return std::ranges::contains(m_shape, key);
+}
+template<grid_shape Shape, typename... Fields>
+constexpr void swap(soa_grid<Shape, Fields...>& lhs, soa_grid<Shape, Fields...>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace hex
+
+#endif // HEX_SOA_GRID_HPP
@@ -0,0 +1,42 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_SPACE_FILLING_ORDER_HPP
+#define HEX_SPACE_FILLING_ORDER_HPP
+
+#include <cstdint>
+
+namespace hex
+{
+// Selects the curve along which space_filling_shape orders its positions.
+enum class space_filling_order : std::uint8_t
+{
+    // The Morton (Z-order) curve. Cheap to compute, but jumps between the quadrants of every level.
+    morton,
+    // The Hilbert curve. Consecutive positions are always adjacent, so ranges of indices cover compact areas.
+    hilbert,
+};
+}
+
+#endif // HEX_SPACE_FILLING_ORDER_HPP
@@ -0,0 +1,210 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_SPACE_FILLING_SHAPE_HPP
+#define HEX_SPACE_FILLING_SHAPE_HPP
+
+#include "hex/grid/grid.hpp"
+#include "hex/grid/space_filling_order.hpp"
+#include "hex/vector/space_filling_curve.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hex
+{
+// A grid shape holding the positions of another shape, ordered along a space-filling curve over the shape's bounding
+// box in (q, r). A grid of this shape stores its values in curve order, so that tiles close to each other on the map
+// are mostly close to each other in memory, in both directions. Kernels working on indices, such as those driven by a
+// neighbor_table, then touch fewer cache lines and pages than with the row order of most shapes.
+//
+// Converting a position to its index takes a lookup in a table of one std::uint32_t per tile of the bounding box.
+template<grid_shape Shape>
+class space_filling_shape
+{
+  public:
+    using key_type = std::ranges::range_value_t<Shape>;
+    using iterator = typename std::vector<key_type>::const_iterator;
+
+    // Orders the positions of shape along the given curve. Throws std::length_error if shape has more positions than
+    // std::uint32_t can index.
+    constexpr explicit space_filling_shape(Shape const&        shape,
+                                           space_filling_order order = space_filling_order::hilbert);
+
+    [[nodiscard]] constexpr auto operator==(space_filling_shape const& rhs) const -> bool = default;
+
+    [[nodiscard]] constexpr auto begin() const noexcept -> iterator;
+    [[nodiscard]] constexpr auto end() const noexcept -> iterator;
+
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t;
+
+    // Returns the curve the positions are ordered along.
+    [[nodiscard]] constexpr auto order() const noexcept -> space_filling_order;
+
+    // Returns true if the given position is in the shape, otherwise false. O(1).
+    [[nodiscard]] constexpr auto contains(key_type const& key) const noexcept -> bool;
+    // Returns an iterator to the given position if it is in the shape, otherwise end().
+    [[nodiscard]] constexpr auto find(key_type const& key) const noexcept -> iterator;
+
+    // Returns the position at the given index. UB if the index is out of range.
+    [[nodiscard]] constexpr auto operator[](std::size_t idx) const noexcept -> key_type const&;
+    // Returns the index of the given position. UB if the position is not in the shape.
+    [[nodiscard]] constexpr auto operator[](key_type const& key) const noexcept -> std::size_t;
+
+  private:
+    using coordinate_type = typename key_type::mapped_type;
+
+    static constexpr auto no_index = std::numeric_limits<std::uint32_t>::max();
+
+    // Returns the slot of the given position in m_index, or m_index.size() if it lies outside the bounding box.
+    [[nodiscard]] constexpr auto slot(key_type const& key) const noexcept -> std::size_t;
+
+    std::vector<key_type>      m_keys;
+    std::vector<std::uint32_t> m_index; // The index of every position of the bounding box, in rows of equal r.
+    coordinate_type            m_qmin   = 0;
+    coordinate_type            m_rmin   = 0;
+    std::size_t                m_width  = 0;
+    std::size_t                m_height = 0;
+    space_filling_order        m_order;
+};
+} // namespace hex
+
+// ------------------------------ implementation below ------------------------------
+
+template<hex::grid_shape Shape>
+constexpr hex::space_filling_shape<Shape>::space_filling_shape(Shape const& shape, space_filling_order order)
+    : m_keys(std::ranges::begin(shape), std::ranges::end(shape))
+    , m_order(order)
+{
+    if (m_keys.size() >= no_index)
+        throw std::length_error("shape is too large for a space_filling_shape");
+    if (m_keys.empty())
+        return;
+
+    auto const q_of         = [](key_type const& key) { return key.q().value(); };
+    auto const r_of         = [](key_type const& key) { return key.r().value(); };
+    auto const [qmin, qmax] = std::ranges::minmax(m_keys | std::views::transform(q_of));
+    auto const [rmin, rmax] = std::ranges::minmax(m_keys | std::views::transform(r_of));
+    m_qmin   = qmin;
+    m_rmin   = rmin;
+    m_width  = static_cast<std::size_t>(static_cast<std::int64_t>(qmax) - m_qmin) + 1;
+    m_height = static_cast<std::size_t>(static_cast<std::int64_t>(rmax) - m_rmin) + 1;
+
+    // Curves run over the smallest power-of-two square covering the bounding box, anchored at its corner.
+    auto const bits = static_cast<unsigned>(std::bit_width(std::max(m_width, m_height) - 1));
+    auto const code = [&](key_type const& key) -> std::uint64_t
+    {
+        auto const x = static_cast<std::uint32_t>(static_cast<std::int64_t>(key.q().value()) - m_qmin);
+        auto const y = static_cast<std::uint32_t>(static_cast<std::int64_t>(key.r().value()) - m_rmin);
+        if (m_order == space_filling_order::morton)
+            return detail::spread_bits(x) | (detail::spread_bits(y) << 1U);
+        return detail::hilbert_index(x, y, bits);
+    };
+
+    std::vector<std::pair<std::uint64_t, key_type>> coded;
+    coded.reserve(m_keys.size());
+    for (auto const& key : m_keys)
+        coded.emplace_back(code(key), key);
+    std::ranges::sort(coded, {}, [](auto const& entry) { return entry.first; });
+
+    m_index.assign(m_width * m_height, no_index);
+    for (std::size_t i = 0; i < coded.size(); ++i)
+    {
+        m_keys[i]                      = coded[i].second;
+        m_index[slot(coded[i].second)] = static_cast<std::uint32_t>(i);
+    }
+}
+
+template<hex::grid_shape Shape>
+constexpr auto hex::space_filling_shape<Shape>::begin() const noexcept -> iterator
+{
+    return m_keys.begin();
+}
+
+template<hex::grid_shape Shape>
+constexpr auto hex::space_filling_shape<Shape>::end() const noexcept -> iterator
+{
+    return m_keys.end();
+}
+
+template<hex::grid_shape Shape>
+constexpr auto hex::space_filling_shape<Shape>::size() const noexcept -> std::size_t
+{
+    return m_keys.size();
+}
+
+template<hex::grid_shape Shape>
+constexpr auto hex::space_filling_shape<Shape>::order() const noexcept -> space_filling_order
+{
+    return m_order;
+}
+
+template<hex::grid_shape Shape>
+constexpr auto hex::space_filling_shape<Shape>::contains(key_type const& key) const noexcept -> bool
+{
+    auto const at = slot(key);
+    return at < m_index.size() && m_index[at] != no_index;
+}
+
+template<hex::grid_shape Shape>
+constexpr auto hex::space_filling_shape<Shape>::find(key_type const& key) const noexcept -> iterator
+{
+    if (!contains(key))
+        return end();
+    return begin() + static_cast<std::ptrdiff_t>((*this)[key]);
+}
+
+template<hex::grid_shape Shape>
+constexpr auto hex::space_filling_shape<Shape>::operator[](std::size_t idx) const noexcept -> key_type const&
+{
+    return m_keys[idx];
+}
+
+template<hex::grid_shape Shape>
+constexpr auto hex::space_filling_shape<Shape>::operator[](key_type const& key) const noexcept -> std::size_t
+{
+    return m_index[slot(key)];
+}
+
+template<hex::grid_shape Shape>
+constexpr auto hex::space_filling_shape<Shape>::slot(key_type const& key) const noexcept -> std::size_t
+{
+    auto const q = static_cast<std::int64_t>(key.q().value()) - m_qmin;
+    auto const r = static_cast<std::int64_t>(key.r().value()) - m_rmin;
+    if (q < 0 || r < 0 || std::cmp_greater_equal(q, m_width) || std::cmp_greater_equal(r, m_height))
+        return m_index.size();
+    return (static_cast<std::size_t>(r) * m_width) + static_cast<std::size_t>(q);
+}
+
+#endif // HEX_SPACE_FILLING_SHAPE_HPP
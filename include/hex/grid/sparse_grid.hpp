@@ -0,0 +1,652 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef HEX_SPARSE_GRID_HPP
+#define HEX_SPARSE_GRID_HPP
+
+#include "hex/detail/detail_hash.hpp"
+#include "hex/grid/detail/detail_sparse_grid_iterator.hpp"
+#include "hex/vector/coordinate.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace hex
+{
+// An unbounded associative container mapping hex positions to user-defined data. Unlike grid, no shape has to be known
+// up front; keys are inserted on demand. Storage is a flat open-addressing hash table (linear probing) keyed on the
+// packed (q, r) pair, with keys and values in two separate contiguous arrays. T must be default-constructible.
+// Iteration order is unspecified. Insertions may invalidate iterators and references; erasure may invalidate iterators
+// and references to other elements.
+// This type models std::ranges::sized_range, std::ranges::bidirectional_range, std::ranges::common_range.
+template<typename T, std::signed_integral Coord = int, class Allocator = std::allocator<T>>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+class sparse_grid
+{
+  public:
+    using allocator_type         = Allocator;
+    using key_type               = vector<Coord>;
+    using mapped_type            = T;
+    using value_type             = std::pair<key_type const, T>;
+    using reference              = std::pair<key_type const, mapped_type&>;
+    using const_reference        = std::pair<key_type const, mapped_type const&>;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using iterator               = detail::sparse_grid_iterator<sparse_grid, false>;
+    using const_iterator         = detail::sparse_grid_iterator<sparse_grid, true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    constexpr ~sparse_grid() = default;
+
+    // Initializes an empty grid. Does not allocate.
+    constexpr sparse_grid() = default;
+
+    constexpr sparse_grid(sparse_grid const&) = default;
+    constexpr sparse_grid(sparse_grid const& other, Allocator const& alloc);
+    // Leaves other empty.
+    constexpr sparse_grid(sparse_grid&& other) noexcept;
+    constexpr sparse_grid(sparse_grid&& other, Allocator const& alloc);
+
+    // Initializes an empty grid with the given allocator. Does not allocate.
+    constexpr explicit sparse_grid(Allocator const& alloc);
+
+    // Initializes an empty grid with room for at least count elements before the first rehash. Does not allocate if
+    // count is 0.
+    constexpr explicit sparse_grid(size_type count, Allocator const& alloc = Allocator());
+
+    // Initializes the grid with the given allocator, setting all values from the given range.
+    template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    constexpr sparse_grid(InputIt first, Sentinel last, Allocator const& alloc = Allocator());
+
+    // Initializes the grid with the given allocator, setting all values from the given initializer_list.
+    constexpr sparse_grid(std::initializer_list<value_type> init, Allocator const& alloc = Allocator());
+
+    constexpr auto operator=(sparse_grid const&) -> sparse_grid& = default;
+    // Leaves other empty.
+    constexpr auto operator=(sparse_grid&& other) noexcept(
+        std::is_nothrow_move_assignable_v<std::vector<mapped_type, Allocator>>) -> sparse_grid&;
+
+    // Returns reference to value associated with the given key, inserting a default-constructed value if the key is not
+    // contained yet.
+    constexpr auto operator[](key_type const& key) -> T&;
+    // Returns const reference to value associated with the given key. UB if key not contained.
+    constexpr auto operator[](key_type const& key) const -> T const&;
+
+    // Returns reference to value associated with the given key. Throws std::out_of_range if key not contained.
+    constexpr auto at(key_type const& key) -> T&;
+    // Returns const reference to value associated with the given key. Throws std::out_of_range if key not contained.
+    constexpr auto at(key_type const& key) const -> T const&;
+
+    constexpr auto begin() noexcept -> iterator;
+    constexpr auto begin() const noexcept -> const_iterator;
+    constexpr auto cbegin() const noexcept -> const_iterator;
+
+    constexpr auto end() noexcept -> iterator;
+    constexpr auto end() const noexcept -> const_iterator;
+    constexpr auto cend() const noexcept -> const_iterator;
+
+    constexpr auto rbegin() noexcept -> reverse_iterator;
+    constexpr auto rbegin() const noexcept -> const_reverse_iterator;
+    constexpr auto crbegin() const noexcept -> const_reverse_iterator;
+
+    constexpr auto rend() noexcept -> reverse_iterator;
+    constexpr auto rend() const noexcept -> const_reverse_iterator;
+    constexpr auto crend() const noexcept -> const_reverse_iterator;
+
+    // Returns true if the grid has no elements, otherwise false.
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool;
+    // Returns number of keys in the grid.
+    [[nodiscard]] constexpr auto size() const noexcept -> size_type;
+    // Returns the maximum number of keys the grid could ever hold.
+    [[nodiscard]] constexpr auto max_size() const noexcept -> size_type;
+    // Returns the number of elements the grid can hold before it has to rehash.
+    [[nodiscard]] constexpr auto capacity() const noexcept -> size_type;
+
+    // Ensures the grid can hold at least count elements without rehashing. Does not allocate if count is 0.
+    constexpr void reserve(size_type count);
+    // Removes all elements, but keeps the allocated storage. The slots of removed values are reset to T().
+    constexpr void clear() noexcept(std::is_nothrow_default_constructible_v<T> && std::is_nothrow_copy_assignable_v<T>);
+
+    // Inserts a value constructed from args if the key is not contained yet. Returns an iterator to the element and
+    // true if an insertion took place, false otherwise. Leaves the grid unchanged if constructing the value or an
+    // allocation throws.
+    template<typename... Args>
+    constexpr auto try_emplace(key_type const& key, Args&&... args) -> std::pair<iterator, bool>;
+
+    // Removes the element with the given key, if any. Returns the number of removed elements (0 or 1).
+    constexpr auto erase(key_type const& key) -> size_type;
+
+    constexpr void swap(sparse_grid& other) noexcept;
+
+    // Returns an iterator to the given key, if found. Otherwise, returns end(). Expected O(1).
+    constexpr auto find(key_type const& key) -> iterator;
+    // Returns an iterator to the given key, if found. Otherwise, returns end(). Expected O(1).
+    constexpr auto find(key_type const& key) const -> const_iterator;
+
+    // Returns 1 if the key is in the grid, otherwise 0. Expected O(1).
+    constexpr auto count(key_type const& key) const -> size_type;
+
+    // Returns true if the given key is in the grid, otherwise false. Expected O(1).
+    constexpr auto contains(key_type const& key) const -> bool;
+
+    // Returns a copy of the allocator used for the values.
+    [[nodiscard]] constexpr auto get_allocator() const noexcept -> allocator_type;
+
+    // Two sparse grids are equal if they contain the same keys mapped to equal values, regardless of storage order.
+    friend constexpr auto operator==(sparse_grid const& lhs, sparse_grid const& rhs) -> bool
+        requires std::equality_comparable<T>
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+        for (std::size_t slot = 0; slot < lhs.slot_count(); ++slot)
+        {
+            if (lhs.m_keys[slot] == s_empty_key)
+                continue;
+            auto const other = rhs.locate(lhs.m_keys[slot]);
+            if (other == rhs.slot_count() || !(lhs.m_values[slot] == rhs.m_values[other]))
+                return false;
+        }
+        return true;
+    }
+
+    template<typename U, std::signed_integral C, class A>
+        requires(sizeof(C) <= sizeof(std::int32_t))
+    friend constexpr void swap(sparse_grid<U, C, A>& lhs, sparse_grid<U, C, A>& rhs) noexcept;
+
+  private:
+    using key_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::uint64_t>;
+
+    // Marks unoccupied slots. Never produced by pack_qr for valid coordinates, since |q| <= coordinate::max_value.
+    static constexpr std::uint64_t s_empty_key = std::uint64_t{1} << 63U;
+    // The smallest number of slots allocated on first insertion.
+    static constexpr size_type s_min_slot_count = 8;
+
+    std::vector<std::uint64_t, key_allocator> m_keys;
+    std::vector<mapped_type, Allocator>       m_values;
+    size_type                                 m_size = 0;
+
+    [[nodiscard]] static constexpr auto pack(key_type const& key) noexcept -> std::uint64_t;
+    [[nodiscard]] static constexpr auto max_elements(size_type slots) noexcept -> size_type;
+
+    [[nodiscard]] constexpr auto slot_count() const noexcept -> size_type;
+    [[nodiscard]] constexpr auto home_slot(std::uint64_t packed) const noexcept -> size_type;
+    [[nodiscard]] constexpr auto locate(std::uint64_t packed) const noexcept -> size_type;
+    [[nodiscard]] constexpr auto next_occupied(size_type slot) const noexcept -> size_type;
+    [[nodiscard]] constexpr auto prev_occupied(size_type slot) const noexcept -> size_type;
+    [[nodiscard]] constexpr auto key_at(size_type slot) const noexcept -> key_type;
+
+    constexpr auto free_slot(std::uint64_t packed) -> size_type;
+    constexpr auto insert_key(std::uint64_t packed) -> std::pair<size_type, bool>;
+    constexpr void rehash(size_type slots);
+
+    friend iterator;
+    friend const_iterator;
+};
+
+// ------------------------------ implementation below ------------------------------
+
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr sparse_grid<T, Coord, Allocator>::sparse_grid(sparse_grid const& other, Allocator const& alloc)
+    : m_keys(other.m_keys, key_allocator(alloc))
+    , m_values(other.m_values, alloc)
+    , m_size(other.m_size)
+{
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr sparse_grid<T, Coord, Allocator>::sparse_grid(sparse_grid&& other) noexcept
+    : m_keys(std::move(other).m_keys)
+    , m_values(std::move(other).m_values)
+    , m_size(std::exchange(other.m_size, 0))
+{
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr sparse_grid<T, Coord, Allocator>::sparse_grid(sparse_grid&& other, Allocator const& alloc)
+    : m_keys(std::move(other).m_keys, key_allocator(alloc))
+    , m_values(std::move(other).m_values, alloc)
+    , m_size(std::exchange(other.m_size, 0))
+{
+    // With unequal allocators the vectors are moved element-wise and other keeps its slots.
+    other.m_keys.clear();
+    other.m_values.clear();
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr sparse_grid<T, Coord, Allocator>::sparse_grid(Allocator const& alloc)
+    : m_keys(key_allocator(alloc))
+    , m_values(alloc)
+{
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr sparse_grid<T, Coord, Allocator>::sparse_grid(size_type count, Allocator const& alloc)
+    : sparse_grid(alloc)
+{
+    reserve(count);
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+constexpr sparse_grid<T, Coord, Allocator>::sparse_grid(InputIt first, Sentinel last, Allocator const& alloc)
+    : sparse_grid(alloc)
+{
+    for (auto&& iter = first; iter != last; ++iter)
+        (*this)[iter->first] = iter->second;
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr sparse_grid<T, Coord, Allocator>::sparse_grid(std::initializer_list<value_type> init, Allocator const& alloc)
+    : sparse_grid(init.size(), alloc)
+{
+    for (auto const& [key, value] : init)
+        (*this)[key] = value;
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::operator=(sparse_grid&& other) noexcept(
+    std::is_nothrow_move_assignable_v<std::vector<mapped_type, Allocator>>) -> sparse_grid&
+{
+    if (this != &other)
+    {
+        // Vectors with unequal allocators that do not propagate are moved element-wise and keep their slots, so clear
+        // them explicitly to leave other empty.
+        m_keys   = std::move(other).m_keys;
+        m_values = std::move(other).m_values;
+        m_size   = std::exchange(other.m_size, 0);
+        other.m_keys.clear();
+        other.m_values.clear();
+    }
+    return *this;
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::operator[](key_type const& key) -> T&
+{
+    return m_values[insert_key(pack(key)).first];
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::operator[](key_type const& key) const -> T const&
+{
+    auto const slot = locate(pack(key));
+    assert(slot != slot_count());
+    return m_values[slot];
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::at(key_type const& key) -> T&
+{
+    auto const slot = locate(pack(key));
+    if (slot == slot_count())
+        throw std::out_of_range("sparse_grid::at");
+    return m_values[slot];
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::at(key_type const& key) const -> T const&
+{
+    auto const slot = locate(pack(key));
+    if (slot == slot_count())
+        throw std::out_of_range("sparse_grid::at");
+    return m_values[slot];
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::begin() noexcept -> iterator
+{
+    return iterator(this, next_occupied(0));
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::begin() const noexcept -> const_iterator
+{
+    return const_iterator(this, next_occupied(0));
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::cbegin() const noexcept -> const_iterator
+{
+    return const_iterator(this, next_occupied(0));
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::end() noexcept -> iterator
+{
+    return iterator(this, slot_count());
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::end() const noexcept -> const_iterator
+{
+    return const_iterator(this, slot_count());
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::cend() const noexcept -> const_iterator
+{
+    return const_iterator(this, slot_count());
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::rbegin() noexcept -> reverse_iterator
+{
+    return reverse_iterator(end());
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::rbegin() const noexcept -> const_reverse_iterator
+{
+    return const_reverse_iterator(cend());
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::crbegin() const noexcept -> const_reverse_iterator
+{
+    return const_reverse_iterator(cend());
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::rend() noexcept -> reverse_iterator
+{
+    return reverse_iterator(begin());
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::rend() const noexcept -> const_reverse_iterator
+{
+    return const_reverse_iterator(cbegin());
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::crend() const noexcept -> const_reverse_iterator
+{
+    return const_reverse_iterator(cbegin());
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::empty() const noexcept -> bool
+{
+    return m_size == 0;
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::size() const noexcept -> size_type
+{
+    return m_size;
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::max_size() const noexcept -> size_type
+{
+    return max_elements(std::bit_floor(std::min(m_keys.max_size(), m_values.max_size())));
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::capacity() const noexcept -> size_type
+{
+    return max_elements(slot_count());
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr void sparse_grid<T, Coord, Allocator>::reserve(size_type count)
+{
+    if (count == 0)
+        return;
+    size_type slots = std::max(slot_count(), s_min_slot_count);
+    while (max_elements(slots) < count)
+        slots *= 2;
+    if (slots != slot_count())
+        rehash(slots);
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr void sparse_grid<T, Coord, Allocator>::clear() noexcept(std::is_nothrow_default_constructible_v<T>
+                                                                   && std::is_nothrow_copy_assignable_v<T>)
+{
+    std::ranges::fill(m_keys, s_empty_key);
+    std::ranges::fill(m_values, T());
+    m_size = 0;
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+template<typename... Args>
+constexpr auto sparse_grid<T, Coord, Allocator>::try_emplace(key_type const& key,
+                                                             Args&&... args) -> std::pair<iterator, bool>
+{
+    auto const packed = pack(key);
+    if (auto const slot = locate(packed); slot != slot_count())
+        return {iterator(this, slot), false};
+
+    // The value is constructed and moved into its slot before the key is written, so a throwing constructor or a
+    // failed allocation leaves the grid unchanged.
+    T          value(std::forward<Args>(args)...);
+    auto const slot = free_slot(packed);
+    m_values[slot]  = std::move(value);
+    m_keys[slot]    = packed;
+    ++m_size;
+    return {iterator(this, slot), true};
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::erase(key_type const& key) -> size_type
+{
+    auto hole = locate(pack(key));
+    if (hole == slot_count())
+        return 0;
+
+    // Backward-shift deletion: move subsequent entries of the same probe sequence into the hole, so lookups never have
+    // to skip over tombstones.
+    auto const mask = slot_count() - 1;
+    for (auto next = (hole + 1) & mask; m_keys[next] != s_empty_key; next = (next + 1) & mask)
+    {
+        auto const home = home_slot(m_keys[next]);
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            m_keys[hole]   = m_keys[next];
+            m_values[hole] = std::move(m_values[next]);
+            hole           = next;
+        }
+    }
+    m_keys[hole]   = s_empty_key;
+    m_values[hole] = T();
+    --m_size;
+    return 1;
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr void sparse_grid<T, Coord, Allocator>::swap(sparse_grid& other) noexcept
+{
+    m_keys.swap(other.m_keys);
+    m_values.swap(other.m_values);
+    std::swap(m_size, other.m_size);
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::find(key_type const& key) -> iterator
+{
+    return iterator(this, locate(pack(key)));
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::find(key_type const& key) const -> const_iterator
+{
+    return const_iterator(this, locate(pack(key)));
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::count(key_type const& key) const -> size_type
+{
+    return contains(key);
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::contains(key_type const& key) const -> bool
+{
+    return locate(pack(key)) != slot_count();
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::get_allocator() const noexcept -> allocator_type
+{
+    return m_values.get_allocator();
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::pack(key_type const& key) noexcept -> std::uint64_t
+{
+    return detail::pack_qr(key.q().value(), key.r().value());
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::max_elements(size_type slots) noexcept -> size_type
+{
+    // Maximum load factor of 3/4; linear probing degrades quickly beyond that.
+    return slots / 4 * 3;
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::slot_count() const noexcept -> size_type
+{
+    return m_keys.size();
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::home_slot(std::uint64_t packed) const noexcept -> size_type
+{
+    return static_cast<size_type>(detail::hash_mix(packed)) & (slot_count() - 1);
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::locate(std::uint64_t packed) const noexcept -> size_type
+{
+    if (m_size == 0)
+        return slot_count();
+    auto const mask = slot_count() - 1;
+    for (auto slot = home_slot(packed);; slot = (slot + 1) & mask)
+    {
+        if (m_keys[slot] == packed)
+            return slot;
+        if (m_keys[slot] == s_empty_key)
+            return slot_count();
+    }
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::next_occupied(size_type slot) const noexcept -> size_type
+{
+    while (slot < slot_count() && m_keys[slot] == s_empty_key)
+        ++slot;
+    return slot;
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::prev_occupied(size_type slot) const noexcept -> size_type
+{
+    do
+        --slot;
+    while (m_keys[slot] == s_empty_key);
+    return slot;
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::key_at(size_type slot) const noexcept -> key_type
+{
+    auto const packed = m_keys[slot];
+    return key_type{q_coordinate<Coord>(detail::unpack_q<Coord>(packed)),
+                    r_coordinate<Coord>(detail::unpack_r<Coord>(packed))};
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::free_slot(std::uint64_t packed) -> size_type
+{
+    if (m_size + 1 > capacity())
+        rehash(std::max(slot_count() * 2, s_min_slot_count));
+
+    auto const mask = slot_count() - 1;
+    auto       slot = home_slot(packed);
+    while (m_keys[slot] != s_empty_key)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr auto sparse_grid<T, Coord, Allocator>::insert_key(std::uint64_t packed) -> std::pair<size_type, bool>
+{
+    if (auto const slot = locate(packed); slot != slot_count())
+        return {slot, false};
+    auto const slot = free_slot(packed);
+    m_keys[slot]    = packed;
+    ++m_size;
+    return {slot, true};
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr void sparse_grid<T, Coord, Allocator>::rehash(size_type slots)
+{
+    assert(std::has_single_bit(slots));
+
+    // Both arrays are allocated before any member changes, so a failed allocation leaves the grid intact. Values are
+    // copied instead of moved if their move may throw and they are copyable, so a throwing copy leaves it intact too.
+    auto keys   = decltype(m_keys)(slots, s_empty_key, m_keys.get_allocator());
+    auto values = decltype(m_values)(slots, m_values.get_allocator());
+
+    auto const mask = slots - 1;
+    for (size_type i = 0; i < m_keys.size(); ++i)
+    {
+        if (m_keys[i] == s_empty_key)
+            continue;
+        auto slot = static_cast<size_type>(detail::hash_mix(m_keys[i])) & mask;
+        while (keys[slot] != s_empty_key)
+            slot = (slot + 1) & mask;
+        keys[slot]   = m_keys[i];
+        values[slot] = std::move_if_noexcept(m_values[i]);
+    }
+    m_keys.swap(keys);
+    m_values.swap(values);
+}
+template<typename T, std::signed_integral Coord, class Allocator>
+    requires(sizeof(Coord) <= sizeof(std::int32_t))
+constexpr void swap(sparse_grid<T, Coord, Allocator>& lhs, sparse_grid<T, Coord, Allocator>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace hex
+
+#endif // HEX_SPARSE_GRID_HPP
@@ -26,23 +26,47 @@
 #define HEX_HEX_HPP
 
 // IWYU pragma: begin_exports
+#include "hex/grid/chunked_grid.hpp"
 #include "hex/grid/grid.hpp"
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/grid/soa_grid.hpp"
+#include "hex/grid/space_filling_order.hpp"
+#include "hex/grid/space_filling_shape.hpp"
+#include "hex/grid/sparse_grid.hpp"
+#include "hex/parallel/algorithms.hpp"
+#include "hex/parallel/thread_pool.hpp"
+#include "hex/pathfinding/distance_field.hpp"
+#include "hex/pathfinding/find_path.hpp"
+#include "hex/pathfinding/flow_field.hpp"
+#include "hex/pathfinding/hierarchical_pathfinder.hpp"
+#include "hex/pathfinding/incremental_pathfinder.hpp"
+#include "hex/pathfinding/search_workspace.hpp"
+#include "hex/vector/cartesian_batch.hpp"
 #include "hex/vector/coordinate.hpp"
 #include "hex/vector/coordinate_axis.hpp"
+#include "hex/vector/layout.hpp"
+#include "hex/vector/layout_orientation.hpp"
+#include "hex/vector/packed_vector.hpp"
 #include "hex/vector/reflection.hpp"
 #include "hex/vector/rotation.hpp"
 #include "hex/vector/rotation_steps.hpp"
 #include "hex/vector/scaling.hpp"
 #include "hex/vector/shearing.hpp"
+#include "hex/vector/space_filling_curve.hpp"
 #include "hex/vector/transformation.hpp"
 #include "hex/vector/translation.hpp"
 #include "hex/vector/vector.hpp"
+#include "hex/vector/vector_batch.hpp"
+#include "hex/visibility/field_of_view.hpp"
+#include "hex/visibility/field_of_view_mode.hpp"
+#include "hex/visibility/line_of_sight.hpp"
 #include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
 #include "hex/views/convex_polygon/convex_polygon_view.hpp"
 #include "hex/views/line/line_view.hpp"
 #include "hex/views/neighbors/neighbors_view.hpp"
 #include "hex/views/offset_rows/offset_parity.hpp"
 #include "hex/views/offset_rows/offset_rows_view.hpp"
+#include "hex/views/rows/rows_view.hpp"
 #include "hex/views/transform/transform_view.hpp"
 // IWYU pragma: end_exports
 
@@ -0,0 +1,218 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef HEX_PARALLEL_ALGORITHMS_HPP
+#define HEX_PARALLEL_ALGORITHMS_HPP
+
+#include "hex/grid/grid.hpp"
+#include "hex/parallel/thread_pool.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+#include <cstddef>
+
+namespace hex::parallel
+{
+// Controls how a parallel grid algorithm is scheduled.
+struct options
+{
+    // Number of elements per block. 0 selects blocks of roughly 16 KiB of values, so each block stays in L1 cache.
+    std::size_t block_size = 0;
+    // The pool to run on. nullptr selects thread_pool::default_pool().
+    thread_pool* pool = nullptr;
+};
+
+// Calls f(key, value) for every element of the grid, in parallel. The grid is split into contiguous blocks of its
+// storage, each walked in shape order. f must be safe to call concurrently for distinct elements.
+template<typename T, grid_shape Shape, class Allocator, class F>
+    requires std::ranges::random_access_range<Shape>
+void for_each(grid<T, Shape, Allocator>& g, F f, options const& opts = {});
+// Calls f(key, value) for every element of the grid, in parallel. The grid is split into contiguous blocks of its
+// storage, each walked in shape order. f must be safe to call concurrently for distinct elements.
+template<typename T, grid_shape Shape, class Allocator, class F>
+    requires std::ranges::random_access_range<Shape>
+void for_each(grid<T, Shape, Allocator> const& g, F f, options const& opts = {});
+
+// Assigns op(key, value) of every element of in to the element with the same key in out, in parallel. UB if the grids
+// have different shapes. op must be safe to call concurrently.
+template<typename T, typename U, grid_shape Shape, class AllocatorIn, class AllocatorOut, class Op>
+    requires std::ranges::random_access_range<Shape>
+void transform(grid<T, Shape, AllocatorIn> const& in,
+               grid<U, Shape, AllocatorOut>&      out,
+               Op                                 op,
+               options const&                     opts = {});
+
+// Combines init and transform_op(key, value) of every element of the grid using op, in parallel. op must be associative
+// and commutative. Per-block results are combined in block order, so the result only depends on the block size, not on
+// scheduling.
+template<typename T, grid_shape Shape, class Allocator, typename V, class Reduce, class Transform>
+    requires std::ranges::random_access_range<Shape>
+[[nodiscard]] auto transform_reduce(grid<T, Shape, Allocator> const& g,
+                                    V                                init,
+                                    Reduce                           op,
+                                    Transform                        transform_op,
+                                    options const&                   opts = {}) -> V;
+
+// Combines init and every value of the grid using op, in parallel. op must be associative and commutative.
+template<typename T, grid_shape Shape, class Allocator, typename V, class Reduce = std::plus<>>
+    requires std::ranges::random_access_range<Shape>
+[[nodiscard]] auto reduce(grid<T, Shape, Allocator> const& g,
+                          V                                init,
+                          Reduce                           op   = {},
+                          options const&                   opts = {}) -> V;
+} // namespace hex::parallel
+
+// ------------------------------ implementation below ------------------------------
+
+namespace hex::detail
+{
+inline constexpr std::size_t parallel_block_bytes    = 16 * 1024; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+inline constexpr std::size_t parallel_min_block_size = 64;        // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+template<typename T>
+[[nodiscard]] constexpr auto parallel_block_size(parallel::options const& opts) noexcept -> std::size_t
+{
+    if (opts.block_size != 0)
+        return opts.block_size;
+    return std::max(parallel_block_bytes / sizeof(T), parallel_min_block_size);
+}
+
+[[nodiscard]] inline auto parallel_pool(parallel::options const& opts) -> parallel::thread_pool&
+{
+    return opts.pool != nullptr ? *opts.pool : parallel::thread_pool::default_pool();
+}
+
+// Calls f(key, index) for every index in [first, last), where key is the element of shape at that index.
+template<class Shape, class F>
+void for_each_shape_index(Shape const& shape, std::size_t first, std::size_t last, F&& f)
+{
+    auto iter = std::ranges::begin(shape) + static_cast<std::ranges::range_difference_t<Shape>>(first);
+    for (auto idx = first; idx != last; ++idx, ++iter)
+        f(*iter, idx);
+}
+
+template<class Grid, class F>
+void parallel_for_each(Grid& g, F& f, parallel::options const& opts)
+{
+    auto const& shape = g.shape();
+    auto* const data  = g.data();
+    parallel_pool(opts).run_blocks(g.size(),
+                                   parallel_block_size<typename Grid::mapped_type>(opts),
+                                   [&](std::size_t first, std::size_t last)
+                                   {
+                                       for_each_shape_index(shape,
+                                                            first,
+                                                            last,
+                                                            [&](auto&& key, std::size_t idx) { f(key, data[idx]); });
+                                   });
+}
+} // namespace hex::detail
+
+namespace hex::parallel
+{
+template<typename T, grid_shape Shape, class Allocator, class F>
+    requires std::ranges::random_access_range<Shape>
+void for_each(grid<T, Shape, Allocator>& g, F f, options const& opts)
+{
+    detail::parallel_for_each(g, f, opts);
+}
+template<typename T, grid_shape Shape, class Allocator, class F>
+    requires std::ranges::random_access_range<Shape>
+void for_each(grid<T, Shape, Allocator> const& g, F f, options const& opts)
+{
+    detail::parallel_for_each(g, f, opts);
+}
+template<typename T, typename U, grid_shape Shape, class AllocatorIn, class AllocatorOut, class Op>
+    requires std::ranges::random_access_range<Shape>
+void transform(grid<T, Shape, AllocatorIn> const& in,
+               grid<U, Shape, AllocatorOut>&      out,
+               Op                                 op,
+               options const&                     opts)
+{
+    assert(in.shape() == out.shape());
+    auto const& shape = in.shape();
+    auto const* src   = in.data();
+    auto* const dst   = out.data();
+    detail::parallel_pool(opts).run_blocks(in.size(),
+                                           detail::parallel_block_size<T>(opts),
+                                           [&](std::size_t first, std::size_t last)
+                                           {
+                                               detail::for_each_shape_index(shape,
+                                                                            first,
+                                                                            last,
+                                                                            [&](auto&& key, std::size_t idx)
+                                                                            { dst[idx] = op(key, src[idx]); });
+                                           });
+}
+template<typename T, grid_shape Shape, class Allocator, typename V, class Reduce, class Transform>
+    requires std::ranges::random_access_range<Shape>
+auto transform_reduce(grid<T, Shape, Allocator> const& g,
+                      V                                init,
+                      Reduce                           op,
+                      Transform                        transform_op,
+                      options const&                   opts) -> V
+{
+    auto const block_size = detail::parallel_block_size<T>(opts);
+    auto const* data      = g.data();
+
+    std::vector<std::optional<V>> partials((g.size() + block_size - 1) / block_size);
+    detail::parallel_pool(opts).run_blocks(g.size(),
+                                           block_size,
+                                           [&](std::size_t first, std::size_t last)
+                                           {
+                                               std::optional<V> acc;
+                                               detail::for_each_shape_index(
+                                                   g.shape(),
+                                                   first,
+                                                   last,
+                                                   [&](auto&& key, std::size_t idx)
+                                                   {
+                                                       if (acc)
+                                                           acc = op(std::move(*acc), transform_op(key, data[idx]));
+                                                       else
+                                                           acc.emplace(transform_op(key, data[idx]));
+                                                   });
+                                               partials[first / block_size] = std::move(acc);
+                                           });
+
+    for (auto& partial : partials)
+        init = op(std::move(init), std::move(*partial));
+    return init;
+}
+template<typename T, grid_shape Shape, class Allocator, typename V, class Reduce>
+    requires std::ranges::random_access_range<Shape>
+auto reduce(grid<T, Shape, Allocator> const& g, V init, Reduce op, options const& opts) -> V
+{
+    return parallel::transform_reduce(
+        g, std::move(init), std::move(op), [](auto&&, T const& value) -> T const& { return value; }, opts);
+}
+} // namespace hex::parallel
+
+#endif // HEX_PARALLEL_ALGORITHMS_HPP
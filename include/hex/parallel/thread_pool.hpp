@@ -0,0 +1,224 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef HEX_THREAD_POOL_HPP
+#define HEX_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+namespace hex::parallel
+{
+// A fixed set of worker threads executing blocked loops. A loop over [0, count) is split into blocks; the workers and
+// the calling thread claim blocks one at a time from a shared counter, so threads that finish early keep taking work
+// until none is left. Only one loop runs at a time; loops started from inside a running block execute inline.
+class thread_pool
+{
+  public:
+    // Starts thread_count - 1 workers, since the calling thread participates in every loop. 0 selects the number of
+    // hardware threads.
+    explicit thread_pool(unsigned thread_count = 0);
+
+    thread_pool(thread_pool const&)                    = delete;
+    thread_pool(thread_pool&&)                         = delete;
+    auto operator=(thread_pool const&) -> thread_pool& = delete;
+    auto operator=(thread_pool&&) -> thread_pool&      = delete;
+
+    // Stops and joins all workers.
+    ~thread_pool();
+
+    // Returns the number of threads participating in a loop, including the calling thread.
+    [[nodiscard]] auto thread_count() const noexcept -> unsigned;
+
+    // Calls body(first, last) for consecutive blocks [first, last) of at most block_size indices covering [0, count),
+    // and returns once all blocks are done. Blocks may run concurrently and in any order. If body throws, the remaining
+    // blocks are skipped and the first exception is rethrown.
+    template<class Body>
+    void run_blocks(std::size_t count, std::size_t block_size, Body&& body);
+
+    // Returns a process-wide pool using all hardware threads, started on first use.
+    [[nodiscard]] static auto default_pool() -> thread_pool&;
+
+  private:
+    struct job
+    {
+        void (*invoke)(void*, std::size_t, std::size_t) = nullptr;
+        void*                    body                   = nullptr;
+        std::size_t              count                  = 0;
+        std::size_t              block_size             = 0;
+        std::size_t              block_count            = 0;
+        std::atomic<std::size_t> next_block             = 0;
+        std::atomic<bool>        failed                 = false;
+        std::exception_ptr       error;
+        std::mutex               error_mutex;
+    };
+
+    std::mutex                  m_run_mutex; // serializes loops submitted from different threads
+    std::mutex                  m_mutex;     // guards the members below
+    std::condition_variable_any m_wake;
+    std::condition_variable     m_idle;
+    job*                        m_job        = nullptr;
+    std::size_t                 m_generation = 0;
+    std::size_t                 m_active     = 0;
+    std::vector<std::jthread>   m_workers;
+
+    void worker_loop(std::stop_token const& stop);
+    static void work_on(job& j) noexcept;
+    static auto in_worker() noexcept -> bool&;
+};
+
+// ------------------------------ implementation below ------------------------------
+
+inline thread_pool::thread_pool(unsigned thread_count)
+{
+    if (thread_count == 0)
+        thread_count = std::max(1U, std::thread::hardware_concurrency());
+    m_workers.reserve(thread_count - 1);
+    for (unsigned i = 1; i < thread_count; ++i)
+        m_workers.emplace_back([this](std::stop_token const& stop) { worker_loop(stop); });
+}
+inline thread_pool::~thread_pool()
+{
+    for (auto& worker : m_workers)
+        worker.request_stop();
+    m_wake.notify_all();
+}
+inline auto thread_pool::thread_count() const noexcept -> unsigned
+{
+    return static_cast<unsigned>(m_workers.size() + 1);
+}
+template<class Body>
+void thread_pool::run_blocks(std::size_t count, std::size_t block_size, Body&& body)
+{
+    if (count == 0)
+        return;
+    block_size = std::max<std::size_t>(block_size, 1);
+
+    auto const block_count = (count + block_size - 1) / block_size;
+    if (block_count == 1 || m_workers.empty() || in_worker())
+    {
+        for (std::size_t first = 0; first < count; first += block_size)
+            body(first, std::min(first + block_size, count));
+        return;
+    }
+
+    job j;
+    j.invoke      = [](void* b, std::size_t first, std::size_t last)
+    { (*static_cast<std::remove_reference_t<Body>*>(b))(first, last); };
+    j.body        = std::addressof(body);
+    j.count       = count;
+    j.block_size  = block_size;
+    j.block_count = block_count;
+
+    std::scoped_lock const run_lock(m_run_mutex);
+    {
+        std::scoped_lock const lock(m_mutex);
+        m_job = &j;
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    in_worker() = true;
+    work_on(j);
+    in_worker() = false;
+
+    {
+        // Workers only pick up m_job while holding m_mutex, so once it is cleared and no worker is active, nobody
+        // references j anymore.
+        std::unique_lock lock(m_mutex);
+        m_job = nullptr;
+        m_idle.wait(lock, [this] { return m_active == 0; });
+    }
+
+    if (j.error)
+        std::rethrow_exception(j.error);
+}
+inline auto thread_pool::default_pool() -> thread_pool&
+{
+    static thread_pool pool;
+    return pool;
+}
+inline void thread_pool::worker_loop(std::stop_token const& stop)
+{
+    in_worker()            = true;
+    std::size_t generation = 0;
+    while (true)
+    {
+        job* j = nullptr;
+        {
+            std::unique_lock lock(m_mutex);
+            if (!m_wake.wait(lock, stop, [&] { return m_generation != generation; }))
+                return;
+            generation = m_generation;
+            j          = m_job;
+            if (j == nullptr)
+                continue;
+            ++m_active;
+        }
+        work_on(*j);
+        {
+            std::scoped_lock const lock(m_mutex);
+            --m_active;
+        }
+        m_idle.notify_all();
+    }
+}
+inline void thread_pool::work_on(job& j) noexcept
+{
+    while (!j.failed.load(std::memory_order_relaxed))
+    {
+        auto const block = j.next_block.fetch_add(1, std::memory_order_relaxed);
+        if (block >= j.block_count)
+            return;
+        auto const first = block * j.block_size;
+        try
+        {
+            j.invoke(j.body, first, std::min(first + j.block_size, j.count));
+        }
+        catch (...)
+        {
+            std::scoped_lock const lock(j.error_mutex);
+            if (!j.error)
+                j.error = std::current_exception();
+            j.failed.store(true, std::memory_order_relaxed);
+        }
+    }
+}
+inline auto thread_pool::in_worker() noexcept -> bool&
+{
+    thread_local bool flag = false;
+    return flag;
+}
+} // namespace hex::parallel
+
+#endif // HEX_THREAD_POOL_HPP
@@ -0,0 +1,125 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_DETAIL_CLUSTER_LATTICE_HPP
+#define HEX_DETAIL_CLUSTER_LATTICE_HPP
+
+#include "hex/vector/vector.hpp"
+
+#include <array>
+#include <compare>
+#include <concepts>
+
+namespace hex::detail
+{
+// The coordinates of a regular hexagon in a tiling of the plane with regular hexagons of one radius.
+template<std::signed_integral T>
+struct cluster_cell
+{
+    T a;
+    T b;
+
+    [[nodiscard]] constexpr auto operator<=>(cluster_cell const& other) const noexcept = default;
+};
+
+// The tiling of the plane with regular hexagons of a radius. The center of the hexagon at (a, b) is
+// a * (2 radius + 1, -radius) + b * (radius, radius + 1) in (q, r), which places the hexagon at (0, 0) around the
+// origin.
+template<std::signed_integral T>
+class cluster_lattice
+{
+  public:
+    // The neighbors of a hexagon, ordered such that the opposite of direction d is (d + 3) % 6.
+    static constexpr std::array<cluster_cell<T>, 6> directions{{{1, 0}, {0, 1}, {-1, 1}, {-1, 0}, {0, -1}, {1, -1}}};
+
+    // Describes the tiling with hexagons of the given radius. UB if radius is negative.
+    constexpr explicit cluster_lattice(T radius) noexcept;
+
+    [[nodiscard]] constexpr auto radius() const noexcept -> T;
+    // Returns the center of the hexagon at cell.
+    [[nodiscard]] constexpr auto center(cluster_cell<T> const& cell) const noexcept -> vector<T>;
+    // Returns the hexagon containing position.
+    [[nodiscard]] constexpr auto cell_of(vector<T> const& position) const noexcept -> cluster_cell<T>;
+
+  private:
+    // Returns the largest integer not greater than n / d. UB if d <= 0.
+    [[nodiscard]] static constexpr auto floor_div(T n, T d) noexcept -> T;
+
+    T m_radius;
+};
+} // namespace hex::detail
+
+// ------------------------------ implementation below ------------------------------
+
+template<std::signed_integral T>
+constexpr hex::detail::cluster_lattice<T>::cluster_lattice(T radius) noexcept
+    : m_radius(radius)
+{
+}
+
+template<std::signed_integral T>
+constexpr auto hex::detail::cluster_lattice<T>::radius() const noexcept -> T
+{
+    return m_radius;
+}
+
+template<std::signed_integral T>
+constexpr auto hex::detail::cluster_lattice<T>::center(cluster_cell<T> const& cell) const noexcept -> vector<T>
+{
+    auto const n = m_radius;
+    return vector{q_coordinate<T>((cell.a * ((2 * n) + 1)) + (cell.b * n)),
+                  r_coordinate<T>((cell.b * (n + 1)) - (cell.a * n))};
+}
+
+template<std::signed_integral T>
+constexpr auto hex::detail::cluster_lattice<T>::cell_of(vector<T> const& position) const noexcept -> cluster_cell<T>
+{
+    // Invert the basis to find the parallelogram of centers around position. The hexagon containing it is centered at
+    // one of its corners or just outside of them, and it is the only one within the radius.
+    auto const n   = m_radius;
+    auto const q   = position.q().value();
+    auto const r   = position.r().value();
+    auto const det = (3 * n * n) + (3 * n) + 1;
+    auto const a   = floor_div(((n + 1) * q) - (n * r), det);
+    auto const b   = floor_div((n * q) + (((2 * n) + 1) * r), det);
+    for (auto da = T{-1}; da <= 2; ++da)
+    {
+        for (auto db = T{-1}; db <= 2; ++db)
+        {
+            auto const cell = cluster_cell<T>{static_cast<T>(a + da), static_cast<T>(b + db)};
+            if (distance(center(cell), position) <= n)
+                return cell;
+        }
+    }
+    return {a, b};
+}
+
+template<std::signed_integral T>
+constexpr auto hex::detail::cluster_lattice<T>::floor_div(T n, T d) noexcept -> T
+{
+    auto const quotient = n / d;
+    return (n % d != 0 && n < 0) ? static_cast<T>(quotient - 1) : quotient;
+}
+
+#endif // HEX_DETAIL_CLUSTER_LATTICE_HPP
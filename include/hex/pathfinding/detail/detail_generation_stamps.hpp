@@ -0,0 +1,103 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_DETAIL_GENERATION_STAMPS_HPP
+#define HEX_DETAIL_GENERATION_STAMPS_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hex::detail
+{
+// Marks the indices in [0, size()) reached by the current search, forgotten in O(1) by starting a new generation. Every
+// marked index is stamped with the current generation; when the generation wraps around, all stamps are reset once.
+// Allocates only in resize().
+template<std::unsigned_integral Stamp = std::uint32_t>
+class generation_stamps
+{
+  public:
+    using size_type = std::size_t;
+
+    // Initializes stamps for no indices.
+    constexpr generation_stamps() = default;
+
+    // Sets the number of indices, none of them marked.
+    constexpr void resize(size_type size);
+    [[nodiscard]] constexpr auto size() const noexcept -> size_type;
+
+    // Unmarks all indices.
+    constexpr void next_generation() noexcept;
+
+    // Returns true if index was marked since the last call to next_generation(), otherwise false.
+    [[nodiscard]] constexpr auto marked(size_type index) const noexcept -> bool;
+    constexpr void               mark(size_type index) noexcept;
+
+  private:
+    std::vector<Stamp> m_stamps;
+    Stamp              m_generation = 1;
+};
+} // namespace hex::detail
+
+// ------------------------------ implementation below ------------------------------
+
+template<std::unsigned_integral Stamp>
+constexpr void hex::detail::generation_stamps<Stamp>::resize(size_type size)
+{
+    m_stamps.assign(size, 0);
+    m_generation = 1;
+}
+
+template<std::unsigned_integral Stamp>
+constexpr auto hex::detail::generation_stamps<Stamp>::size() const noexcept -> size_type
+{
+    return m_stamps.size();
+}
+
+template<std::unsigned_integral Stamp>
+constexpr void hex::detail::generation_stamps<Stamp>::next_generation() noexcept
+{
+    if (++m_generation == 0)
+    {
+        std::ranges::fill(m_stamps, 0);
+        m_generation = 1;
+    }
+}
+
+template<std::unsigned_integral Stamp>
+constexpr auto hex::detail::generation_stamps<Stamp>::marked(size_type index) const noexcept -> bool
+{
+    return m_stamps[index] == m_generation;
+}
+
+template<std::unsigned_integral Stamp>
+constexpr void hex::detail::generation_stamps<Stamp>::mark(size_type index) noexcept
+{
+    m_stamps[index] = m_generation;
+}
+
+#endif // HEX_DETAIL_GENERATION_STAMPS_HPP
@@ -0,0 +1,229 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_DETAIL_INDEXED_HEAP_HPP
+#define HEX_DETAIL_INDEXED_HEAP_HPP
+
+#include <concepts>
+#include <limits>
+#include <vector>
+
+#include <cstddef>
+
+namespace hex::detail
+{
+// A binary min-heap of the indices in [0, capacity()) ordered by a priority, with each index queued at most once so
+// that its priority can be changed in place. Allocates only in resize().
+template<typename Priority, std::unsigned_integral Index>
+class indexed_heap
+{
+  public:
+    using priority_type = Priority;
+    using index_type    = Index;
+    using size_type     = std::size_t;
+
+    struct entry
+    {
+        Priority priority;
+        Index    index;
+    };
+
+    // Initializes a heap with capacity 0.
+    constexpr indexed_heap() = default;
+
+    // Empties the heap and sets its capacity.
+    constexpr void resize(size_type capacity);
+    // Removes all indices. O(size()).
+    constexpr void clear() noexcept;
+
+    [[nodiscard]] constexpr auto capacity() const noexcept -> size_type;
+    [[nodiscard]] constexpr auto size() const noexcept -> size_type;
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool;
+    // Returns true if index is queued, otherwise false. UB if index >= capacity().
+    [[nodiscard]] constexpr auto contains(Index index) const noexcept -> bool;
+
+    // Returns the entry with the smallest priority. UB if empty.
+    [[nodiscard]] constexpr auto top() const noexcept -> entry const&;
+    // Removes and returns the entry with the smallest priority. UB if empty.
+    constexpr auto pop() noexcept -> entry;
+    // Queues index with the given priority, or changes its priority if it is already queued.
+    constexpr void push_or_update(Index index, Priority const& priority) noexcept;
+    // Removes index if it is queued.
+    constexpr void erase(Index index) noexcept;
+
+  private:
+    static constexpr Index not_queued = std::numeric_limits<Index>::max();
+
+    constexpr void sift_up(size_type slot) noexcept;
+    constexpr void sift_down(size_type slot) noexcept;
+    constexpr void place(size_type slot, entry const& e) noexcept;
+
+    std::vector<entry> m_heap;
+    std::vector<Index> m_slot;
+    size_type          m_size = 0;
+};
+} // namespace hex::detail
+
+// ------------------------------ implementation below ------------------------------
+
+template<typename Priority, std::unsigned_integral Index>
+constexpr void hex::detail::indexed_heap<Priority, Index>::resize(size_type capacity)
+{
+    m_heap.resize(capacity);
+    m_slot.assign(capacity, not_queued);
+    m_size = 0;
+}
+
+template<typename Priority, std::unsigned_integral Index>
+constexpr void hex::detail::indexed_heap<Priority, Index>::clear() noexcept
+{
+    for (size_type slot = 0; slot < m_size; ++slot)
+        m_slot[m_heap[slot].index] = not_queued;
+    m_size = 0;
+}
+
+template<typename Priority, std::unsigned_integral Index>
+constexpr auto hex::detail::indexed_heap<Priority, Index>::capacity() const noexcept -> size_type
+{
+    return m_slot.size();
+}
+
+template<typename Priority, std::unsigned_integral Index>
+constexpr auto hex::detail::indexed_heap<Priority, Index>::size() const noexcept -> size_type
+{
+    return m_size;
+}
+
+template<typename Priority, std::unsigned_integral Index>
+constexpr auto hex::detail::indexed_heap<Priority, Index>::empty() const noexcept -> bool
+{
+    return m_size == 0;
+}
+
+template<typename Priority, std::unsigned_integral Index>
+constexpr auto hex::detail::indexed_heap<Priority, Index>::contains(Index index) const noexcept -> bool
+{
+    return m_slot[index] != not_queued;
+}
+
+template<typename Priority, std::unsigned_integral Index>
+constexpr auto hex::detail::indexed_heap<Priority, Index>::top() const noexcept -> entry const&
+{
+    return m_heap.front();
+}
+
+template<typename Priority, std::unsigned_integral Index>
+constexpr auto hex::detail::indexed_heap<Priority, Index>::pop() noexcept -> entry
+{
+    auto const result    = m_heap.front();
+    m_slot[result.index] = not_queued;
+    if (--m_size != 0)
+    {
+        place(0, m_heap[m_size]);
+        sift_down(0);
+    }
+    return result;
+}
+
+template<typename Priority, std::unsigned_integral Index>
+constexpr void hex::detail::indexed_heap<Priority, Index>::push_or_update(Index           index,
+                                                                         Priority const& priority) noexcept
+{
+    auto const slot = m_slot[index];
+    if (slot == not_queued)
+    {
+        place(m_size, entry{priority, index});
+        sift_up(m_size++);
+    }
+    else if (priority < m_heap[slot].priority)
+    {
+        m_heap[slot].priority = priority;
+        sift_up(slot);
+    }
+    else
+    {
+        m_heap[slot].priority = priority;
+        sift_down(slot);
+    }
+}
+
+template<typename Priority, std::unsigned_integral Index>
+constexpr void hex::detail::indexed_heap<Priority, Index>::erase(Index index) noexcept
+{
+    auto const slot = m_slot[index];
+    if (slot == not_queued)
+        return;
+    m_slot[index] = not_queued;
+    if (slot == --m_size)
+        return;
+    auto const last = m_heap[m_size];
+    place(slot, last);
+    if (last.priority < m_heap[slot == 0 ? 0 : (slot - 1) / 2].priority)
+        sift_up(slot);
+    else
+        sift_down(slot);
+}
+
+template<typename Priority, std::unsigned_integral Index>
+constexpr void hex::detail::indexed_heap<Priority, Index>::sift_up(size_type slot) noexcept
+{
+    auto const moving = m_heap[slot];
+    while (slot != 0)
+    {
+        auto const parent = (slot - 1) / 2;
+        if (!(moving.priority < m_heap[parent].priority))
+            break;
+        place(slot, m_heap[parent]);
+        slot = parent;
+    }
+    place(slot, moving);
+}
+
+template<typename Priority, std::unsigned_integral Index>
+constexpr void hex::detail::indexed_heap<Priority, Index>::sift_down(size_type slot) noexcept
+{
+    auto const moving = m_heap[slot];
+    while (true)
+    {
+        auto child = (2 * slot) + 1;
+        if (child >= m_size)
+            break;
+        if (child + 1 < m_size && m_heap[child + 1].priority < m_heap[child].priority)
+            ++child;
+        if (!(m_heap[child].priority < moving.priority))
+            break;
+        place(slot, m_heap[child]);
+        slot = child;
+    }
+    place(slot, moving);
+}
+
+template<typename Priority, std::unsigned_integral Index>
+constexpr void hex::detail::indexed_heap<Priority, Index>::place(size_type slot, entry const& e) noexcept
+{
+    m_heap[slot]    = e;
+    m_slot[e.index] = static_cast<Index>(slot);
+}
+
+#endif // HEX_DETAIL_INDEXED_HEAP_HPP
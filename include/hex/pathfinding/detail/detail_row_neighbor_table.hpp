@@ -0,0 +1,147 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_DETAIL_ROW_NEIGHBOR_TABLE_HPP
+#define HEX_DETAIL_ROW_NEIGHBOR_TABLE_HPP
+
+#include "hex/grid/detail/detail_grid_rows.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/neighbors/detail/detail_neighbors.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hex::detail
+{
+// The neighbors in one direction of the positions of a row: for first <= i < last, the neighbor of position i of the
+// row has the shape index of position i plus shift, and lies in row number row.
+struct row_neighbors
+{
+    std::uint32_t  row   = 0; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::ptrdiff_t shift = 0; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::size_t    first = 0; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::size_t    last  = 0; // NOLINT(misc-non-private-member-variables-in-classes)
+};
+
+// A position of a shape together with the number of the row it lies in.
+struct row_position
+{
+    std::uint32_t index; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint32_t row;   // NOLINT(misc-non-private-member-variables-in-classes)
+};
+
+// The neighbors of every row of a shape, in the order of detail::neighbors, so that the neighbors of a position can be
+// resolved with index arithmetic from its row. Requires the rows to be parallel, with all neighbors of a row in the
+// row itself or the rows before and after it, as is the case for convex_polygon_view and offset_rows_view. O(rows)
+// memory and construction time.
+class row_neighbor_table
+{
+  public:
+    // Builds the table for the given shape. Throws std::length_error if the shape has too many elements to be indexed
+    // by std::uint32_t.
+    template<shape_with_rows Shape>
+    constexpr explicit row_neighbor_table(Shape const& shape);
+
+    // Returns the number of the row containing the position with the given shape index. O(log(rows)).
+    [[nodiscard]] constexpr auto row_of(std::size_t index) const noexcept -> std::uint32_t;
+
+    // Calls fn(row_position) for every neighbor of position that is in the shape.
+    template<typename Fn>
+    constexpr void for_each_neighbor(row_position const& position, Fn&& fn) const;
+
+  private:
+    std::vector<std::array<row_neighbors, 6>> m_neighbors;
+    std::vector<std::size_t>                  m_offsets;
+};
+} // namespace hex::detail
+
+// ------------------------------ implementation below ------------------------------
+
+template<hex::detail::shape_with_rows Shape>
+constexpr hex::detail::row_neighbor_table::row_neighbor_table(Shape const& shape)
+{
+    if (std::ranges::size(shape) > std::numeric_limits<std::uint32_t>::max())
+        throw std::length_error("shape is too large for a row_neighbor_table");
+
+    auto const rows = shape.rows();
+    auto const size = static_cast<std::size_t>(std::ranges::size(rows));
+    m_neighbors.resize(size);
+    m_offsets.reserve(size);
+    for (std::size_t k = 0; k < size; ++k)
+    {
+        auto const row = rows[k];
+        m_offsets.push_back(row.offset);
+        for (std::size_t d = 0; d < neighbors.size(); ++d)
+        {
+            auto const target = row.first + neighbors[d];
+            for (std::size_t other = k == 0 ? 0 : k - 1; other < std::min(k + 2, size); ++other)
+            {
+                auto const candidate = rows[other];
+                auto const diff      = target - candidate.first;
+                auto const step      = candidate.step;
+                if (diff.q().value() * step.r().value() != diff.r().value() * step.q().value())
+                    continue;
+                auto const shift =
+                    static_cast<std::ptrdiff_t>(step.q().value() != 0 ? diff.q().value() * step.q().value()
+                                                                      : diff.r().value() * step.r().value());
+                auto const first = static_cast<std::size_t>(std::max<std::ptrdiff_t>(0, -shift));
+                auto const last  = static_cast<std::size_t>(
+                    std::clamp<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(candidate.size) - shift,
+                                               0,
+                                               static_cast<std::ptrdiff_t>(row.size)));
+                m_neighbors[k][d] = {static_cast<std::uint32_t>(other),
+                                     static_cast<std::ptrdiff_t>(candidate.offset) + shift
+                                         - static_cast<std::ptrdiff_t>(row.offset),
+                                     first,
+                                     std::max(first, last)};
+                break;
+            }
+        }
+    }
+}
+
+constexpr auto hex::detail::row_neighbor_table::row_of(std::size_t index) const noexcept -> std::uint32_t
+{
+    return static_cast<std::uint32_t>(std::ranges::upper_bound(m_offsets, index) - m_offsets.begin() - 1);
+}
+
+template<typename Fn>
+constexpr void hex::detail::row_neighbor_table::for_each_neighbor(row_position const& position, Fn&& fn) const
+{
+    auto const i = position.index - m_offsets[position.row];
+    for (auto const& n : m_neighbors[position.row])
+    {
+        if (i - n.first < n.last - n.first)
+            fn(row_position{static_cast<std::uint32_t>(static_cast<std::ptrdiff_t>(position.index) + n.shift), n.row});
+    }
+}
+
+#endif // HEX_DETAIL_ROW_NEIGHBOR_TABLE_HPP
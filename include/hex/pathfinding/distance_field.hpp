@@ -0,0 +1,181 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_DISTANCE_FIELD_HPP
+#define HEX_DISTANCE_FIELD_HPP
+
+#include "hex/grid/detail/detail_grid_rows.hpp"
+#include "hex/grid/grid.hpp"
+#include "hex/pathfinding/detail/detail_row_neighbor_table.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hex
+{
+// Returns the cost of a cheapest path from the nearest of sources to every position of shape, where entering a
+// position costs its value in costs and positions with value 0 cannot be entered. Unreachable positions are
+// std::numeric_limits<Dist>::max(), as are positions whose distance does not fit below it; sources outside of shape are
+// ignored. Uses BFS if no cost is larger than 1, and otherwise Dial's algorithm with one bucket per cost up to the
+// largest one, so it is meant for small costs. Neighbors are resolved per row of shape by index arithmetic. Throws
+// std::invalid_argument if costs is not a grid over shape.
+template<std::unsigned_integral Dist = std::uint32_t,
+         grid_shape Shape,
+         std::ranges::input_range Sources,
+         std::unsigned_integral   T,
+         class Allocator>
+    requires detail::shape_with_rows<Shape>
+[[nodiscard]] constexpr auto distance_field(Shape const&                     shape,
+                                            Sources const&                   sources,
+                                            grid<T, Shape, Allocator> const& costs) -> grid<Dist, Shape>;
+// As above, but entering any position costs 1.
+template<std::unsigned_integral Dist = std::uint32_t, grid_shape Shape, std::ranges::input_range Sources>
+    requires detail::shape_with_rows<Shape>
+[[nodiscard]] constexpr auto distance_field(Shape const& shape, Sources const& sources) -> grid<Dist, Shape>;
+
+namespace detail
+{
+// Implements distance_field(), with cost(index) the cost of entering the position with the given shape index.
+template<typename Dist, typename Shape, typename Sources, typename Cost>
+constexpr auto distance_field_from(Shape const& shape, Sources const& sources, Cost const& cost, std::size_t max_cost)
+    -> grid<Dist, Shape>;
+} // namespace detail
+} // namespace hex
+
+// ------------------------------ implementation below ------------------------------
+
+template<typename Dist, typename Shape, typename Sources, typename Cost>
+constexpr auto hex::detail::distance_field_from(Shape const&   shape,
+                                                Sources const& sources,
+                                                Cost const&    cost,
+                                                std::size_t    max_cost) -> grid<Dist, Shape>
+{
+    constexpr auto unreachable = std::numeric_limits<Dist>::max();
+
+    grid<Dist, Shape> field(shape);
+    auto* const       distances = field.data();
+    std::ranges::fill(std::span(distances, field.size()), unreachable);
+
+    row_neighbor_table const  table(shape);
+    std::vector<row_position> frontier;
+    for (auto const& source : sources)
+    {
+        if (!field.contains(source))
+            continue;
+        auto const index = static_cast<std::uint32_t>(field.shape()[source]);
+        if (distances[index] == 0)
+            continue;
+        distances[index] = 0;
+        frontier.push_back({index, table.row_of(index)});
+    }
+
+    if (max_cost <= 1)
+    {
+        frontier.reserve(field.size());
+        for (std::size_t head = 0; head < frontier.size(); ++head)
+        {
+            auto const head_distance = distances[frontier[head].index];
+            if (head_distance == unreachable - 1)
+                continue;
+            auto const next_distance = static_cast<Dist>(head_distance + 1);
+            table.for_each_neighbor(frontier[head],
+                                    [&](row_position const& next)
+                                    {
+                                        if (distances[next.index] == unreachable && cost(next.index) != 0)
+                                        {
+                                            distances[next.index] = next_distance;
+                                            frontier.push_back(next);
+                                        }
+                                    });
+        }
+        return field;
+    }
+
+    std::vector<std::vector<row_position>> buckets(max_cost + 1);
+    auto                                   pending = frontier.size();
+    buckets.front()                                = std::move(frontier);
+    for (Dist current_distance = 0; pending != 0; ++current_distance)
+    {
+        auto& bucket = buckets[current_distance % buckets.size()];
+        for (auto const& current : bucket)
+        {
+            if (distances[current.index] != current_distance)
+                continue;
+            table.for_each_neighbor(current,
+                                    [&](row_position const& next)
+                                    {
+                                        auto const step = cost(next.index);
+                                        if (step == 0 || std::cmp_greater_equal(step, unreachable - current_distance))
+                                            return;
+                                        auto const next_distance = static_cast<Dist>(current_distance + step);
+                                        if (next_distance < distances[next.index])
+                                        {
+                                            distances[next.index] = next_distance;
+                                            buckets[next_distance % buckets.size()].push_back(next);
+                                            ++pending;
+                                        }
+                                    });
+        }
+        pending -= bucket.size();
+        bucket.clear();
+    }
+    return field;
+}
+
+template<std::unsigned_integral Dist,
+         hex::grid_shape Shape,
+         std::ranges::input_range Sources,
+         std::unsigned_integral   T,
+         class Allocator>
+    requires hex::detail::shape_with_rows<Shape>
+constexpr auto hex::distance_field(Shape const&                          shape,
+                                   Sources const&                        sources,
+                                   hex::grid<T, Shape, Allocator> const& costs) -> hex::grid<Dist, Shape>
+{
+    if (costs.shape() != shape)
+        throw std::invalid_argument("costs shape does not match shape");
+
+    auto const* const values   = costs.data();
+    auto const        max_cost = costs.size() == 0 ? T{} : std::ranges::max(std::span(values, costs.size()));
+    return hex::detail::distance_field_from<Dist>(
+        shape, sources, [values](std::uint32_t index) { return values[index]; }, max_cost);
+}
+
+template<std::unsigned_integral Dist, hex::grid_shape Shape, std::ranges::input_range Sources>
+    requires hex::detail::shape_with_rows<Shape>
+constexpr auto hex::distance_field(Shape const& shape, Sources const& sources) -> hex::grid<Dist, Shape>
+{
+    return hex::detail::distance_field_from<Dist>(shape, sources, [](std::uint32_t) { return 1U; }, 1);
+}
+
+#endif // HEX_DISTANCE_FIELD_HPP
@@ -0,0 +1,146 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_FIND_PATH_HPP
+#define HEX_FIND_PATH_HPP
+
+#include "hex/grid/grid.hpp"
+#include "hex/pathfinding/search_workspace.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace hex
+{
+// Finds a cheapest path from from to to with A*, guided by distance() to to. cost_fn(value) returns the cost of
+// entering a position with the given value as an optional, or std::nullopt if the position cannot be entered. Every
+// cost must be at least 1 for the path to be cheapest. On success, replaces the contents of path with the positions
+// from from to to, inclusive, and returns the cost of the path; otherwise, clears path and returns std::nullopt. Does
+// not allocate unless path has to grow. Throws std::invalid_argument if workspace was not built for the grid's shape.
+template<typename T, grid_shape Shape, class Allocator, typename CostFn, typename Cost, std::unsigned_integral Index>
+constexpr auto find_path(grid<T, Shape, Allocator> const&                           g,
+                         typename grid<T, Shape, Allocator>::key_type const&        from,
+                         typename grid<T, Shape, Allocator>::key_type const&        to,
+                         CostFn                                                     cost_fn,
+                         search_workspace<Shape, Cost, Index>&                      workspace,
+                         std::vector<typename grid<T, Shape, Allocator>::key_type>& path) -> std::optional<Cost>;
+// As above, but returns the path, which is empty if there is none, using a temporary workspace.
+template<typename T, grid_shape Shape, class Allocator, typename CostFn>
+[[nodiscard]] constexpr auto find_path(grid<T, Shape, Allocator> const&                    g,
+                                       typename grid<T, Shape, Allocator>::key_type const& from,
+                                       typename grid<T, Shape, Allocator>::key_type const& to,
+                                       CostFn cost_fn) -> std::vector<typename grid<T, Shape, Allocator>::key_type>;
+} // namespace hex
+
+// ------------------------------ implementation below ------------------------------
+
+template<typename T,
+         hex::grid_shape Shape,
+         class Allocator,
+         typename CostFn,
+         typename Cost,
+         std::unsigned_integral Index>
+constexpr auto hex::find_path(hex::grid<T, Shape, Allocator> const&                           g,
+                              typename hex::grid<T, Shape, Allocator>::key_type const&        from,
+                              typename hex::grid<T, Shape, Allocator>::key_type const&        to,
+                              CostFn                                                          cost_fn,
+                              hex::search_workspace<Shape, Cost, Index>&                      workspace,
+                              std::vector<typename hex::grid<T, Shape, Allocator>::key_type>& path)
+    -> std::optional<Cost>
+{
+    if (!workspace.built_for(g.shape()))
+        throw std::invalid_argument("workspace shape does not match grid shape");
+
+    path.clear();
+    workspace.restart();
+    if (!g.contains(from) || !g.contains(to))
+        return std::nullopt;
+
+    auto const& shape     = g.shape();
+    auto const* values    = g.data();
+    auto const& neighbors = workspace.m_neighbors;
+    auto const  start     = static_cast<Index>(shape[from]);
+    auto const  goal      = static_cast<Index>(shape[to]);
+    auto const  heuristic = [&](Index index) { return static_cast<Cost>(distance(workspace.m_positions[index], to)); };
+
+    workspace.reach(start, Cost{}, start);
+    workspace.m_open.push_or_update(start, {heuristic(start), heuristic(start)});
+    while (!workspace.m_open.empty())
+    {
+        auto const current = workspace.m_open.pop().index;
+        ++workspace.m_expanded;
+        if (current == goal)
+        {
+            for (auto index = goal; index != start; index = workspace.m_parent[index])
+                path.push_back(workspace.m_positions[index]);
+            path.push_back(workspace.m_positions[start]);
+            std::ranges::reverse(path);
+            return workspace.m_cost[goal];
+        }
+
+        auto const cost = workspace.m_cost[current];
+        for (auto const next : neighbors[current])
+        {
+            if (next == neighbor_table<Index>::no_neighbor)
+                continue;
+            bool const reached = workspace.reached(next);
+            if (reached && !workspace.m_open.contains(next))
+                continue;
+            auto const step = cost_fn(std::as_const(values[next]));
+            if (!step)
+                continue;
+            auto const next_cost = static_cast<Cost>(cost + static_cast<Cost>(*step));
+            if (reached && !(next_cost < workspace.m_cost[next]))
+                continue;
+            workspace.reach(next, next_cost, current);
+            auto const h = heuristic(next);
+            workspace.m_open.push_or_update(next, {static_cast<Cost>(next_cost + h), h});
+        }
+    }
+    return std::nullopt;
+}
+
+template<typename T, hex::grid_shape Shape, class Allocator, typename CostFn>
+constexpr auto hex::find_path(hex::grid<T, Shape, Allocator> const&                    g,
+                              typename hex::grid<T, Shape, Allocator>::key_type const& from,
+                              typename hex::grid<T, Shape, Allocator>::key_type const& to,
+                              CostFn cost_fn) -> std::vector<typename hex::grid<T, Shape, Allocator>::key_type>
+{
+    using cost_type = typename std::invoke_result_t<CostFn&, T const&>::value_type;
+
+    search_workspace<Shape, cost_type>                         workspace(g.shape());
+    std::vector<typename grid<T, Shape, Allocator>::key_type> path;
+    hex::find_path(g, from, to, std::move(cost_fn), workspace, path);
+    return path;
+}
+
+#endif // HEX_FIND_PATH_HPP
@@ -0,0 +1,281 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_FLOW_FIELD_HPP
+#define HEX_FLOW_FIELD_HPP
+
+#include "hex/grid/grid.hpp"
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/pathfinding/detail/detail_indexed_heap.hpp"
+
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hex
+{
+// The direction of steepest descent of a distance field at every position, one byte per position, so that steering a
+// unit towards the nearest source is a single lookup. A direction is an index into views::neighbors() of the position,
+// or none at sources, at unreachable positions and at local minima. Ties go to the lowest index.
+template<grid_shape Shape, std::unsigned_integral Dist = std::uint32_t>
+class flow_field
+{
+  public:
+    using shape_type     = Shape;
+    using key_type       = std::ranges::range_value_t<Shape>;
+    using distance_type  = Dist;
+    using direction_type = std::uint8_t;
+    using size_type      = std::size_t;
+
+    // Marks a position without a direction.
+    static constexpr direction_type none = 7;
+    // Marks an unreachable position in distances().
+    static constexpr Dist unreachable = std::numeric_limits<Dist>::max();
+
+    // Computes the directions of the given distance field, usually one returned by distance_field(). O(n).
+    constexpr explicit flow_field(grid<Dist, Shape> distances);
+
+    // Returns the direction at position. UB if position is not in the shape.
+    [[nodiscard]] constexpr auto operator[](key_type const& position) const -> direction_type;
+
+    [[nodiscard]] constexpr auto directions() const noexcept -> grid<direction_type, Shape> const&;
+    [[nodiscard]] constexpr auto distances() const noexcept -> grid<Dist, Shape> const&;
+
+    // Repairs distances and directions after the costs of the changed positions have changed to their values in costs,
+    // which have the meaning of the costs of distance_field() and were valid for the field before the change. Lowered
+    // costs are propagated outwards from their position. Raised costs invalidate the positions whose directions lead
+    // through their position, which are then recomputed from the valid positions around them. Does not allocate once
+    // the field has been updated with as many affected positions. Returns the number of positions whose distance was
+    // recomputed. Throws std::invalid_argument if costs is not a grid over the shape of the field.
+    template<std::unsigned_integral T, class Allocator, std::ranges::input_range Changed>
+    constexpr auto update(grid<T, Shape, Allocator> const& costs, Changed const& changed) -> size_type;
+
+  private:
+    // Returns the direction of steepest descent at index.
+    [[nodiscard]] constexpr auto descent(std::uint32_t index) const noexcept -> direction_type;
+    // Adds index to the positions whose distance is recomputed, if it is not already.
+    constexpr void touch(std::uint32_t index);
+
+    grid<Dist, Shape>                         m_distances;
+    grid<direction_type, Shape>               m_directions;
+    neighbor_table<>                          m_neighbors;
+    detail::indexed_heap<Dist, std::uint32_t> m_open;
+    std::vector<std::uint32_t>                m_touched;
+    std::vector<bool>                         m_is_touched;
+    std::vector<std::uint32_t>                m_frontier;
+    std::vector<std::uint32_t>                m_lowered;
+};
+} // namespace hex
+
+// ------------------------------ implementation below ------------------------------
+
+template<hex::grid_shape Shape, std::unsigned_integral Dist>
+constexpr hex::flow_field<Shape, Dist>::flow_field(grid<Dist, Shape> distances)
+    : m_distances(std::move(distances))
+    , m_directions(m_distances.shape())
+    , m_neighbors(m_distances.shape())
+    , m_is_touched(m_distances.size())
+{
+    m_open.resize(m_distances.size());
+    auto* const directions = m_directions.data();
+    for (std::uint32_t index = 0; index < m_distances.size(); ++index)
+        directions[index] = descent(index);
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Dist>
+constexpr auto hex::flow_field<Shape, Dist>::operator[](key_type const& position) const -> direction_type
+{
+    return m_directions[position];
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Dist>
+constexpr auto hex::flow_field<Shape, Dist>::directions() const noexcept -> grid<direction_type, Shape> const&
+{
+    return m_directions;
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Dist>
+constexpr auto hex::flow_field<Shape, Dist>::distances() const noexcept -> grid<Dist, Shape> const&
+{
+    return m_distances;
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Dist>
+template<std::unsigned_integral T, class Allocator, std::ranges::input_range Changed>
+constexpr auto hex::flow_field<Shape, Dist>::update(grid<T, Shape, Allocator> const& costs, Changed const& changed)
+    -> size_type
+{
+    if (costs.shape() != m_distances.shape())
+        throw std::invalid_argument("costs shape does not match flow field shape");
+
+    auto const* const values            = costs.data();
+    auto* const       distances         = m_distances.data();
+    auto* const       directions        = m_directions.data();
+    auto const        no_neighbor       = neighbor_table<>::no_neighbor;
+    auto const        cheapest_neighbor = [&](std::uint32_t index)
+    {
+        auto result = unreachable;
+        for (auto const next : m_neighbors[index])
+        {
+            if (next != no_neighbor && distances[next] < result)
+                result = distances[next];
+        }
+        return result;
+    };
+    auto const candidate = [&](std::uint32_t index)
+    {
+        auto const cheapest = cheapest_neighbor(index);
+        if (values[index] == 0 || cheapest == unreachable)
+            return unreachable;
+        return static_cast<Dist>(cheapest + values[index]);
+    };
+
+    // Invalidate everything downstream of the changed positions that got more expensive first. Lowering a position
+    // before all invalidations are done could seed it from a neighbor that is invalidated later, which the walk below
+    // would not reach because the direction of the seeded position is not set yet.
+    m_lowered.clear();
+    for (auto const& position : changed)
+    {
+        if (!m_distances.contains(position))
+            continue;
+        auto const index = static_cast<std::uint32_t>(m_distances.shape()[position]);
+        if (distances[index] == 0)
+            continue;
+        if (auto const lowered = candidate(index); lowered <= distances[index])
+        {
+            if (lowered < distances[index])
+                m_lowered.push_back(index);
+            continue;
+        }
+
+        m_frontier.assign(1, index);
+        distances[index] = unreachable;
+        while (!m_frontier.empty())
+        {
+            auto const parent = m_frontier.back();
+            m_frontier.pop_back();
+            touch(parent);
+            m_open.erase(parent);
+            for (std::size_t d = 0; d < 6; ++d)
+            {
+                auto const child = m_neighbors[parent][d];
+                if (child == no_neighbor || distances[child] == unreachable || directions[child] != (d + 3) % 6)
+                    continue;
+                distances[child] = unreachable;
+                m_frontier.push_back(child);
+            }
+        }
+    }
+
+    // Lower the distances of changed positions that got cheaper and seed the invalidated positions, both from the
+    // valid positions around them, then propagate with Dijkstra's algorithm.
+    for (auto const index : m_lowered)
+    {
+        if (auto const lowered = candidate(index); lowered < distances[index])
+        {
+            distances[index] = lowered;
+            m_open.push_or_update(index, lowered);
+            touch(index);
+        }
+    }
+    for (auto const index : m_touched)
+    {
+        if (distances[index] != unreachable)
+            continue;
+        if (auto const seed = candidate(index); seed != unreachable)
+        {
+            distances[index] = seed;
+            m_open.push_or_update(index, seed);
+        }
+    }
+    while (!m_open.empty())
+    {
+        auto const [distance, index] = m_open.pop();
+        for (auto const next : m_neighbors[index])
+        {
+            if (next == no_neighbor || values[next] == 0 || distances[next] == 0)
+                continue;
+            auto const next_distance = static_cast<Dist>(distance + values[next]);
+            if (next_distance < distances[next])
+            {
+                distances[next] = next_distance;
+                m_open.push_or_update(next, next_distance);
+                touch(next);
+            }
+        }
+    }
+
+    // Recompute the directions around every position whose distance changed.
+    auto const recomputed = m_touched.size();
+    for (auto const index : m_touched)
+    {
+        directions[index] = descent(index);
+        for (auto const next : m_neighbors[index])
+        {
+            if (next != no_neighbor)
+                directions[next] = descent(next);
+        }
+        m_is_touched[index] = false;
+    }
+    m_touched.clear();
+    return recomputed;
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Dist>
+constexpr auto hex::flow_field<Shape, Dist>::descent(std::uint32_t index) const noexcept -> direction_type
+{
+    auto const* const distances = m_distances.data();
+    auto              best      = distances[index];
+    auto              result    = none;
+    if (best == unreachable)
+        return none;
+    for (std::uint8_t d = 0; d < 6; ++d)
+    {
+        auto const next = m_neighbors[index][d];
+        if (next != neighbor_table<>::no_neighbor && distances[next] < best)
+        {
+            best   = distances[next];
+            result = d;
+        }
+    }
+    return result;
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Dist>
+constexpr void hex::flow_field<Shape, Dist>::touch(std::uint32_t index)
+{
+    if (!m_is_touched[index])
+    {
+        m_is_touched[index] = true;
+        m_touched.push_back(index);
+    }
+}
+
+#endif // HEX_FLOW_FIELD_HPP
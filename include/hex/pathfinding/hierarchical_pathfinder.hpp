@@ -0,0 +1,668 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_HIERARCHICAL_PATHFINDER_HPP
+#define HEX_HIERARCHICAL_PATHFINDER_HPP
+
+#include "hex/grid/grid.hpp"
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/pathfinding/detail/detail_cluster_lattice.hpp"
+#include "hex/pathfinding/detail/detail_generation_stamps.hpp"
+#include "hex/pathfinding/detail/detail_indexed_heap.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hex
+{
+namespace detail
+{
+// The costs and parents of one search over the indices in [0, size), reset in O(1) between searches through
+// generation_stamps.
+template<typename Cost, typename Priority>
+class search_state
+{
+  public:
+    constexpr void resize(std::size_t size);
+    // Forgets all reached indices and empties the queue.
+    constexpr void restart();
+
+    [[nodiscard]] constexpr auto reached(std::uint32_t index) const noexcept -> bool;
+    constexpr void               reach(std::uint32_t index, Cost at, std::uint32_t from) noexcept;
+
+    std::vector<Cost>                     cost;   // NOLINT(misc-non-private-member-variables-in-classes)
+    std::vector<std::uint32_t>            parent; // NOLINT(misc-non-private-member-variables-in-classes)
+    indexed_heap<Priority, std::uint32_t> open;   // NOLINT(misc-non-private-member-variables-in-classes)
+
+  private:
+    generation_stamps<> m_reached;
+};
+} // namespace detail
+
+// Finds paths on large grids in two levels (HPA*). The shape is partitioned into clusters, the regular hexagons of a
+// radius that tile the plane, and every contiguous passable stretch of the border between two clusters gets one
+// transition, a pair of neighboring positions across it. The costs between the transitions of every cluster are
+// precomputed, so that a query searches the graph of transitions and then refines each step of its result within a
+// single cluster. Paths are close to but not always cheapest, as they only cross borders at transitions. Costs have the
+// meaning of the costs of distance_field(): the cost of entering a position, or 0 if it cannot be entered. The costs
+// passed to every call must be the ones the pathfinder was built with, including all changes reported to update().
+template<grid_shape Shape, std::unsigned_integral Cost = std::uint32_t>
+class hierarchical_pathfinder
+{
+  public:
+    using shape_type      = Shape;
+    using key_type        = std::ranges::range_value_t<Shape>;
+    using coordinate_type = typename key_type::mapped_type;
+    using cost_type       = Cost;
+    using size_type       = std::size_t;
+
+    // Partitions the shape of costs into clusters of the given radius and precomputes their transitions and the costs
+    // between them. Throws std::invalid_argument if cluster_radius is less than 1.
+    template<std::unsigned_integral T, class Allocator>
+    constexpr hierarchical_pathfinder(grid<T, Shape, Allocator> const& costs, coordinate_type cluster_radius);
+
+    [[nodiscard]] constexpr auto cluster_count() const noexcept -> size_type;
+    // Returns the cluster containing position. UB if position is not in the shape.
+    [[nodiscard]] constexpr auto cluster_of(key_type const& position) const -> size_type;
+    // Returns the hexagon of a cluster. Clusters at the edge of the shape contain only the positions in both. UB if
+    // cluster >= cluster_count().
+    [[nodiscard]] constexpr auto cluster_parameters(size_type cluster) const
+        -> convex_polygon_parameters<coordinate_type>;
+    // Returns the number of positions on either side of a transition, the nodes of the abstract graph.
+    [[nodiscard]] constexpr auto transition_count() const noexcept -> size_type;
+    // Returns the number of nodes of the abstract graph expanded by the last find_path().
+    [[nodiscard]] constexpr auto expanded() const noexcept -> size_type;
+
+    // Rebuilds the transitions around the clusters containing the changed positions after their costs have changed to
+    // their values in costs, and the transition costs of every cluster whose transitions have changed. Returns the
+    // number of clusters whose transition costs were recomputed. Throws std::invalid_argument if costs is not a grid
+    // over the shape.
+    template<std::unsigned_integral T, class Allocator, std::ranges::input_range Changed>
+    constexpr auto update(grid<T, Shape, Allocator> const& costs, Changed const& changed) -> size_type;
+
+    // Finds a path from from to to through the transitions. On success, replaces the contents of path with the
+    // positions from from to to, inclusive, and returns the cost of the path; otherwise, clears path and returns
+    // std::nullopt. Does not allocate unless path or the internal buffers have to grow. Throws std::invalid_argument
+    // if costs is not a grid over the shape.
+    template<std::unsigned_integral T, class Allocator>
+    constexpr auto find_path(grid<T, Shape, Allocator> const& costs,
+                             key_type const&                  from,
+                             key_type const&                  to,
+                             std::vector<key_type>&           path) -> std::optional<Cost>;
+
+  private:
+    static constexpr std::uint32_t none        = std::numeric_limits<std::uint32_t>::max();
+    static constexpr Cost          unreachable = std::numeric_limits<Cost>::max();
+
+    // A step across the border of a cluster, from a position inside to one in the neighboring cluster.
+    struct link
+    {
+        std::uint32_t from;
+        std::uint32_t to;
+
+        [[nodiscard]] constexpr auto operator==(link const& other) const noexcept -> bool = default;
+    };
+
+    // An edge of the abstract graph that only exists for one query, from or to one of its ends.
+    struct edge
+    {
+        std::uint32_t from;
+        std::uint32_t to;
+        Cost          cost;
+    };
+
+    struct cluster
+    {
+        key_type                         center;
+        std::array<std::uint32_t, 6>     neighbors{}; // Ordered as the directions of the lattice, or none.
+        std::array<std::vector<link>, 6> links;       // The transitions to each neighbor.
+        std::vector<std::uint32_t>       transitions; // The distinct positions of links inside this cluster.
+        std::vector<Cost>                costs;       // Between transitions, row-major by origin, or unreachable.
+    };
+
+    // Returns the positions of a cluster.
+    [[nodiscard]] constexpr auto tiles(std::uint32_t cluster) const noexcept -> std::span<std::uint32_t const>;
+    // Returns true if a and b are the same or neighboring positions.
+    [[nodiscard]] constexpr auto touching(std::uint32_t a, std::uint32_t b) const noexcept -> bool;
+
+    // Recomputes the transitions between cluster and its neighbor in direction, on both sides. Returns true if they
+    // have changed. UB if there is no neighbor in direction.
+    template<std::unsigned_integral T>
+    constexpr auto rebuild_links(T const* values, std::uint32_t cluster, std::size_t direction) -> bool;
+    // Recomputes the costs between the transitions of cluster.
+    template<std::unsigned_integral T>
+    constexpr void rebuild_costs(T const* values, std::uint32_t cluster);
+    // Runs Dijkstra's algorithm from source within its cluster until stop is settled, following the costs of entering
+    // positions, or, if backward, their reverse, so that the costs are those of reaching source.
+    template<std::unsigned_integral T>
+    constexpr void search_cluster(T const* values, std::uint32_t source, bool backward, std::uint32_t stop = none);
+
+    Shape                                              m_shape;
+    coordinate_type                                    m_radius;
+    neighbor_table<>                                   m_neighbors;
+    std::vector<key_type>                              m_positions;
+    std::vector<std::uint32_t>                         m_cluster_of;
+    std::vector<std::uint32_t>                         m_cluster_begin;
+    std::vector<std::uint32_t>                         m_cluster_tiles;
+    std::vector<cluster>                               m_clusters;
+    std::vector<std::uint32_t>                         m_transition_slot;
+    detail::search_state<Cost, Cost>                   m_local;
+    detail::search_state<Cost, std::pair<Cost, Cost>> m_global;
+    size_type                                          m_expanded = 0;
+
+    // Buffers reused between calls.
+    std::vector<link>          m_crossings;
+    std::vector<std::uint32_t> m_labels;
+    std::vector<std::uint32_t> m_stack;
+    std::vector<link>          m_links;
+    std::vector<edge>          m_edges;
+    std::vector<std::uint32_t> m_nodes;
+    std::vector<std::uint8_t>  m_dirty;
+    std::vector<std::uint32_t> m_dirty_clusters;
+};
+} // namespace hex
+
+// ------------------------------ implementation below ------------------------------
+
+template<typename Cost, typename Priority>
+constexpr void hex::detail::search_state<Cost, Priority>::resize(std::size_t size)
+{
+    cost.resize(size);
+    parent.resize(size);
+    open.resize(size);
+    m_reached.resize(size);
+}
+
+template<typename Cost, typename Priority>
+constexpr void hex::detail::search_state<Cost, Priority>::restart()
+{
+    open.clear();
+    m_reached.next_generation();
+}
+
+template<typename Cost, typename Priority>
+constexpr auto hex::detail::search_state<Cost, Priority>::reached(std::uint32_t index) const noexcept -> bool
+{
+    return m_reached.marked(index);
+}
+
+template<typename Cost, typename Priority>
+constexpr void hex::detail::search_state<Cost, Priority>::reach(std::uint32_t index,
+                                                                Cost          at,
+                                                                std::uint32_t from) noexcept
+{
+    m_reached.mark(index);
+    cost[index]   = at;
+    parent[index] = from;
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+template<std::unsigned_integral T, class Allocator>
+constexpr hex::hierarchical_pathfinder<Shape, Cost>::hierarchical_pathfinder(grid<T, Shape, Allocator> const& costs,
+                                                                             coordinate_type cluster_radius)
+    : m_shape(costs.shape())
+    , m_radius(cluster_radius)
+    , m_neighbors(costs.shape())
+    , m_positions(std::ranges::begin(costs.shape()), std::ranges::end(costs.shape()))
+    , m_cluster_of(m_positions.size())
+    , m_transition_slot(m_positions.size(), none)
+{
+    if (cluster_radius < 1)
+        throw std::invalid_argument("cluster radius must be at least 1");
+
+    // Assign every position to the hexagon of the lattice containing it, numbering the hexagons as they are found.
+    detail::cluster_lattice<coordinate_type> const                 lattice(cluster_radius);
+    std::map<detail::cluster_cell<coordinate_type>, std::uint32_t> ids;
+    std::vector<detail::cluster_cell<coordinate_type>>             cells;
+    for (std::uint32_t index = 0; index < m_positions.size(); ++index)
+    {
+        auto const cell          = lattice.cell_of(m_positions[index]);
+        auto const [it, created] = ids.try_emplace(cell, static_cast<std::uint32_t>(cells.size()));
+        if (created)
+            cells.push_back(cell);
+        m_cluster_of[index] = it->second;
+    }
+
+    m_clusters.resize(cells.size());
+    for (std::size_t c = 0; c < cells.size(); ++c)
+    {
+        m_clusters[c].center = lattice.center(cells[c]);
+        for (std::size_t d = 0; d < 6; ++d)
+        {
+            auto const& direction = detail::cluster_lattice<coordinate_type>::directions[d];
+            auto const  it        = ids.find({static_cast<coordinate_type>(cells[c].a + direction.a),
+                                              static_cast<coordinate_type>(cells[c].b + direction.b)});
+            m_clusters[c].neighbors[d] = it == ids.end() ? none : it->second;
+        }
+    }
+
+    // Group the positions by cluster.
+    m_cluster_begin.assign(cells.size() + 1, 0);
+    for (auto const c : m_cluster_of)
+        ++m_cluster_begin[c + 1];
+    std::partial_sum(m_cluster_begin.begin(), m_cluster_begin.end(), m_cluster_begin.begin());
+    m_cluster_tiles.resize(m_positions.size());
+    auto next = m_cluster_begin;
+    for (std::uint32_t index = 0; index < m_positions.size(); ++index)
+        m_cluster_tiles[next[m_cluster_of[index]]++] = index;
+
+    m_local.resize(m_positions.size());
+    m_global.resize(m_positions.size());
+    m_dirty.resize(m_clusters.size());
+    auto const* const values = costs.data();
+    for (std::uint32_t c = 0; c < m_clusters.size(); ++c)
+    {
+        for (std::size_t d = 0; d < 6; ++d)
+        {
+            if (auto const neighbor = m_clusters[c].neighbors[d]; neighbor != none && neighbor > c)
+                rebuild_links(values, c, d);
+        }
+    }
+    for (std::uint32_t c = 0; c < m_clusters.size(); ++c)
+        rebuild_costs(values, c);
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr auto hex::hierarchical_pathfinder<Shape, Cost>::cluster_count() const noexcept -> size_type
+{
+    return m_clusters.size();
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr auto hex::hierarchical_pathfinder<Shape, Cost>::cluster_of(key_type const& position) const -> size_type
+{
+    return m_cluster_of[static_cast<std::size_t>(m_shape[position])];
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr auto hex::hierarchical_pathfinder<Shape, Cost>::cluster_parameters(size_type cluster) const
+    -> convex_polygon_parameters<coordinate_type>
+{
+    return make_regular_hexagon_parameters(m_radius, m_clusters[cluster].center);
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr auto hex::hierarchical_pathfinder<Shape, Cost>::transition_count() const noexcept -> size_type
+{
+    size_type result = 0;
+    for (auto const& c : m_clusters)
+        result += c.transitions.size();
+    return result;
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr auto hex::hierarchical_pathfinder<Shape, Cost>::expanded() const noexcept -> size_type
+{
+    return m_expanded;
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+template<std::unsigned_integral T, class Allocator, std::ranges::input_range Changed>
+constexpr auto hex::hierarchical_pathfinder<Shape, Cost>::update(grid<T, Shape, Allocator> const& costs,
+                                                                 Changed const&                   changed) -> size_type
+{
+    if (costs.shape() != m_shape)
+        throw std::invalid_argument("costs shape does not match pathfinder shape");
+
+    // Clusters containing a changed position are marked changed, their neighbors whose transitions change as a result
+    // are marked affected. Both need their costs recomputed.
+    auto const* const  values          = costs.data();
+    std::uint8_t const marked_changed  = 1;
+    std::uint8_t const marked_affected = 2;
+    for (auto const& position : changed)
+    {
+        if (!costs.contains(position))
+            continue;
+        auto const c = m_cluster_of[static_cast<std::size_t>(m_shape[position])];
+        if (m_dirty[c] == 0)
+        {
+            m_dirty[c] = marked_changed;
+            m_dirty_clusters.push_back(c);
+        }
+    }
+
+    // Rebuild every border of a changed cluster once.
+    auto const dirty = m_dirty_clusters.size();
+    for (std::size_t i = 0; i < dirty; ++i)
+    {
+        auto const c = m_dirty_clusters[i];
+        for (std::size_t d = 0; d < 6; ++d)
+        {
+            auto const neighbor = m_clusters[c].neighbors[d];
+            if (neighbor == none || (neighbor < c && m_dirty[neighbor] == marked_changed))
+                continue;
+            if (rebuild_links(values, c, d) && m_dirty[neighbor] == 0)
+            {
+                m_dirty[neighbor] = marked_affected;
+                m_dirty_clusters.push_back(neighbor);
+            }
+        }
+    }
+
+    auto const rebuilt = m_dirty_clusters.size();
+    for (auto const c : m_dirty_clusters)
+    {
+        rebuild_costs(values, c);
+        m_dirty[c] = 0;
+    }
+    m_dirty_clusters.clear();
+    return rebuilt;
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+template<std::unsigned_integral T, class Allocator>
+constexpr auto hex::hierarchical_pathfinder<Shape, Cost>::find_path(grid<T, Shape, Allocator> const& costs,
+                                                                    key_type const&                  from,
+                                                                    key_type const&                  to,
+                                                                    std::vector<key_type>& path) -> std::optional<Cost>
+{
+    if (costs.shape() != m_shape)
+        throw std::invalid_argument("costs shape does not match pathfinder shape");
+
+    path.clear();
+    m_expanded = 0;
+    if (!costs.contains(from) || !costs.contains(to))
+        return std::nullopt;
+
+    auto const* const values = costs.data();
+    auto const        start  = static_cast<std::uint32_t>(m_shape[from]);
+    auto const        goal   = static_cast<std::uint32_t>(m_shape[to]);
+    if (start == goal)
+    {
+        path.push_back(from);
+        return Cost{};
+    }
+    if (values[goal] == 0)
+        return std::nullopt;
+
+    // Connect start to the transitions of its cluster, and to its neighbors in other clusters, which it may step to
+    // even if it cannot be entered itself, and those to the transitions of their clusters. Connect the transitions of
+    // the goal's cluster to goal.
+    auto const goal_cluster = m_cluster_of[goal];
+    auto const connect      = [&](std::uint32_t source)
+    {
+        search_cluster(values, source, false);
+        for (auto const t : m_clusters[m_cluster_of[source]].transitions)
+        {
+            if (m_local.reached(t))
+                m_edges.push_back({source, t, m_local.cost[t]});
+        }
+        if (m_cluster_of[source] == goal_cluster && m_local.reached(goal))
+            m_edges.push_back({source, goal, m_local.cost[goal]});
+    };
+    m_edges.clear();
+    connect(start);
+    for (auto const next : m_neighbors[start])
+    {
+        if (next == neighbor_table<>::no_neighbor || m_cluster_of[next] == m_cluster_of[start] || values[next] == 0)
+            continue;
+        m_edges.push_back({start, next, static_cast<Cost>(values[next])});
+        connect(next);
+    }
+    search_cluster(values, goal, true);
+    for (auto const t : m_clusters[goal_cluster].transitions)
+    {
+        if (m_local.reached(t))
+            m_edges.push_back({t, goal, m_local.cost[t]});
+    }
+    std::ranges::sort(m_edges, {}, &edge::from);
+
+    // Search the abstract graph with A*. Every step costs at least 1, so distance() is a consistent heuristic.
+    auto& global    = m_global;
+    auto  heuristic = [&](std::uint32_t index) { return static_cast<Cost>(distance(m_positions[index], to)); };
+    auto  relax     = [&](std::uint32_t current, std::uint32_t next, Cost step)
+    {
+        auto const next_cost = static_cast<Cost>(global.cost[current] + step);
+        if (global.reached(next) && !(next_cost < global.cost[next]))
+            return;
+        global.reach(next, next_cost, current);
+        auto const h = heuristic(next);
+        global.open.push_or_update(next, {static_cast<Cost>(next_cost + h), h});
+    };
+    global.restart();
+    global.reach(start, Cost{}, start);
+    global.open.push_or_update(start, {heuristic(start), heuristic(start)});
+    while (!global.open.empty() && global.open.top().index != goal)
+    {
+        auto const current = global.open.pop().index;
+        ++m_expanded;
+
+        for (auto const& e : std::ranges::equal_range(m_edges, current, {}, &edge::from))
+            relax(current, e.to, e.cost);
+        if (auto const slot = m_transition_slot[current]; slot != none)
+        {
+            auto const& c     = m_clusters[m_cluster_of[current]];
+            auto const  count = c.transitions.size();
+            for (std::size_t other = 0; other < count; ++other)
+            {
+                if (auto const step = c.costs[(slot * count) + other]; other != slot && step != unreachable)
+                    relax(current, c.transitions[other], step);
+            }
+            for (auto const& links : c.links)
+            {
+                for (auto const& l : links)
+                {
+                    if (l.from == current)
+                        relax(current, l.to, static_cast<Cost>(values[l.to]));
+                }
+            }
+        }
+    }
+    if (global.open.empty())
+        return std::nullopt;
+
+    // Refine every step between two positions of the same cluster with a search within it.
+    m_nodes.clear();
+    for (auto index = goal; index != start; index = global.parent[index])
+        m_nodes.push_back(index);
+    m_nodes.push_back(start);
+    std::ranges::reverse(m_nodes);
+
+    auto total = Cost{};
+    path.push_back(from);
+    for (std::size_t i = 1; i < m_nodes.size(); ++i)
+    {
+        auto const previous = m_nodes[i - 1];
+        auto const current  = m_nodes[i];
+        if (m_cluster_of[previous] != m_cluster_of[current])
+        {
+            path.push_back(m_positions[current]);
+            total = static_cast<Cost>(total + values[current]);
+            continue;
+        }
+        search_cluster(values, previous, false, current);
+        auto const first = path.size();
+        for (auto index = current; index != previous; index = m_local.parent[index])
+            path.push_back(m_positions[index]);
+        std::reverse(path.begin() + static_cast<std::ptrdiff_t>(first), path.end());
+        total = static_cast<Cost>(total + m_local.cost[current]);
+    }
+    return total;
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr auto hex::hierarchical_pathfinder<Shape, Cost>::tiles(std::uint32_t cluster) const noexcept
+    -> std::span<std::uint32_t const>
+{
+    return std::span(m_cluster_tiles).subspan(m_cluster_begin[cluster],
+                                              m_cluster_begin[cluster + 1] - m_cluster_begin[cluster]);
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr auto hex::hierarchical_pathfinder<Shape, Cost>::touching(std::uint32_t a, std::uint32_t b) const noexcept
+    -> bool
+{
+    return a == b || std::ranges::find(m_neighbors[a], b) != m_neighbors[a].end();
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+template<std::unsigned_integral T>
+constexpr auto hex::hierarchical_pathfinder<Shape, Cost>::rebuild_links(T const*      values,
+                                                                        std::uint32_t cluster,
+                                                                        std::size_t   direction) -> bool
+{
+    // Always build a border from the same side, so that the transitions do not depend on the order of updates.
+    auto const neighbor = m_clusters[cluster].neighbors[direction];
+    if (neighbor < cluster)
+        return rebuild_links(values, neighbor, (direction + 3) % 6);
+
+    // Collect the passable steps across the border, sorted by position, which orders them along the border.
+    m_crossings.clear();
+    for (auto const index : tiles(cluster))
+    {
+        if (values[index] == 0)
+            continue;
+        for (auto const next : m_neighbors[index])
+        {
+            if (next != neighbor_table<>::no_neighbor && m_cluster_of[next] == neighbor && values[next] != 0)
+                m_crossings.push_back({index, next});
+        }
+    }
+    std::ranges::sort(m_crossings, {}, [](link const& l) { return std::pair(l.from, l.to); });
+
+    // Split the steps into stretches that are contiguous on both sides, and take the middle step of each.
+    m_links.clear();
+    m_labels.assign(m_crossings.size(), none);
+    for (std::size_t first = 0; first < m_crossings.size(); ++first)
+    {
+        if (m_labels[first] != none)
+            continue;
+        auto const label = static_cast<std::uint32_t>(first);
+        std::size_t members = 1;
+        m_labels[first] = label;
+        m_stack.assign(1, label);
+        while (!m_stack.empty())
+        {
+            auto const e = m_crossings[m_stack.back()];
+            m_stack.pop_back();
+            for (std::size_t other = first + 1; other < m_crossings.size(); ++other)
+            {
+                auto const& candidate = m_crossings[other];
+                if (m_labels[other] == none && touching(e.from, candidate.from) && touching(e.to, candidate.to))
+                {
+                    m_labels[other] = label;
+                    m_stack.push_back(static_cast<std::uint32_t>(other));
+                    ++members;
+                }
+            }
+        }
+        for (std::size_t e = first, seen = 0; e < m_crossings.size(); ++e)
+        {
+            if (m_labels[e] == label && seen++ == members / 2)
+            {
+                m_links.push_back(m_crossings[e]);
+                break;
+            }
+        }
+    }
+
+    auto& links = m_clusters[cluster].links[direction];
+    if (std::ranges::equal(links, m_links))
+        return false;
+    links.assign(m_links.begin(), m_links.end());
+    auto& mirrored = m_clusters[neighbor].links[(direction + 3) % 6];
+    mirrored.clear();
+    for (auto const& l : m_links)
+        mirrored.push_back({l.to, l.from});
+    return true;
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+template<std::unsigned_integral T>
+constexpr void hex::hierarchical_pathfinder<Shape, Cost>::rebuild_costs(T const* values, std::uint32_t cluster)
+{
+    auto& c = m_clusters[cluster];
+    for (auto const t : c.transitions)
+        m_transition_slot[t] = none;
+    c.transitions.clear();
+    for (auto const& links : c.links)
+    {
+        for (auto const& l : links)
+        {
+            if (m_transition_slot[l.from] == none)
+            {
+                m_transition_slot[l.from] = static_cast<std::uint32_t>(c.transitions.size());
+                c.transitions.push_back(l.from);
+            }
+        }
+    }
+
+    auto const count = c.transitions.size();
+    c.costs.assign(count * count, unreachable);
+    for (std::size_t from = 0; from < count; ++from)
+    {
+        search_cluster(values, c.transitions[from], false);
+        for (std::size_t to = 0; to < count; ++to)
+        {
+            if (m_local.reached(c.transitions[to]))
+                c.costs[(from * count) + to] = m_local.cost[c.transitions[to]];
+        }
+    }
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+template<std::unsigned_integral T>
+constexpr void hex::hierarchical_pathfinder<Shape, Cost>::search_cluster(T const*      values,
+                                                                         std::uint32_t source,
+                                                                         bool          backward,
+                                                                         std::uint32_t stop)
+{
+    auto const cluster = m_cluster_of[source];
+    m_local.restart();
+    m_local.reach(source, Cost{}, source);
+    m_local.open.push_or_update(source, Cost{});
+    while (!m_local.open.empty())
+    {
+        auto const [cost, current] = m_local.open.pop();
+        if (current == stop)
+            return;
+        for (auto const next : m_neighbors[current])
+        {
+            if (next == neighbor_table<>::no_neighbor || m_cluster_of[next] != cluster || values[next] == 0)
+                continue;
+            auto const next_cost = static_cast<Cost>(cost + (backward ? values[current] : values[next]));
+            if (m_local.reached(next) && !(next_cost < m_local.cost[next]))
+                continue;
+            m_local.reach(next, next_cost, current);
+            m_local.open.push_or_update(next, next_cost);
+        }
+    }
+}
+
+#endif // HEX_HIERARCHICAL_PATHFINDER_HPP
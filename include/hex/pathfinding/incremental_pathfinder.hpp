@@ -0,0 +1,333 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_INCREMENTAL_PATHFINDER_HPP
+#define HEX_INCREMENTAL_PATHFINDER_HPP
+
+#include "hex/grid/grid.hpp"
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/pathfinding/detail/detail_indexed_heap.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hex
+{
+// Plans cheapest paths to a fixed goal from a start that may move, keeping its search state between plans so that only
+// the part of the search affected by changed costs is repeated (D* Lite). The search runs backwards from the goal, so
+// moving the start along the path invalidates nothing. Costs have the meaning of the costs of distance_field(): the
+// cost of entering a position, or 0 if it cannot be entered. The costs passed to every call must be the ones the
+// pathfinder was built with, including all changes reported to update().
+template<grid_shape Shape, std::unsigned_integral Cost = std::uint32_t>
+class incremental_pathfinder
+{
+  public:
+    using shape_type = Shape;
+    using key_type   = std::ranges::range_value_t<Shape>;
+    using cost_type  = Cost;
+    using size_type  = std::size_t;
+
+    // Prepares planning from start to goal. The first find_path() performs the full search. Throws
+    // std::invalid_argument if start or goal is not in the shape of costs.
+    template<std::unsigned_integral T, class Allocator>
+    constexpr incremental_pathfinder(grid<T, Shape, Allocator> const& costs,
+                                     key_type const&                  start,
+                                     key_type const&                  goal);
+
+    [[nodiscard]] constexpr auto start() const noexcept -> key_type const&;
+    [[nodiscard]] constexpr auto goal() const noexcept -> key_type const&;
+    // Returns the number of positions expanded by the last find_path().
+    [[nodiscard]] constexpr auto expanded() const noexcept -> size_type;
+
+    // Moves the start, usually to the next position of the last path. UB if start is not in the shape.
+    constexpr void move_start(key_type const& start);
+
+    // Records that the costs of the changed positions have changed to their values in costs. The search is repaired by
+    // the next find_path(). Throws std::invalid_argument if costs is not a grid over the shape.
+    template<std::unsigned_integral T, class Allocator, std::ranges::input_range Changed>
+    constexpr void update(grid<T, Shape, Allocator> const& costs, Changed const& changed);
+
+    // Finds a cheapest path from start() to goal(), continuing the search from its state after the last call. On
+    // success, replaces the contents of path with the positions from start() to goal(), inclusive, and returns the cost
+    // of the path; otherwise, clears path and returns std::nullopt. Does not allocate unless path has to grow. Throws
+    // std::invalid_argument if costs is not a grid over the shape.
+    template<std::unsigned_integral T, class Allocator>
+    constexpr auto find_path(grid<T, Shape, Allocator> const& costs, std::vector<key_type>& path)
+        -> std::optional<Cost>;
+
+  private:
+    static constexpr Cost unreachable = std::numeric_limits<Cost>::max();
+
+    using key = std::pair<Cost, Cost>;
+
+    // Returns a + b, or unreachable if either is.
+    [[nodiscard]] static constexpr auto add(Cost a, Cost b) noexcept -> Cost;
+    // Returns the cost of stepping from a position to next, or unreachable if next cannot be entered.
+    template<std::unsigned_integral T>
+    [[nodiscard]] static constexpr auto step(T const* values, std::uint32_t next) noexcept -> Cost;
+
+    // The queue is ordered by lower bounds of the cost of paths from the start through each position. When the start
+    // has moved, offsets the priorities computed from now on by the distance it has moved, which keeps the priorities
+    // already queued comparable to them instead of requeueing everything.
+    constexpr void rebase() noexcept;
+    // Returns the priority of index in the queue.
+    [[nodiscard]] constexpr auto key_of(std::uint32_t index) const noexcept -> key;
+    // Returns the cheapest cost of reaching the goal from index through one of its neighbors.
+    template<std::unsigned_integral T>
+    [[nodiscard]] constexpr auto lookahead(T const* values, std::uint32_t index) const noexcept -> Cost;
+    // Queues index if its cost is not consistent with its lookahead, and removes it from the queue otherwise.
+    constexpr void enqueue(std::uint32_t index) noexcept;
+
+    Shape                                    m_shape;
+    neighbor_table<>                         m_neighbors;
+    std::vector<key_type>                    m_positions;
+    std::vector<Cost>                        m_cost;
+    std::vector<Cost>                        m_lookahead;
+    detail::indexed_heap<key, std::uint32_t> m_open;
+    std::uint32_t                            m_start;
+    std::uint32_t                            m_goal;
+    std::uint32_t                            m_last_start;
+    Cost                                     m_key_offset = 0;
+    size_type                                m_expanded   = 0;
+};
+} // namespace hex
+
+// ------------------------------ implementation below ------------------------------
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+template<std::unsigned_integral T, class Allocator>
+constexpr hex::incremental_pathfinder<Shape, Cost>::incremental_pathfinder(grid<T, Shape, Allocator> const& costs,
+                                                                           key_type const&                  start,
+                                                                           key_type const&                  goal)
+    : m_shape(costs.shape())
+    , m_neighbors(m_shape)
+    , m_positions(std::ranges::begin(m_shape), std::ranges::end(m_shape))
+    , m_cost(m_positions.size(), unreachable)
+    , m_lookahead(m_positions.size(), unreachable)
+{
+    if (!costs.contains(start) || !costs.contains(goal))
+        throw std::invalid_argument("start and goal must be in the shape");
+
+    m_start      = static_cast<std::uint32_t>(m_shape[start]);
+    m_goal       = static_cast<std::uint32_t>(m_shape[goal]);
+    m_last_start = m_start;
+    m_open.resize(m_positions.size());
+    m_lookahead[m_goal] = 0;
+    enqueue(m_goal);
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr auto hex::incremental_pathfinder<Shape, Cost>::start() const noexcept -> key_type const&
+{
+    return m_positions[m_start];
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr auto hex::incremental_pathfinder<Shape, Cost>::goal() const noexcept -> key_type const&
+{
+    return m_positions[m_goal];
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr auto hex::incremental_pathfinder<Shape, Cost>::expanded() const noexcept -> size_type
+{
+    return m_expanded;
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr void hex::incremental_pathfinder<Shape, Cost>::move_start(key_type const& start)
+{
+    m_start = static_cast<std::uint32_t>(m_shape[start]);
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+template<std::unsigned_integral T, class Allocator, std::ranges::input_range Changed>
+constexpr void hex::incremental_pathfinder<Shape, Cost>::update(grid<T, Shape, Allocator> const& costs,
+                                                                Changed const&                   changed)
+{
+    if (costs.shape() != m_shape)
+        throw std::invalid_argument("costs shape does not match pathfinder shape");
+
+    rebase();
+
+    // Changing the cost of entering a position changes the lookahead of its neighbors.
+    auto const* const values = costs.data();
+    for (auto const& position : changed)
+    {
+        if (!costs.contains(position))
+            continue;
+        for (auto const index : m_neighbors[static_cast<std::size_t>(m_shape[position])])
+        {
+            if (index == neighbor_table<>::no_neighbor || index == m_goal)
+                continue;
+            m_lookahead[index] = lookahead(values, index);
+            enqueue(index);
+        }
+    }
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+template<std::unsigned_integral T, class Allocator>
+constexpr auto hex::incremental_pathfinder<Shape, Cost>::find_path(grid<T, Shape, Allocator> const& costs,
+                                                                   std::vector<key_type>& path) -> std::optional<Cost>
+{
+    if (costs.shape() != m_shape)
+        throw std::invalid_argument("costs shape does not match pathfinder shape");
+
+    // Expand positions until the start is consistent and no queued position can lead to a cheaper path from it.
+    rebase();
+    auto const* const values = costs.data();
+    m_expanded               = 0;
+    while (!m_open.empty()
+           && (m_open.top().priority < key_of(m_start) || m_lookahead[m_start] != m_cost[m_start]))
+    {
+        auto const [old_key, current] = m_open.top();
+        if (auto const new_key = key_of(current); old_key < new_key)
+        {
+            m_open.push_or_update(current, new_key);
+            continue;
+        }
+        m_open.pop();
+        ++m_expanded;
+        if (m_cost[current] > m_lookahead[current])
+        {
+            // Overconsistent: settle the cost, which can only lower the lookahead of the neighbors.
+            m_cost[current] = m_lookahead[current];
+            auto const through = add(m_cost[current], step(values, current));
+            for (auto const index : m_neighbors[current])
+            {
+                if (index == neighbor_table<>::no_neighbor || index == m_goal || !(through < m_lookahead[index]))
+                    continue;
+                m_lookahead[index] = through;
+                enqueue(index);
+            }
+        }
+        else
+        {
+            // Underconsistent: forget the cost, and recompute the lookahead of every neighbor that relied on it.
+            auto const through = add(m_cost[current], step(values, current));
+            m_cost[current]    = unreachable;
+            for (auto const index : m_neighbors[current])
+            {
+                if (index == neighbor_table<>::no_neighbor || index == m_goal || m_lookahead[index] != through)
+                    continue;
+                m_lookahead[index] = lookahead(values, index);
+                enqueue(index);
+            }
+            enqueue(current);
+        }
+    }
+
+    // Descend the costs from the start.
+    path.clear();
+    if (m_cost[m_start] == unreachable && m_start != m_goal)
+        return std::nullopt;
+    path.push_back(m_positions[m_start]);
+    for (auto current = m_start; current != m_goal;)
+    {
+        auto best = unreachable;
+        for (auto const index : m_neighbors[current])
+        {
+            if (index == neighbor_table<>::no_neighbor)
+                continue;
+            if (auto const through = add(m_cost[index], step(values, index)); through < best)
+            {
+                best    = through;
+                current = index;
+            }
+        }
+        if (best == unreachable)
+        {
+            path.clear();
+            return std::nullopt;
+        }
+        path.push_back(m_positions[current]);
+    }
+    return m_start == m_goal ? Cost{} : m_cost[m_start];
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr void hex::incremental_pathfinder<Shape, Cost>::rebase() noexcept
+{
+    m_key_offset = static_cast<Cost>(m_key_offset + distance(m_positions[m_last_start], m_positions[m_start]));
+    m_last_start = m_start;
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr auto hex::incremental_pathfinder<Shape, Cost>::add(Cost a, Cost b) noexcept -> Cost
+{
+    return a == unreachable || b == unreachable ? unreachable : static_cast<Cost>(a + b);
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+template<std::unsigned_integral T>
+constexpr auto hex::incremental_pathfinder<Shape, Cost>::step(T const* values, std::uint32_t next) noexcept -> Cost
+{
+    return values[next] == 0 ? unreachable : static_cast<Cost>(values[next]);
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr auto hex::incremental_pathfinder<Shape, Cost>::key_of(std::uint32_t index) const noexcept -> key
+{
+    auto const cost = std::min(m_cost[index], m_lookahead[index]);
+    if (cost == unreachable)
+        return {unreachable, unreachable};
+    auto const h = static_cast<Cost>(distance(m_positions[index], m_positions[m_start]));
+    return {static_cast<Cost>(cost + h + m_key_offset), cost};
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+template<std::unsigned_integral T>
+constexpr auto hex::incremental_pathfinder<Shape, Cost>::lookahead(T const* values, std::uint32_t index) const noexcept
+    -> Cost
+{
+    auto result = unreachable;
+    for (auto const next : m_neighbors[index])
+    {
+        if (next != neighbor_table<>::no_neighbor)
+            result = std::min(result, add(m_cost[next], step(values, next)));
+    }
+    return result;
+}
+
+template<hex::grid_shape Shape, std::unsigned_integral Cost>
+constexpr void hex::incremental_pathfinder<Shape, Cost>::enqueue(std::uint32_t index) noexcept
+{
+    if (m_cost[index] != m_lookahead[index])
+        m_open.push_or_update(index, key_of(index));
+    else
+        m_open.erase(index);
+}
+
+#endif // HEX_INCREMENTAL_PATHFINDER_HPP
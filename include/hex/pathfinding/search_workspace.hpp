@@ -0,0 +1,165 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_SEARCH_WORKSPACE_HPP
+#define HEX_SEARCH_WORKSPACE_HPP
+
+#include "hex/grid/grid.hpp"
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/pathfinding/detail/detail_generation_stamps.hpp"
+#include "hex/pathfinding/detail/detail_indexed_heap.hpp"
+
+#include <concepts>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hex
+{
+// Scratch state for repeated path searches over grids of one shape. All state is kept in flat arrays indexed by shape
+// index and is sized once on construction, so searches through the same workspace do not allocate. A new search
+// invalidates the previous one in O(1) instead of clearing the arrays. The workspace keeps a copy of its shape, so that
+// searches can check that they are given a grid of that shape.
+template<grid_shape Shape, typename Cost = std::uint32_t, std::unsigned_integral Index = std::uint32_t>
+class search_workspace
+{
+  public:
+    using shape_type = Shape;
+    using key_type   = std::ranges::range_value_t<Shape>;
+    using cost_type  = Cost;
+    using index_type = Index;
+    using size_type  = std::size_t;
+
+    // Initializes an empty workspace.
+    constexpr search_workspace() = default;
+
+    // Initializes a workspace for grids of the given shape. Throws std::length_error if the shape has too many elements
+    // to be indexed by index_type.
+    constexpr explicit search_workspace(Shape const& shape);
+
+    // Returns the size of the shape the workspace was built for.
+    [[nodiscard]] constexpr auto size() const noexcept -> size_type;
+    // Returns the neighbor table of the shape the workspace was built for.
+    [[nodiscard]] constexpr auto neighbors() const noexcept -> neighbor_table<Index> const&;
+    // Returns the number of positions expanded by the last search.
+    [[nodiscard]] constexpr auto expanded() const noexcept -> size_type;
+
+  private:
+    // Returns true if the workspace was built for shape. Compares the shapes if they are equality comparable, which is
+    // O(1) for the views of this library, and only their sizes otherwise.
+    [[nodiscard]] constexpr auto built_for(Shape const& shape) const -> bool;
+    // Starts a new search, forgetting the costs of the last one.
+    constexpr void restart() noexcept;
+    // Returns true if index was reached by the current search, otherwise false.
+    [[nodiscard]] constexpr auto reached(Index index) const noexcept -> bool;
+    // Sets the cost of reaching index and the index it is reached from.
+    constexpr void reach(Index index, Cost cost, Index parent) noexcept;
+
+    std::optional<Shape>                               m_shape;
+    neighbor_table<Index>                              m_neighbors;
+    std::vector<key_type>                              m_positions;
+    std::vector<Cost>                                  m_cost;
+    std::vector<Index>                                 m_parent;
+    detail::generation_stamps<>                        m_reached;
+    detail::indexed_heap<std::pair<Cost, Cost>, Index> m_open;
+    size_type                                          m_expanded = 0;
+
+    template<typename T, grid_shape S, class Allocator, typename CostFn, typename C, std::unsigned_integral I>
+    friend constexpr auto find_path(grid<T, S, Allocator> const&                           g,
+                                    typename grid<T, S, Allocator>::key_type const&        from,
+                                    typename grid<T, S, Allocator>::key_type const&        to,
+                                    CostFn                                                 cost_fn,
+                                    search_workspace<S, C, I>&                             workspace,
+                                    std::vector<typename grid<T, S, Allocator>::key_type>& path) -> std::optional<C>;
+};
+} // namespace hex
+
+// ------------------------------ implementation below ------------------------------
+
+template<hex::grid_shape Shape, typename Cost, std::unsigned_integral Index>
+constexpr hex::search_workspace<Shape, Cost, Index>::search_workspace(Shape const& shape)
+    : m_shape(shape)
+    , m_neighbors(shape)
+    , m_positions(std::ranges::begin(shape), std::ranges::end(shape))
+    , m_cost(m_positions.size())
+    , m_parent(m_positions.size())
+{
+    m_reached.resize(m_positions.size());
+    m_open.resize(m_positions.size());
+}
+
+template<hex::grid_shape Shape, typename Cost, std::unsigned_integral Index>
+constexpr auto hex::search_workspace<Shape, Cost, Index>::size() const noexcept -> size_type
+{
+    return m_positions.size();
+}
+
+template<hex::grid_shape Shape, typename Cost, std::unsigned_integral Index>
+constexpr auto hex::search_workspace<Shape, Cost, Index>::neighbors() const noexcept -> neighbor_table<Index> const&
+{
+    return m_neighbors;
+}
+
+template<hex::grid_shape Shape, typename Cost, std::unsigned_integral Index>
+constexpr auto hex::search_workspace<Shape, Cost, Index>::expanded() const noexcept -> size_type
+{
+    return m_expanded;
+}
+
+template<hex::grid_shape Shape, typename Cost, std::unsigned_integral Index>
+constexpr auto hex::search_workspace<Shape, Cost, Index>::built_for(Shape const& shape) const -> bool
+{
+    if constexpr (std::equality_comparable<Shape>)
+        return m_shape.has_value() && *m_shape == shape;
+    else
+        return std::ranges::size(shape) == size();
+}
+
+template<hex::grid_shape Shape, typename Cost, std::unsigned_integral Index>
+constexpr void hex::search_workspace<Shape, Cost, Index>::restart() noexcept
+{
+    m_open.clear();
+    m_expanded = 0;
+    m_reached.next_generation();
+}
+
+template<hex::grid_shape Shape, typename Cost, std::unsigned_integral Index>
+constexpr auto hex::search_workspace<Shape, Cost, Index>::reached(Index index) const noexcept -> bool
+{
+    return m_reached.marked(index);
+}
+
+template<hex::grid_shape Shape, typename Cost, std::unsigned_integral Index>
+constexpr void hex::search_workspace<Shape, Cost, Index>::reach(Index index, Cost cost, Index parent) noexcept
+{
+    m_reached.mark(index);
+    m_cost[index]   = cost;
+    m_parent[index] = parent;
+}
+
+#endif // HEX_SEARCH_WORKSPACE_HPP
@@ -0,0 +1,212 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_CARTESIAN_BATCH_HPP
+#define HEX_CARTESIAN_BATCH_HPP
+
+#include "hex/detail/detail_arithmetic.hpp"
+#include "hex/vector/detail/detail_simd_lanes.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <array>
+#include <concepts>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hex
+{
+// Writes to_cartesian(positions[i]) to out[i] for every position. Positions of std::int32_t are converted in SIMD
+// registers when available, in the precision of R. to_cartesian() computes in double, so for R = float the results may
+// differ from it in the last bit; for R = double they are identical. Throws std::invalid_argument if out is not of
+// positions.size().
+template<std::floating_point R, detail::arithmetic T>
+constexpr void to_cartesian(std::span<vector<T> const> positions, std::span<std::array<R, 2>> out);
+
+// Writes from_cartesian(points[i]) to out[i] for every point, up to rounding. Points of type R are converted in SIMD
+// registers when available, in the precision of R. Besides the caveat for float of the batch to_cartesian(), the
+// compiler may contract the multiplications and additions of either path into fused multiply-adds, so the results may
+// differ from from_cartesian() in the last bits even for R = double. Throws std::invalid_argument if out is not of
+// points.size().
+template<std::floating_point R, detail::arithmetic T>
+constexpr void from_cartesian(std::span<std::array<T, 2> const> points, std::span<vector<R>> out);
+
+// Returns the hex grid tile containing the given cartesian coordinates, with the axes of from_cartesian(). Equal to
+// round<R>(from_cartesian<T>(point)).
+template<std::integral R = int, std::floating_point T>
+[[nodiscard]] constexpr auto pixel_to_hex(std::array<T, 2> point) -> vector<R>;
+
+// Writes pixel_to_hex(points[i]) to out[i] for every point. For R = std::int32_t, conversion and rounding are fused in
+// SIMD registers when available, in the precision of T, and the tiles must lie within the range of std::int32_t. Since
+// the fractional coordinates only match the single-point overload up to rounding (see the batch from_cartesian()),
+// points on or within rounding error of a tile edge or corner may be assigned to the neighboring tile, for T = float
+// as well as for T = double. Throws std::invalid_argument if out is not of points.size().
+template<std::integral R, std::floating_point T>
+constexpr void pixel_to_hex(std::span<std::array<T, 2> const> points, std::span<vector<R>> out);
+
+namespace detail
+{
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+// Rounds every value to the nearest integer, halfway cases away from zero like std::round.
+template<typename L>
+[[nodiscard]] auto round_lanes(typename L::reg x) noexcept -> typename L::reg
+{
+    auto const truncated = L::truncate(x);
+    auto const fraction  = L::sub(x, truncated);
+    auto const one       = L::broadcast(1);
+    auto const up        = L::bit_and(L::greater_equal(fraction, L::broadcast(0.5)), one);
+    auto const down      = L::bit_and(L::greater_equal(L::broadcast(-0.5), fraction), one);
+    return L::sub(L::add(truncated, up), down);
+}
+
+// Maps (q, r) pairs to (x, y) pairs, with the same operations as to_cartesian().
+template<typename L>
+[[nodiscard]] auto to_cartesian_lanes(typename L::reg qr) noexcept -> typename L::reg
+{
+    // (q / 2, q + 2r), then (3 * (q / 2), sqrt(3) / 2 * (q + 2r)).
+    auto const sum = L::add(L::mul(qr, L::pairs(0.5, 2)), L::mul(L::swap_pairs(qr), L::pairs(0, 1)));
+    return L::mul(sum, L::pairs(3, std::numbers::sqrt3 / 2));
+}
+
+// Maps (x, y) pairs to fractional (q, r) pairs, with the same operations as from_cartesian().
+template<typename L>
+[[nodiscard]] auto from_cartesian_lanes(typename L::reg xy) noexcept -> typename L::reg
+{
+    // (2x, sqrt(3) * y - x) / 3.
+    auto const sum = L::add(L::mul(xy, L::pairs(2, std::numbers::sqrt3)), L::mul(L::swap_pairs(xy), L::pairs(0, -1)));
+    return L::div(sum, L::broadcast(3));
+}
+
+// Rounds fractional (q, r) pairs to the (q, r) pairs of the containing tiles, with the same decisions as round(): the
+// coordinate furthest from its rounded value is recomputed from the other two.
+template<typename L>
+[[nodiscard]] auto round_hex_lanes(typename L::reg fraction) noexcept -> typename L::reg
+{
+    auto const zero      = L::broadcast(0);
+    auto const s         = L::sub(zero, L::add(fraction, L::swap_pairs(fraction)));
+    auto const rounded   = round_lanes<L>(fraction);
+    auto const rounded_s = round_lanes<L>(s);
+    auto const error     = L::abs(L::sub(rounded, fraction));
+    auto const error_s   = L::abs(L::sub(rounded_s, s));
+    auto const other     = L::swap_pairs(error);
+
+    // q is recomputed if its error exceeds both others, r if it exceeds s and is not less than q.
+    auto const is_r      = L::greater(L::pairs(0, 1), L::broadcast(0.5));
+    auto const dominates = L::bit_or(L::greater(error, other), L::bit_and(is_r, L::greater_equal(error, other)));
+    auto const recompute = L::bit_and(L::greater(error, error_s), dominates);
+    return L::select(recompute, L::sub(zero, L::add(L::swap_pairs(rounded), rounded_s)), rounded);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+} // namespace detail
+} // namespace hex
+
+// ------------------------------ implementation below ------------------------------
+
+template<std::floating_point R, hex::detail::arithmetic T>
+constexpr void hex::to_cartesian(std::span<vector<T> const> positions, std::span<std::array<R, 2>> out)
+{
+    if (out.size() != positions.size())
+        throw std::invalid_argument("output size does not match input size");
+    std::size_t i = 0;
+    if !consteval
+    {
+        using lanes = detail::real_lanes<R>;
+        if constexpr (std::same_as<T, std::int32_t> && lanes::width > 0)
+        {
+            static_assert(sizeof(vector<T>) == 2 * sizeof(T) && sizeof(std::array<R, 2>) == 2 * sizeof(R));
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const* in  = reinterpret_cast<T const*>(positions.data());
+            auto*       dst = reinterpret_cast<R*>(out.data());
+            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+            for (; i + (lanes::width / 2) <= positions.size(); i += lanes::width / 2)
+                lanes::store(dst + (2 * i), detail::to_cartesian_lanes<lanes>(lanes::load_int32(in + (2 * i))));
+        }
+    }
+    for (; i < positions.size(); ++i)
+        out[i] = to_cartesian<R>(positions[i]);
+}
+
+template<std::floating_point R, hex::detail::arithmetic T>
+constexpr void hex::from_cartesian(std::span<std::array<T, 2> const> points, std::span<vector<R>> out)
+{
+    if (out.size() != points.size())
+        throw std::invalid_argument("output size does not match input size");
+    std::size_t i = 0;
+    if !consteval
+    {
+        using lanes = detail::real_lanes<R>;
+        if constexpr (std::same_as<T, R> && lanes::width > 0)
+        {
+            static_assert(sizeof(vector<R>) == 2 * sizeof(R) && sizeof(std::array<T, 2>) == 2 * sizeof(T));
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const* in  = reinterpret_cast<T const*>(points.data());
+            auto*       dst = reinterpret_cast<R*>(out.data());
+            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+            for (; i + (lanes::width / 2) <= points.size(); i += lanes::width / 2)
+                lanes::store(dst + (2 * i), detail::from_cartesian_lanes<lanes>(lanes::load(in + (2 * i))));
+        }
+    }
+    for (; i < points.size(); ++i)
+        out[i] = from_cartesian<R>(points[i]);
+}
+
+template<std::integral R, std::floating_point T>
+constexpr auto hex::pixel_to_hex(std::array<T, 2> point) -> vector<R>
+{
+    return round<R>(from_cartesian<T>(point));
+}
+
+template<std::integral R, std::floating_point T>
+constexpr void hex::pixel_to_hex(std::span<std::array<T, 2> const> points, std::span<vector<R>> out)
+{
+    if (out.size() != points.size())
+        throw std::invalid_argument("output size does not match input size");
+    std::size_t i = 0;
+    if !consteval
+    {
+        using lanes = detail::real_lanes<T>;
+        if constexpr (std::same_as<R, std::int32_t> && lanes::width > 0)
+        {
+            static_assert(sizeof(vector<R>) == 2 * sizeof(R) && sizeof(std::array<T, 2>) == 2 * sizeof(T));
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const* in  = reinterpret_cast<T const*>(points.data());
+            auto*       dst = reinterpret_cast<R*>(out.data());
+            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+            for (; i + (lanes::width / 2) <= points.size(); i += lanes::width / 2)
+            {
+                auto const fraction = detail::from_cartesian_lanes<lanes>(lanes::load(in + (2 * i)));
+                lanes::store_int32(dst + (2 * i), detail::round_hex_lanes<lanes>(fraction));
+            }
+        }
+    }
+    for (; i < points.size(); ++i)
+        out[i] = pixel_to_hex<R>(points[i]);
+}
+
+#endif // HEX_CARTESIAN_BATCH_HPP
@@ -0,0 +1,397 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_DETAIL_SIMD_LANES_HPP
+#define HEX_DETAIL_SIMD_LANES_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace hex::detail
+{
+// The operations the batch kernels are written against, one value at a time. Every lanes type provides the same static
+// functions, so that a kernel written as a generic lambda over a lanes type runs on registers and on single values.
+template<typename T>
+struct scalar_lanes
+{
+    using value_type                   = T;
+    using reg                          = T;
+    static constexpr std::size_t width = 1;
+
+    [[nodiscard]] static constexpr auto load(T const* p) noexcept -> reg { return *p; }
+    static constexpr void               store(T* p, reg v) noexcept { *p = v; }
+    [[nodiscard]] static constexpr auto broadcast(T v) noexcept -> reg { return v; }
+    [[nodiscard]] static constexpr auto add(reg a, reg b) noexcept -> reg { return static_cast<T>(a + b); }
+    [[nodiscard]] static constexpr auto sub(reg a, reg b) noexcept -> reg { return static_cast<T>(a - b); }
+    [[nodiscard]] static constexpr auto mul(reg a, reg b) noexcept -> reg { return static_cast<T>(a * b); }
+    [[nodiscard]] static constexpr auto neg(reg a) noexcept -> reg { return static_cast<T>(-a); }
+    [[nodiscard]] static constexpr auto abs(reg a) noexcept -> reg { return a < T{} ? static_cast<T>(-a) : a; }
+    [[nodiscard]] static constexpr auto max(reg a, reg b) noexcept -> reg { return std::max(a, b); }
+};
+
+#if defined(__AVX2__)
+// Eight 32-bit integers per AVX2 register.
+struct int32_lanes
+{
+    using value_type                   = std::int32_t;
+    using reg                          = __m256i;
+    static constexpr std::size_t width = 8;
+
+    [[nodiscard]] static auto load(std::int32_t const* p) noexcept -> reg
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+    }
+    static void store(std::int32_t* p, reg v) noexcept
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+    [[nodiscard]] static auto broadcast(std::int32_t v) noexcept -> reg { return _mm256_set1_epi32(v); }
+    [[nodiscard]] static auto add(reg a, reg b) noexcept -> reg { return _mm256_add_epi32(a, b); }
+    [[nodiscard]] static auto sub(reg a, reg b) noexcept -> reg { return _mm256_sub_epi32(a, b); }
+    [[nodiscard]] static auto mul(reg a, reg b) noexcept -> reg { return _mm256_mullo_epi32(a, b); }
+    [[nodiscard]] static auto neg(reg a) noexcept -> reg { return _mm256_sub_epi32(_mm256_setzero_si256(), a); }
+    [[nodiscard]] static auto abs(reg a) noexcept -> reg { return _mm256_abs_epi32(a); }
+    [[nodiscard]] static auto max(reg a, reg b) noexcept -> reg { return _mm256_max_epi32(a, b); }
+};
+#elif defined(__SSE2__) || defined(_M_X64)
+// Four 32-bit integers per SSE2 register. SSE2 lacks 32-bit abs, max and multiplication, which are composed from the
+// instructions it has.
+struct int32_lanes
+{
+    using value_type                   = std::int32_t;
+    using reg                          = __m128i;
+    static constexpr std::size_t width = 4;
+
+    [[nodiscard]] static auto load(std::int32_t const* p) noexcept -> reg
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+    }
+    static void store(std::int32_t* p, reg v) noexcept
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+    [[nodiscard]] static auto broadcast(std::int32_t v) noexcept -> reg { return _mm_set1_epi32(v); }
+    [[nodiscard]] static auto add(reg a, reg b) noexcept -> reg { return _mm_add_epi32(a, b); }
+    [[nodiscard]] static auto sub(reg a, reg b) noexcept -> reg { return _mm_sub_epi32(a, b); }
+    [[nodiscard]] static auto mul(reg a, reg b) noexcept -> reg
+    {
+        // Multiply the even and the odd lanes to 64 bits each, then interleave the low halves.
+        auto const even = _mm_mul_epu32(a, b);
+        auto const odd  = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+        return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                  _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    }
+    [[nodiscard]] static auto neg(reg a) noexcept -> reg { return _mm_sub_epi32(_mm_setzero_si128(), a); }
+    [[nodiscard]] static auto abs(reg a) noexcept -> reg
+    {
+        auto const sign = _mm_srai_epi32(a, 31); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        return _mm_sub_epi32(_mm_xor_si128(a, sign), sign);
+    }
+    [[nodiscard]] static auto max(reg a, reg b) noexcept -> reg
+    {
+        auto const greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+    }
+};
+#endif
+
+// Floating point registers for kernels over interleaved pairs, such as (x, y) or (q, r) stored one after the other.
+// width is the number of values per register, an even number, or 0 when there are no registers for R. Constants are
+// passed as double and converted to R. truncate() and store_int32() require values within the range of std::int32_t.
+template<std::floating_point R>
+struct real_lanes
+{
+    static constexpr std::size_t width = 0;
+};
+
+#if defined(__AVX__)
+// Four pairs of floats per AVX register.
+template<>
+struct real_lanes<float>
+{
+    using reg                          = __m256;
+    static constexpr std::size_t width = 8;
+
+    [[nodiscard]] static auto load(float const* p) noexcept -> reg { return _mm256_loadu_ps(p); }
+    static void               store(float* p, reg v) noexcept { _mm256_storeu_ps(p, v); }
+    [[nodiscard]] static auto load_int32(std::int32_t const* p) noexcept -> reg
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(p)));
+    }
+    static void store_int32(std::int32_t* p, reg v) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_cvttps_epi32(v));
+    }
+    [[nodiscard]] static auto broadcast(double v) noexcept -> reg { return _mm256_set1_ps(static_cast<float>(v)); }
+    [[nodiscard]] static auto pairs(double even, double odd) noexcept -> reg
+    {
+        auto const e = static_cast<float>(even);
+        auto const o = static_cast<float>(odd);
+        return _mm256_setr_ps(e, o, e, o, e, o, e, o);
+    }
+    [[nodiscard]] static auto add(reg a, reg b) noexcept -> reg { return _mm256_add_ps(a, b); }
+    [[nodiscard]] static auto sub(reg a, reg b) noexcept -> reg { return _mm256_sub_ps(a, b); }
+    [[nodiscard]] static auto mul(reg a, reg b) noexcept -> reg { return _mm256_mul_ps(a, b); }
+    [[nodiscard]] static auto div(reg a, reg b) noexcept -> reg { return _mm256_div_ps(a, b); }
+    [[nodiscard]] static auto abs(reg a) noexcept -> reg { return _mm256_andnot_ps(_mm256_set1_ps(-0.F), a); }
+    [[nodiscard]] static auto swap_pairs(reg a) noexcept -> reg
+    {
+        return _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+    [[nodiscard]] static auto truncate(reg a) noexcept -> reg
+    {
+        return _mm256_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    }
+    [[nodiscard]] static auto greater(reg a, reg b) noexcept -> reg { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    [[nodiscard]] static auto greater_equal(reg a, reg b) noexcept -> reg { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    [[nodiscard]] static auto bit_and(reg a, reg b) noexcept -> reg { return _mm256_and_ps(a, b); }
+    [[nodiscard]] static auto bit_or(reg a, reg b) noexcept -> reg { return _mm256_or_ps(a, b); }
+    [[nodiscard]] static auto select(reg mask, reg a, reg b) noexcept -> reg { return _mm256_blendv_ps(b, a, mask); }
+};
+
+// Two pairs of doubles per AVX register.
+template<>
+struct real_lanes<double>
+{
+    using reg                          = __m256d;
+    static constexpr std::size_t width = 4;
+
+    [[nodiscard]] static auto load(double const* p) noexcept -> reg { return _mm256_loadu_pd(p); }
+    static void               store(double* p, reg v) noexcept { _mm256_storeu_pd(p, v); }
+    [[nodiscard]] static auto load_int32(std::int32_t const* p) noexcept -> reg
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p)));
+    }
+    static void store_int32(std::int32_t* p, reg v) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_cvttpd_epi32(v));
+    }
+    [[nodiscard]] static auto broadcast(double v) noexcept -> reg { return _mm256_set1_pd(v); }
+    [[nodiscard]] static auto pairs(double even, double odd) noexcept -> reg
+    {
+        return _mm256_setr_pd(even, odd, even, odd);
+    }
+    [[nodiscard]] static auto add(reg a, reg b) noexcept -> reg { return _mm256_add_pd(a, b); }
+    [[nodiscard]] static auto sub(reg a, reg b) noexcept -> reg { return _mm256_sub_pd(a, b); }
+    [[nodiscard]] static auto mul(reg a, reg b) noexcept -> reg { return _mm256_mul_pd(a, b); }
+    [[nodiscard]] static auto div(reg a, reg b) noexcept -> reg { return _mm256_div_pd(a, b); }
+    [[nodiscard]] static auto abs(reg a) noexcept -> reg { return _mm256_andnot_pd(_mm256_set1_pd(-0.), a); }
+    [[nodiscard]] static auto swap_pairs(reg a) noexcept -> reg { return _mm256_permute_pd(a, 0b0101); }
+    [[nodiscard]] static auto truncate(reg a) noexcept -> reg
+    {
+        return _mm256_round_pd(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    }
+    [[nodiscard]] static auto greater(reg a, reg b) noexcept -> reg { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+    [[nodiscard]] static auto greater_equal(reg a, reg b) noexcept -> reg { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+    [[nodiscard]] static auto bit_and(reg a, reg b) noexcept -> reg { return _mm256_and_pd(a, b); }
+    [[nodiscard]] static auto bit_or(reg a, reg b) noexcept -> reg { return _mm256_or_pd(a, b); }
+    [[nodiscard]] static auto select(reg mask, reg a, reg b) noexcept -> reg { return _mm256_blendv_pd(b, a, mask); }
+};
+#elif defined(__SSE2__) || defined(_M_X64)
+// Two pairs of floats per SSE2 register. SSE2 lacks rounding and blending, which go through integer conversion and
+// bit masks instead.
+template<>
+struct real_lanes<float>
+{
+    using reg                          = __m128;
+    static constexpr std::size_t width = 4;
+
+    [[nodiscard]] static auto load(float const* p) noexcept -> reg { return _mm_loadu_ps(p); }
+    static void               store(float* p, reg v) noexcept { _mm_storeu_ps(p, v); }
+    [[nodiscard]] static auto load_int32(std::int32_t const* p) noexcept -> reg
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p)));
+    }
+    static void store_int32(std::int32_t* p, reg v) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_cvttps_epi32(v));
+    }
+    [[nodiscard]] static auto broadcast(double v) noexcept -> reg { return _mm_set1_ps(static_cast<float>(v)); }
+    [[nodiscard]] static auto pairs(double even, double odd) noexcept -> reg
+    {
+        auto const e = static_cast<float>(even);
+        auto const o = static_cast<float>(odd);
+        return _mm_setr_ps(e, o, e, o);
+    }
+    [[nodiscard]] static auto add(reg a, reg b) noexcept -> reg { return _mm_add_ps(a, b); }
+    [[nodiscard]] static auto sub(reg a, reg b) noexcept -> reg { return _mm_sub_ps(a, b); }
+    [[nodiscard]] static auto mul(reg a, reg b) noexcept -> reg { return _mm_mul_ps(a, b); }
+    [[nodiscard]] static auto div(reg a, reg b) noexcept -> reg { return _mm_div_ps(a, b); }
+    [[nodiscard]] static auto abs(reg a) noexcept -> reg { return _mm_andnot_ps(_mm_set1_ps(-0.F), a); }
+    [[nodiscard]] static auto swap_pairs(reg a) noexcept -> reg
+    {
+        return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+    [[nodiscard]] static auto truncate(reg a) noexcept -> reg { return _mm_cvtepi32_ps(_mm_cvttps_epi32(a)); }
+    [[nodiscard]] static auto greater(reg a, reg b) noexcept -> reg { return _mm_cmpgt_ps(a, b); }
+    [[nodiscard]] static auto greater_equal(reg a, reg b) noexcept -> reg { return _mm_cmpge_ps(a, b); }
+    [[nodiscard]] static auto bit_and(reg a, reg b) noexcept -> reg { return _mm_and_ps(a, b); }
+    [[nodiscard]] static auto bit_or(reg a, reg b) noexcept -> reg { return _mm_or_ps(a, b); }
+    [[nodiscard]] static auto select(reg mask, reg a, reg b) noexcept -> reg
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+};
+
+// One pair of doubles per SSE2 register.
+template<>
+struct real_lanes<double>
+{
+    using reg                          = __m128d;
+    static constexpr std::size_t width = 2;
+
+    [[nodiscard]] static auto load(double const* p) noexcept -> reg { return _mm_loadu_pd(p); }
+    static void               store(double* p, reg v) noexcept { _mm_storeu_pd(p, v); }
+    [[nodiscard]] static auto load_int32(std::int32_t const* p) noexcept -> reg
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(p)));
+    }
+    static void store_int32(std::int32_t* p, reg v) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_cvttpd_epi32(v));
+    }
+    [[nodiscard]] static auto broadcast(double v) noexcept -> reg { return _mm_set1_pd(v); }
+    [[nodiscard]] static auto pairs(double even, double odd) noexcept -> reg { return _mm_setr_pd(even, odd); }
+    [[nodiscard]] static auto add(reg a, reg b) noexcept -> reg { return _mm_add_pd(a, b); }
+    [[nodiscard]] static auto sub(reg a, reg b) noexcept -> reg { return _mm_sub_pd(a, b); }
+    [[nodiscard]] static auto mul(reg a, reg b) noexcept -> reg { return _mm_mul_pd(a, b); }
+    [[nodiscard]] static auto div(reg a, reg b) noexcept -> reg { return _mm_div_pd(a, b); }
+    [[nodiscard]] static auto abs(reg a) noexcept -> reg { return _mm_andnot_pd(_mm_set1_pd(-0.), a); }
+    [[nodiscard]] static auto swap_pairs(reg a) noexcept -> reg { return _mm_shuffle_pd(a, a, 1); }
+    [[nodiscard]] static auto truncate(reg a) noexcept -> reg { return _mm_cvtepi32_pd(_mm_cvttpd_epi32(a)); }
+    [[nodiscard]] static auto greater(reg a, reg b) noexcept -> reg { return _mm_cmpgt_pd(a, b); }
+    [[nodiscard]] static auto greater_equal(reg a, reg b) noexcept -> reg { return _mm_cmpge_pd(a, b); }
+    [[nodiscard]] static auto bit_and(reg a, reg b) noexcept -> reg { return _mm_and_pd(a, b); }
+    [[nodiscard]] static auto bit_or(reg a, reg b) noexcept -> reg { return _mm_or_pd(a, b); }
+    [[nodiscard]] static auto select(reg mask, reg a, reg b) noexcept -> reg
+    {
+        return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+    }
+};
+#endif
+
+// The widest lanes available for T: registers for 32-bit integers on x86-64, otherwise single values.
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+template<typename T>
+using widest_lanes = std::conditional_t<std::is_same_v<T, std::int32_t>, int32_lanes, scalar_lanes<T>>;
+#else
+template<typename T>
+using widest_lanes = scalar_lanes<T>;
+#endif
+
+// Sets out[i] = kernel(lanes, q[i], r[i]) for i in [0, n), whole registers at a time and the rest one by one.
+template<typename T, typename Kernel>
+constexpr void simd_map(T const* q, T const* r, T* out, std::size_t n, Kernel kernel)
+{
+    std::size_t i = 0;
+    if !consteval
+    {
+        using lanes = widest_lanes<T>;
+        if constexpr (lanes::width > 1)
+        {
+            for (; i + lanes::width <= n; i += lanes::width)
+                lanes::store(out + i, kernel(lanes{}, lanes::load(q + i), lanes::load(r + i)));
+        }
+    }
+    for (; i < n; ++i)
+        out[i] = kernel(scalar_lanes<T>{}, q[i], r[i]);
+}
+
+// Sets (q[i], r[i]) = kernel(lanes, q[i], r[i]) for i in [0, n), whole registers at a time and the rest one by one.
+// kernel returns a pair of registers.
+template<typename T, typename Kernel>
+constexpr void simd_update(T* q, T* r, std::size_t n, Kernel kernel)
+{
+    std::size_t i = 0;
+    if !consteval
+    {
+        using lanes = widest_lanes<T>;
+        if constexpr (lanes::width > 1)
+        {
+            for (; i + lanes::width <= n; i += lanes::width)
+            {
+                auto const [new_q, new_r] = kernel(lanes{}, lanes::load(q + i), lanes::load(r + i));
+                lanes::store(q + i, new_q);
+                lanes::store(r + i, new_r);
+            }
+        }
+    }
+    for (; i < n; ++i)
+    {
+        auto const [new_q, new_r] = kernel(scalar_lanes<T>{}, q[i], r[i]);
+        q[i]                      = new_q;
+        r[i]                      = new_r;
+    }
+}
+
+// As simd_update(), but kernel also receives the values of other_q and other_r at the same positions.
+template<typename T, typename Kernel>
+constexpr void simd_combine(T* q, T* r, T const* other_q, T const* other_r, std::size_t n, Kernel kernel)
+{
+    std::size_t i = 0;
+    if !consteval
+    {
+        using lanes = widest_lanes<T>;
+        if constexpr (lanes::width > 1)
+        {
+            for (; i + lanes::width <= n; i += lanes::width)
+            {
+                auto const [new_q, new_r] = kernel(lanes{},
+                                                   lanes::load(q + i),
+                                                   lanes::load(r + i),
+                                                   lanes::load(other_q + i),
+                                                   lanes::load(other_r + i));
+                lanes::store(q + i, new_q);
+                lanes::store(r + i, new_r);
+            }
+        }
+    }
+    for (; i < n; ++i)
+    {
+        auto const [new_q, new_r] = kernel(scalar_lanes<T>{}, q[i], r[i], other_q[i], other_r[i]);
+        q[i]                      = new_q;
+        r[i]                      = new_r;
+    }
+}
+} // namespace hex::detail
+
+#endif // HEX_DETAIL_SIMD_LANES_HPP
@@ -161,13 +161,19 @@ constexpr auto combine_matrix(transformation_matrix<T> const& m1,
 {
     // This is an inline matrix-matrix multiplication assuming the last line is 0 0 1.
     // Transforms apply right-to-left, i.e. the resulting transformation is as if m2 is applied before m1.
+    using R      = std::common_type_t<T, U>;
     auto const a = m1[0] * m2[0] + m1[2] * m2[1];
     auto const b = m1[1] * m2[0] + m1[3] * m2[1];
     auto const c = m1[0] * m2[2] + m1[2] * m2[3];
     auto const d = m1[1] * m2[2] + m1[3] * m2[3];
     auto const e = m1[0] * m2[4] + m1[2] * m2[5] + m1[4];
     auto const f = m1[1] * m2[4] + m1[3] * m2[5] + m1[5];
-    return {a, b, c, d, e, f};
+    return {static_cast<R>(a),
+            static_cast<R>(b),
+            static_cast<R>(c),
+            static_cast<R>(d),
+            static_cast<R>(e),
+            static_cast<R>(f)};
 }
 
 template<typename T>
@@ -0,0 +1,321 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_LAYOUT_HPP
+#define HEX_LAYOUT_HPP
+
+#include "hex/detail/detail_arithmetic.hpp"
+#include "hex/vector/cartesian_batch.hpp"
+#include "hex/vector/detail/detail_simd_lanes.hpp"
+#include "hex/vector/layout_orientation.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <array>
+#include <concepts>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hex
+{
+// Maps hex grid vectors to points on screen and back. A layout combines an orientation, the size of a tile and the
+// position of the zero vector's center, and stores the resulting matrices, so that every conversion takes two
+// multiplications and two additions per axis.
+template<std::floating_point T = double>
+class layout
+{
+  public:
+    using point = std::array<T, 2>;
+
+    // Constructs a layout whose tiles have their corners size[0] units horizontally and size[1] units vertically from
+    // their center, with the zero vector's center at origin. Negative sizes mirror the axis, for example to point y
+    // down. Throws std::invalid_argument if a size is 0.
+    constexpr layout(layout_orientation orientation, point size, point origin = {});
+    // Constructs a layout whose tiles have their corners size units from their center.
+    constexpr layout(layout_orientation orientation, T size, point origin = {});
+
+    [[nodiscard]] constexpr auto operator==(layout const& rhs) const noexcept -> bool = default;
+
+    [[nodiscard]] constexpr auto orientation() const noexcept -> layout_orientation;
+    [[nodiscard]] constexpr auto size() const noexcept -> point;
+    [[nodiscard]] constexpr auto origin() const noexcept -> point;
+
+    // Returns the center of the tile at position.
+    template<detail::arithmetic U>
+    [[nodiscard]] constexpr auto to_pixel(vector<U> const& position) const noexcept -> point;
+    // Returns the fractional hex grid vector at the given point.
+    [[nodiscard]] constexpr auto from_pixel(point const& pixel) const noexcept -> vector<T>;
+    // Returns the tile containing the given point. Equal to round<R>(from_pixel(pixel)).
+    template<std::integral R = int>
+    [[nodiscard]] constexpr auto pixel_to_hex(point const& pixel) const -> vector<R>;
+    // Returns the corners of the tile at position, counter-clockwise for a positive size, starting at the corner to the
+    // right of the center for flat tiles and at the one above the right edge for pointy tiles.
+    template<detail::arithmetic U>
+    [[nodiscard]] constexpr auto corners(vector<U> const& position) const noexcept -> std::array<point, 6>;
+
+    // The batch conversions below match the single-point ones only up to rounding: the compiler may contract the
+    // multiplications and additions of either path into fused multiply-adds, so their results may differ in the last
+    // bits.
+
+    // Writes to_pixel(positions[i]) to out[i] for every position, up to rounding. Positions of std::int32_t are
+    // converted in SIMD registers when available. Throws std::invalid_argument if out is not of positions.size().
+    template<detail::arithmetic U>
+    constexpr void to_pixel(std::span<vector<U> const> positions, std::span<point> out) const;
+    // Writes from_pixel(pixels[i]) to out[i] for every point, up to rounding, in SIMD registers when available. Throws
+    // std::invalid_argument if out is not of pixels.size().
+    constexpr void from_pixel(std::span<point const> pixels, std::span<vector<T>> out) const;
+    // Writes pixel_to_hex(pixels[i]) to out[i] for every point, except that points on or within rounding error of a
+    // tile edge or corner may be assigned to the neighboring tile. For R = std::int32_t, conversion and rounding are
+    // fused in SIMD registers when available, and the tiles must lie within the range of std::int32_t. Throws
+    // std::invalid_argument if out is not of pixels.size().
+    template<std::integral R>
+    constexpr void pixel_to_hex(std::span<point const> pixels, std::span<vector<R>> out) const;
+
+  private:
+    // The unit matrices of an orientation, row-major: x = m[0] * q + m[1] * r and y = m[2] * q + m[3] * r, and the
+    // inverse q = m[0] * x + m[1] * y and r = m[2] * x + m[3] * y.
+    [[nodiscard]] static constexpr auto unit_forward(layout_orientation orientation) noexcept -> std::array<T, 4>;
+    [[nodiscard]] static constexpr auto unit_inverse(layout_orientation orientation) noexcept -> std::array<T, 4>;
+
+    layout_orientation m_orientation;
+    point              m_size;
+    point              m_origin;
+    std::array<T, 4>   m_forward; // The unit forward matrix with its rows scaled by size.
+    std::array<T, 4>   m_inverse; // The unit inverse matrix with its columns divided by size.
+};
+} // namespace hex
+
+// ------------------------------ implementation below ------------------------------
+
+template<std::floating_point T>
+constexpr hex::layout<T>::layout(layout_orientation orientation, point size, point origin)
+    : m_orientation(orientation)
+    , m_size(size)
+    , m_origin(origin)
+    , m_forward(unit_forward(orientation))
+    , m_inverse(unit_inverse(orientation))
+{
+    if (size[0] == T{} || size[1] == T{})
+        throw std::invalid_argument("layout size must not be 0");
+    m_forward[0] *= size[0];
+    m_forward[1] *= size[0];
+    m_forward[2] *= size[1];
+    m_forward[3] *= size[1];
+    m_inverse[0] /= size[0];
+    m_inverse[1] /= size[1];
+    m_inverse[2] /= size[0];
+    m_inverse[3] /= size[1];
+}
+
+template<std::floating_point T>
+constexpr hex::layout<T>::layout(layout_orientation orientation, T size, point origin)
+    : layout(orientation, point{size, size}, origin)
+{
+}
+
+template<std::floating_point T>
+constexpr auto hex::layout<T>::orientation() const noexcept -> layout_orientation
+{
+    return m_orientation;
+}
+
+template<std::floating_point T>
+constexpr auto hex::layout<T>::size() const noexcept -> point
+{
+    return m_size;
+}
+
+template<std::floating_point T>
+constexpr auto hex::layout<T>::origin() const noexcept -> point
+{
+    return m_origin;
+}
+
+template<std::floating_point T>
+template<hex::detail::arithmetic U>
+constexpr auto hex::layout<T>::to_pixel(vector<U> const& position) const noexcept -> point
+{
+    auto const q = static_cast<T>(position.q().value());
+    auto const r = static_cast<T>(position.r().value());
+    return {m_forward[0] * q + m_forward[1] * r + m_origin[0], m_forward[2] * q + m_forward[3] * r + m_origin[1]};
+}
+
+template<std::floating_point T>
+constexpr auto hex::layout<T>::from_pixel(point const& pixel) const noexcept -> vector<T>
+{
+    auto const x = pixel[0] - m_origin[0];
+    auto const y = pixel[1] - m_origin[1];
+    return vector<T>{q_coordinate<T>(m_inverse[0] * x + m_inverse[1] * y),
+                     r_coordinate<T>(m_inverse[2] * x + m_inverse[3] * y)};
+}
+
+template<std::floating_point T>
+template<std::integral R>
+constexpr auto hex::layout<T>::pixel_to_hex(point const& pixel) const -> vector<R>
+{
+    return round<R>(from_pixel(pixel));
+}
+
+template<std::floating_point T>
+template<hex::detail::arithmetic U>
+constexpr auto hex::layout<T>::corners(vector<U> const& position) const noexcept -> std::array<point, 6>
+{
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    constexpr T half       = 0.5;
+    constexpr T sqrt3_half = std::numbers::sqrt3_v<T> / 2;
+    constexpr std::array<point, 6> flat{{{1, 0}, {half, sqrt3_half}, {-half, sqrt3_half}, {-1, 0},
+                                         {-half, -sqrt3_half}, {half, -sqrt3_half}}};
+    constexpr std::array<point, 6> pointy{{{sqrt3_half, half}, {0, 1}, {-sqrt3_half, half}, {-sqrt3_half, -half},
+                                           {0, -1}, {sqrt3_half, -half}}};
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    auto const&          unit   = m_orientation == layout_orientation::flat ? flat : pointy;
+    auto const           center = to_pixel(position);
+    std::array<point, 6> result{};
+    for (std::size_t i = 0; i < result.size(); ++i)
+        result[i] = {center[0] + m_size[0] * unit[i][0], center[1] + m_size[1] * unit[i][1]};
+    return result;
+}
+
+template<std::floating_point T>
+template<hex::detail::arithmetic U>
+constexpr void hex::layout<T>::to_pixel(std::span<vector<U> const> positions, std::span<point> out) const
+{
+    if (out.size() != positions.size())
+        throw std::invalid_argument("output size does not match input size");
+    std::size_t i = 0;
+    if !consteval
+    {
+        using lanes = detail::real_lanes<T>;
+        if constexpr (std::same_as<U, std::int32_t> && lanes::width > 0)
+        {
+            static_assert(sizeof(vector<U>) == 2 * sizeof(U) && sizeof(point) == 2 * sizeof(T));
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const* in  = reinterpret_cast<U const*>(positions.data());
+            auto*       dst = reinterpret_cast<T*>(out.data());
+            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const diagonal = lanes::pairs(m_forward[0], m_forward[3]);
+            auto const crossed  = lanes::pairs(m_forward[1], m_forward[2]);
+            auto const origin   = lanes::pairs(m_origin[0], m_origin[1]);
+            for (; i + (lanes::width / 2) <= positions.size(); i += lanes::width / 2)
+            {
+                auto const qr = lanes::load_int32(in + (2 * i));
+                auto const xy = lanes::add(lanes::mul(qr, diagonal), lanes::mul(lanes::swap_pairs(qr), crossed));
+                lanes::store(dst + (2 * i), lanes::add(xy, origin));
+            }
+        }
+    }
+    for (; i < positions.size(); ++i)
+        out[i] = to_pixel(positions[i]);
+}
+
+template<std::floating_point T>
+constexpr void hex::layout<T>::from_pixel(std::span<point const> pixels, std::span<vector<T>> out) const
+{
+    if (out.size() != pixels.size())
+        throw std::invalid_argument("output size does not match input size");
+    std::size_t i = 0;
+    if !consteval
+    {
+        using lanes = detail::real_lanes<T>;
+        if constexpr (lanes::width > 0)
+        {
+            static_assert(sizeof(vector<T>) == 2 * sizeof(T) && sizeof(point) == 2 * sizeof(T));
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const* in  = reinterpret_cast<T const*>(pixels.data());
+            auto*       dst = reinterpret_cast<T*>(out.data());
+            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const diagonal = lanes::pairs(m_inverse[0], m_inverse[3]);
+            auto const crossed  = lanes::pairs(m_inverse[1], m_inverse[2]);
+            auto const origin   = lanes::pairs(m_origin[0], m_origin[1]);
+            for (; i + (lanes::width / 2) <= pixels.size(); i += lanes::width / 2)
+            {
+                auto const xy = lanes::sub(lanes::load(in + (2 * i)), origin);
+                lanes::store(dst + (2 * i),
+                             lanes::add(lanes::mul(xy, diagonal), lanes::mul(lanes::swap_pairs(xy), crossed)));
+            }
+        }
+    }
+    for (; i < pixels.size(); ++i)
+        out[i] = from_pixel(pixels[i]);
+}
+
+template<std::floating_point T>
+template<std::integral R>
+constexpr void hex::layout<T>::pixel_to_hex(std::span<point const> pixels, std::span<vector<R>> out) const
+{
+    if (out.size() != pixels.size())
+        throw std::invalid_argument("output size does not match input size");
+    std::size_t i = 0;
+    if !consteval
+    {
+        using lanes = detail::real_lanes<T>;
+        if constexpr (std::same_as<R, std::int32_t> && lanes::width > 0)
+        {
+            static_assert(sizeof(vector<R>) == 2 * sizeof(R) && sizeof(point) == 2 * sizeof(T));
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const* in  = reinterpret_cast<T const*>(pixels.data());
+            auto*       dst = reinterpret_cast<R*>(out.data());
+            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const diagonal = lanes::pairs(m_inverse[0], m_inverse[3]);
+            auto const crossed  = lanes::pairs(m_inverse[1], m_inverse[2]);
+            auto const origin   = lanes::pairs(m_origin[0], m_origin[1]);
+            for (; i + (lanes::width / 2) <= pixels.size(); i += lanes::width / 2)
+            {
+                auto const xy       = lanes::sub(lanes::load(in + (2 * i)), origin);
+                auto const fraction = lanes::add(lanes::mul(xy, diagonal), lanes::mul(lanes::swap_pairs(xy), crossed));
+                lanes::store_int32(dst + (2 * i), detail::round_hex_lanes<lanes>(fraction));
+            }
+        }
+    }
+    for (; i < pixels.size(); ++i)
+        out[i] = pixel_to_hex<R>(pixels[i]);
+}
+
+template<std::floating_point T>
+constexpr auto hex::layout<T>::unit_forward(layout_orientation orientation) noexcept -> std::array<T, 4>
+{
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    constexpr T sqrt3 = std::numbers::sqrt3_v<T>;
+    if (orientation == layout_orientation::flat)
+        return {T{3} / 2, 0, sqrt3 / 2, sqrt3};
+    return {sqrt3, sqrt3 / 2, 0, T{3} / 2};
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+}
+
+template<std::floating_point T>
+constexpr auto hex::layout<T>::unit_inverse(layout_orientation orientation) noexcept -> std::array<T, 4>
+{
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    constexpr T sqrt3 = std::numbers::sqrt3_v<T>;
+    if (orientation == layout_orientation::flat)
+        return {T{2} / 3, 0, T{-1} / 3, sqrt3 / 3};
+    return {sqrt3 / 3, T{-1} / 3, 0, T{2} / 3};
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+}
+
+#endif // HEX_LAYOUT_HPP
@@ -0,0 +1,186 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_PACKED_VECTOR_HPP
+#define HEX_PACKED_VECTOR_HPP
+
+#include "hex/detail/detail_arithmetic.hpp"
+#include "hex/detail/detail_hash.hpp"
+#include "hex/detail/detail_narrowing.hpp"
+#include "hex/vector/coordinate.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <compare>
+#include <concepts>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hex
+{
+// An integral hex grid vector packed into a single unsigned word, q in the upper and r in the lower half. Each half
+// stores its coordinate offset by half its range, so that comparing two words compares the vectors by q, then by r,
+// like vector's operator<=>. The word can therefore be used directly as a sort or radix key.
+//
+// packed_vector<std::uint32_t> holds the valid coordinates of std::int16_t, packed_vector<std::uint64_t> those of
+// std::int32_t, so that unpacking to vector<coordinate_type> always yields a valid vector.
+template<std::unsigned_integral Word = std::uint32_t>
+    requires(std::same_as<Word, std::uint32_t> || std::same_as<Word, std::uint64_t>)
+class packed_vector
+{
+  public:
+    using word_type       = Word;
+    using coordinate_type = std::conditional_t<std::same_as<Word, std::uint32_t>, std::int16_t, std::int32_t>;
+
+    // The lowest and greatest coordinate value a packed vector can hold.
+    static constexpr auto min_value = coordinate<coordinate_axis::q, coordinate_type>::min_value;
+    static constexpr auto max_value = coordinate<coordinate_axis::q, coordinate_type>::max_value;
+
+    // Constructs the zero-vector.
+    constexpr packed_vector() noexcept = default;
+
+    // Packs a vector. Throws std::invalid_argument if q, r or s lies outside [min_value, max_value], which cannot happen
+    // if the sum of any two valid coordinates of T fits.
+    template<std::signed_integral T>
+    constexpr explicit packed_vector(vector<T> const& vec);
+
+    // Returns the packed vector with the given word, which must have been returned by word().
+    [[nodiscard]] static constexpr auto from_word(Word word) noexcept -> packed_vector;
+
+    [[nodiscard]] constexpr auto operator==(packed_vector const& rhs) const noexcept -> bool = default;
+    [[nodiscard]] constexpr auto operator<=>(packed_vector const& rhs) const noexcept        = default;
+
+    // Unpacks the vector. The conversion is implicit if it is non-narrowing.
+    template<std::signed_integral T>
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    constexpr explicit(detail::narrowing<coordinate_type, T>) operator vector<T>() const noexcept;
+
+    [[nodiscard]] constexpr auto word() const noexcept -> Word;
+    [[nodiscard]] constexpr auto q() const noexcept -> coordinate_type;
+    [[nodiscard]] constexpr auto r() const noexcept -> coordinate_type;
+
+  private:
+    static constexpr unsigned half = std::numeric_limits<Word>::digits / 2;
+    using half_type                = std::make_unsigned_t<coordinate_type>;
+
+    // Maps [min_value, max_value] into [0, 2^half - 1] in order, by flipping the sign bit.
+    [[nodiscard]] static constexpr auto encode(coordinate_type value) noexcept -> Word;
+    [[nodiscard]] static constexpr auto decode(Word bits) noexcept -> coordinate_type;
+
+    Word m_word = (encode(0) << half) | encode(0);
+};
+} // namespace hex
+
+// Hashes a packed vector by mixing its word.
+template<typename Word>
+struct std::hash<hex::packed_vector<Word>>
+{
+    [[nodiscard]] constexpr auto operator()(hex::packed_vector<Word> const& vec) const noexcept -> std::size_t;
+};
+
+// ------------------------------ implementation below ------------------------------
+
+template<std::unsigned_integral Word>
+    requires(std::same_as<Word, std::uint32_t> || std::same_as<Word, std::uint64_t>)
+template<std::signed_integral T>
+constexpr hex::packed_vector<Word>::packed_vector(vector<T> const& vec)
+{
+    auto const q = vec.q().value();
+    auto const r = vec.r().value();
+    // Valid coordinates are at most half the range of T, so their sum cannot overflow std::int64_t.
+    if constexpr (2 * static_cast<std::int64_t>(coordinate<coordinate_axis::q, T>::max_value) > max_value)
+    {
+        auto const s = -(static_cast<std::int64_t>(q) + static_cast<std::int64_t>(r));
+        if (q < min_value || q > max_value || r < min_value || r > max_value || s < min_value || s > max_value)
+            throw std::invalid_argument("vector coordinates exceed the range of the packed vector");
+    }
+    m_word = (encode(static_cast<coordinate_type>(q)) << half) | encode(static_cast<coordinate_type>(r));
+}
+
+template<std::unsigned_integral Word>
+    requires(std::same_as<Word, std::uint32_t> || std::same_as<Word, std::uint64_t>)
+constexpr auto hex::packed_vector<Word>::from_word(Word word) noexcept -> packed_vector
+{
+    packed_vector result;
+    result.m_word = word;
+    return result;
+}
+
+template<std::unsigned_integral Word>
+    requires(std::same_as<Word, std::uint32_t> || std::same_as<Word, std::uint64_t>)
+template<std::signed_integral T>
+constexpr hex::packed_vector<Word>::operator vector<T>() const noexcept
+{
+    return vector<T>{q_coordinate<T>(static_cast<T>(q())), r_coordinate<T>(static_cast<T>(r()))};
+}
+
+template<std::unsigned_integral Word>
+    requires(std::same_as<Word, std::uint32_t> || std::same_as<Word, std::uint64_t>)
+constexpr auto hex::packed_vector<Word>::word() const noexcept -> Word
+{
+    return m_word;
+}
+
+template<std::unsigned_integral Word>
+    requires(std::same_as<Word, std::uint32_t> || std::same_as<Word, std::uint64_t>)
+constexpr auto hex::packed_vector<Word>::q() const noexcept -> coordinate_type
+{
+    return decode(m_word >> half);
+}
+
+template<std::unsigned_integral Word>
+    requires(std::same_as<Word, std::uint32_t> || std::same_as<Word, std::uint64_t>)
+constexpr auto hex::packed_vector<Word>::r() const noexcept -> coordinate_type
+{
+    return decode(m_word);
+}
+
+template<std::unsigned_integral Word>
+    requires(std::same_as<Word, std::uint32_t> || std::same_as<Word, std::uint64_t>)
+constexpr auto hex::packed_vector<Word>::encode(coordinate_type value) noexcept -> Word
+{
+    constexpr auto sign = static_cast<half_type>(half_type{1} << (half - 1));
+    return static_cast<half_type>(static_cast<half_type>(value) ^ sign);
+}
+
+template<std::unsigned_integral Word>
+    requires(std::same_as<Word, std::uint32_t> || std::same_as<Word, std::uint64_t>)
+constexpr auto hex::packed_vector<Word>::decode(Word bits) noexcept -> coordinate_type
+{
+    constexpr auto sign = static_cast<half_type>(half_type{1} << (half - 1));
+    return static_cast<coordinate_type>(static_cast<half_type>(static_cast<half_type>(bits) ^ sign));
+}
+
+template<typename Word>
+constexpr auto std::hash<hex::packed_vector<Word>>::operator()(hex::packed_vector<Word> const& vec) const noexcept
+    -> std::size_t
+{
+    return static_cast<std::size_t>(hex::detail::hash_mix(vec.word()));
+}
+
+#endif // HEX_PACKED_VECTOR_HPP
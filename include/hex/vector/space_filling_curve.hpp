@@ -0,0 +1,195 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_SPACE_FILLING_CURVE_HPP
+#define HEX_SPACE_FILLING_CURVE_HPP
+
+#include "hex/vector/coordinate.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <concepts>
+#include <utility>
+
+#include <cstdint>
+
+namespace hex
+{
+// Returns the position of the given vector on the Morton (Z-order) curve, interleaving the bits of q and r. Both
+// coordinates are offset by 2^31 first, so that the whole coordinate range maps to distinct codes.
+template<std::signed_integral T>
+    requires(sizeof(T) <= sizeof(std::int32_t))
+[[nodiscard]] constexpr auto morton_encode(vector<T> const& vec) noexcept -> std::uint64_t;
+
+// Inverse of morton_encode().
+template<std::signed_integral T = int>
+    requires(sizeof(T) <= sizeof(std::int32_t))
+[[nodiscard]] constexpr auto morton_decode(std::uint64_t code) noexcept -> vector<T>;
+
+// Returns the position of the given vector on the Hilbert curve through the 2^32 x 2^32 (q, r) square, with both
+// coordinates offset by 2^31. Unlike the Morton curve, consecutive codes always belong to vectors that differ by 1 in
+// exactly one of q and r.
+template<std::signed_integral T>
+    requires(sizeof(T) <= sizeof(std::int32_t))
+[[nodiscard]] constexpr auto hilbert_encode(vector<T> const& vec) noexcept -> std::uint64_t;
+
+// Inverse of hilbert_encode().
+template<std::signed_integral T = int>
+    requires(sizeof(T) <= sizeof(std::int32_t))
+[[nodiscard]] constexpr auto hilbert_decode(std::uint64_t code) noexcept -> vector<T>;
+
+namespace detail
+{
+// Spreads the bits of x to the even bits of the result.
+constexpr auto spread_bits(std::uint32_t x) noexcept -> std::uint64_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    std::uint64_t v = x;
+    v               = (v | (v << 16U)) & 0x0000FFFF0000FFFFULL;
+    v               = (v | (v << 8U)) & 0x00FF00FF00FF00FFULL;
+    v               = (v | (v << 4U)) & 0x0F0F0F0F0F0F0F0FULL;
+    v               = (v | (v << 2U)) & 0x3333333333333333ULL;
+    v               = (v | (v << 1U)) & 0x5555555555555555ULL;
+    return v;
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+}
+
+// Inverse of spread_bits(). Ignores the odd bits of v.
+constexpr auto compact_bits(std::uint64_t v) noexcept -> std::uint32_t
+{
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    v &= 0x5555555555555555ULL;
+    v = (v | (v >> 1U)) & 0x3333333333333333ULL;
+    v = (v | (v >> 2U)) & 0x0F0F0F0F0F0F0F0FULL;
+    v = (v | (v >> 4U)) & 0x00FF00FF00FF00FFULL;
+    v = (v | (v >> 8U)) & 0x0000FFFF0000FFFFULL;
+    v = (v | (v >> 16U)) & 0x00000000FFFFFFFFULL;
+    return static_cast<std::uint32_t>(v);
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+}
+
+// Returns the position of (x, y) on the Hilbert curve through the 2^order x 2^order square. x and y must be less than
+// 2^order, and order at most 32.
+constexpr auto hilbert_index(std::uint32_t x, std::uint32_t y, unsigned order) noexcept -> std::uint64_t
+{
+    std::uint64_t index = 0;
+    for (auto level = order; level-- > 0;)
+    {
+        auto const s  = std::uint32_t{1} << level;
+        auto const rx = (x & s) != 0 ? 1U : 0U;
+        auto const ry = (y & s) != 0 ? 1U : 0U;
+        index += (std::uint64_t{s} * s) * ((3U * rx) ^ ry);
+        // Rotate the quadrant, so that the curve within it starts and ends at the right corners.
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = (s - 1) - (x & (s - 1));
+                y = (s - 1) - (y & (s - 1));
+            }
+            std::swap(x, y);
+        }
+    }
+    return index;
+}
+
+// Inverse of hilbert_index().
+constexpr auto hilbert_point(std::uint64_t index, unsigned order) noexcept -> std::pair<std::uint32_t, std::uint32_t>
+{
+    std::uint32_t x = 0;
+    std::uint32_t y = 0;
+    for (unsigned level = 0; level < order; ++level)
+    {
+        auto const s  = std::uint32_t{1} << level;
+        auto const rx = static_cast<std::uint32_t>(1U & (index >> 1U));
+        auto const ry = static_cast<std::uint32_t>(1U & (index ^ rx));
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = (s - 1) - x;
+                y = (s - 1) - y;
+            }
+            std::swap(x, y);
+        }
+        x += s * rx;
+        y += s * ry;
+        index >>= 2U;
+    }
+    return {x, y};
+}
+
+// Maps a signed coordinate to [0, 2^32) in order, by flipping the sign bit.
+template<std::signed_integral T>
+constexpr auto curve_coordinate(T value) noexcept -> std::uint32_t
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    return static_cast<std::uint32_t>(static_cast<std::int32_t>(value)) ^ 0x80000000U;
+}
+
+// Inverse of curve_coordinate().
+template<std::signed_integral T>
+constexpr auto curve_value(std::uint32_t coordinate) noexcept -> T
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    return static_cast<T>(static_cast<std::int32_t>(coordinate ^ 0x80000000U));
+}
+} // namespace detail
+} // namespace hex
+
+// ------------------------------ implementation below ------------------------------
+
+template<std::signed_integral T>
+    requires(sizeof(T) <= sizeof(std::int32_t))
+constexpr auto hex::morton_encode(vector<T> const& vec) noexcept -> std::uint64_t
+{
+    return detail::spread_bits(detail::curve_coordinate(vec.q().value()))
+         | (detail::spread_bits(detail::curve_coordinate(vec.r().value())) << 1U);
+}
+
+template<std::signed_integral T>
+    requires(sizeof(T) <= sizeof(std::int32_t))
+constexpr auto hex::morton_decode(std::uint64_t code) noexcept -> vector<T>
+{
+    return vector<T>{q_coordinate<T>(detail::curve_value<T>(detail::compact_bits(code))),
+                     r_coordinate<T>(detail::curve_value<T>(detail::compact_bits(code >> 1U)))};
+}
+
+template<std::signed_integral T>
+    requires(sizeof(T) <= sizeof(std::int32_t))
+constexpr auto hex::hilbert_encode(vector<T> const& vec) noexcept -> std::uint64_t
+{
+    auto const q = detail::curve_coordinate(vec.q().value());
+    auto const r = detail::curve_coordinate(vec.r().value());
+    return detail::hilbert_index(q, r, 32); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+}
+
+template<std::signed_integral T>
+    requires(sizeof(T) <= sizeof(std::int32_t))
+constexpr auto hex::hilbert_decode(std::uint64_t code) noexcept -> vector<T>
+{
+    auto const [q, r] = detail::hilbert_point(code, 32); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    return vector<T>{q_coordinate<T>(detail::curve_value<T>(q)), r_coordinate<T>(detail::curve_value<T>(r))};
+}
+
+#endif // HEX_SPACE_FILLING_CURVE_HPP
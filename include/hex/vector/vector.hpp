@@ -26,6 +26,7 @@
 #define HEX_VECTOR_HPP
 
 #include "hex/detail/detail_arithmetic.hpp"
+#include "hex/detail/detail_hash.hpp"
 #include "hex/detail/detail_narrowing.hpp"
 #include "hex/vector/coordinate.hpp"
 #include "hex/vector/coordinate_axis.hpp"
@@ -35,12 +36,14 @@
 #include <array>
 #include <concepts>
 #include <format>
+#include <functional>
 #include <iterator>
 #include <numbers>
 #include <type_traits>
 #include <utility>
 
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 
 namespace hex
@@ -238,6 +241,14 @@ struct std::formatter<hex::vector<T>, CharT>
     constexpr auto format(hex::vector<T> vec, FmtContext& ctx) const -> FmtContext::iterator;
 };
 
+// Hashes a vector by mixing both coordinates into a single word. Integral vectors of at most 32 bits per coordinate are
+// packed losslessly before mixing, so distinct vectors only collide after the final reduction to the table size.
+template<typename T>
+struct std::hash<hex::vector<T>>
+{
+    [[nodiscard]] constexpr auto operator()(hex::vector<T> const& vec) const noexcept -> std::size_t;
+};
+
 // ------------------------------ implementation below ------------------------------
 
 namespace hex
@@ -629,4 +640,18 @@ constexpr auto std::formatter<hex::vector<T>, CharT>::format(hex::vector<T> vec,
     return std::format_to(ctx.out(), ")");
 }
 
+template<typename T>
+constexpr auto std::hash<hex::vector<T>>::operator()(hex::vector<T> const& vec) const noexcept -> std::size_t
+{
+    auto const q = vec.q().value();
+    auto const r = vec.r().value();
+    if constexpr (std::signed_integral<T> && sizeof(T) <= sizeof(std::int32_t))
+        return static_cast<std::size_t>(hex::detail::hash_mix(hex::detail::pack_qr(q, r)));
+    else if constexpr (std::integral<T>)
+        return static_cast<std::size_t>(
+            hex::detail::hash_combine(static_cast<std::uint64_t>(q), static_cast<std::uint64_t>(r)));
+    else
+        return static_cast<std::size_t>(hex::detail::hash_combine(std::hash<T>{}(q), std::hash<T>{}(r)));
+}
+
 #endif // HEX_VECTOR_HPP
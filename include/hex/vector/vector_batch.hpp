@@ -0,0 +1,448 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_VECTOR_BATCH_HPP
+#define HEX_VECTOR_BATCH_HPP
+
+#include "hex/detail/detail_aligned_allocator.hpp"
+#include "hex/detail/detail_arithmetic.hpp"
+#include "hex/vector/coordinate_axis.hpp"
+#include "hex/vector/detail/detail_simd_lanes.hpp"
+#include "hex/vector/rotation_steps.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace hex
+{
+// A sequence of vectors stored as two arrays, one per coordinate, aligned to cache lines. Operations on whole batches
+// process 32-bit integer coordinates in vector registers, 8 at a time with AVX2 and 4 at a time with SSE2, whichever
+// the compiler targets, and all other coordinate types one value at a time.
+template<detail::arithmetic T = int>
+class vector_batch
+{
+  public:
+    using value_type      = vector<T>;
+    using coordinate_type = T;
+    using size_type       = std::size_t;
+
+    // The alignment of q_data() and r_data() in bytes.
+    static constexpr size_type alignment = 64;
+
+    constexpr vector_batch() = default;
+    // Initializes the batch with count zero vectors.
+    constexpr explicit vector_batch(size_type count);
+    constexpr vector_batch(std::initializer_list<vector<T>> init);
+    template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    constexpr vector_batch(InputIt first, Sentinel last);
+
+    [[nodiscard]] constexpr auto size() const noexcept -> size_type;
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool;
+    constexpr void               reserve(size_type capacity);
+    // Resizes the batch, appending zero vectors if it grows.
+    constexpr void resize(size_type count);
+    constexpr void clear() noexcept;
+    constexpr void push_back(vector<T> const& vec);
+
+    // Returns the vector at index. UB if index >= size().
+    [[nodiscard]] constexpr auto operator[](size_type index) const -> vector<T>;
+    // Replaces the vector at index. UB if index >= size().
+    constexpr void set(size_type index, vector<T> const& vec);
+
+    // Returns the q coordinates, aligned to alignment bytes.
+    [[nodiscard]] constexpr auto q_data() noexcept -> T*;
+    [[nodiscard]] constexpr auto q_data() const noexcept -> T const*;
+    // Returns the r coordinates, aligned to alignment bytes.
+    [[nodiscard]] constexpr auto r_data() noexcept -> T*;
+    [[nodiscard]] constexpr auto r_data() const noexcept -> T const*;
+
+    [[nodiscard]] constexpr auto operator==(vector_batch const& other) const -> bool = default;
+
+    // Adds rhs to every vector.
+    constexpr auto operator+=(vector<T> const& rhs) -> vector_batch&;
+    // Subtracts rhs from every vector.
+    constexpr auto operator-=(vector<T> const& rhs) -> vector_batch&;
+    // Multiplies every vector by rhs.
+    constexpr auto operator*=(T const& rhs) -> vector_batch&;
+    // Adds the vectors of rhs element-wise. Throws std::invalid_argument if the sizes differ.
+    constexpr auto operator+=(vector_batch const& rhs) -> vector_batch&;
+    // Subtracts the vectors of rhs element-wise. Throws std::invalid_argument if the sizes differ.
+    constexpr auto operator-=(vector_batch const& rhs) -> vector_batch&;
+
+    // Writes the distance in hex grid tiles from the origin of every vector to out. Throws std::invalid_argument if out
+    // is not of size().
+    constexpr void norm(std::span<T> out) const;
+
+  private:
+    using storage = std::vector<T, detail::aligned_allocator<T, alignment>>;
+
+    storage m_q;
+    storage m_r;
+};
+
+// Sums every vector of a batch and a vector.
+template<detail::arithmetic T>
+[[nodiscard]] constexpr auto operator+(vector_batch<T> lhs, vector<T> const& rhs) -> vector_batch<T>;
+template<detail::arithmetic T>
+[[nodiscard]] constexpr auto operator+(vector<T> const& lhs, vector_batch<T> rhs) -> vector_batch<T>;
+// Sums two batches element-wise. Throws std::invalid_argument if the sizes differ.
+template<detail::arithmetic T>
+[[nodiscard]] constexpr auto operator+(vector_batch<T> lhs, vector_batch<T> const& rhs) -> vector_batch<T>;
+
+// Subtracts a vector from every vector of a batch.
+template<detail::arithmetic T>
+[[nodiscard]] constexpr auto operator-(vector_batch<T> lhs, vector<T> const& rhs) -> vector_batch<T>;
+// Subtracts a batch from another element-wise. Throws std::invalid_argument if the sizes differ.
+template<detail::arithmetic T>
+[[nodiscard]] constexpr auto operator-(vector_batch<T> lhs, vector_batch<T> const& rhs) -> vector_batch<T>;
+
+// Multiplies every vector of a batch by a factor.
+template<detail::arithmetic T>
+[[nodiscard]] constexpr auto operator*(vector_batch<T> lhs, std::type_identity_t<T> const& rhs) -> vector_batch<T>;
+template<detail::arithmetic T>
+[[nodiscard]] constexpr auto operator*(std::type_identity_t<T> const& lhs, vector_batch<T> rhs) -> vector_batch<T>;
+
+// Writes the hex grid distance between every vector of from and to to out. Throws std::invalid_argument if out is not
+// of from.size().
+template<detail::arithmetic T>
+constexpr void distance(vector_batch<T> const& from, vector<T> const& to, std::span<std::type_identity_t<T>> out);
+
+// Rotates every vector of a batch in 60° steps either clockwise (rotations > 0) or counter-clockwise (rotations < 0).
+template<detail::arithmetic T>
+[[nodiscard]] constexpr auto rotate(vector_batch<T> batch, rotation_steps steps) -> vector_batch<T>;
+
+// Reflects every vector of a batch across an axis.
+template<detail::arithmetic T>
+[[nodiscard]] constexpr auto reflect(vector_batch<T> batch, coordinate_axis axis) -> vector_batch<T>;
+} // namespace hex
+
+// ------------------------------ implementation below ------------------------------
+
+template<hex::detail::arithmetic T>
+constexpr hex::vector_batch<T>::vector_batch(size_type count)
+    : m_q(count)
+    , m_r(count)
+{
+}
+
+template<hex::detail::arithmetic T>
+constexpr hex::vector_batch<T>::vector_batch(std::initializer_list<vector<T>> init)
+    : vector_batch(init.begin(), init.end())
+{
+}
+
+template<hex::detail::arithmetic T>
+template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+constexpr hex::vector_batch<T>::vector_batch(InputIt first, Sentinel last)
+{
+    if constexpr (std::sized_sentinel_for<Sentinel, InputIt>)
+        reserve(static_cast<size_type>(last - first));
+    for (; first != last; ++first)
+        push_back(*first);
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::vector_batch<T>::size() const noexcept -> size_type
+{
+    return m_q.size();
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::vector_batch<T>::empty() const noexcept -> bool
+{
+    return m_q.empty();
+}
+
+template<hex::detail::arithmetic T>
+constexpr void hex::vector_batch<T>::reserve(size_type capacity)
+{
+    m_q.reserve(capacity);
+    m_r.reserve(capacity);
+}
+
+template<hex::detail::arithmetic T>
+constexpr void hex::vector_batch<T>::resize(size_type count)
+{
+    m_q.resize(count);
+    m_r.resize(count);
+}
+
+template<hex::detail::arithmetic T>
+constexpr void hex::vector_batch<T>::clear() noexcept
+{
+    m_q.clear();
+    m_r.clear();
+}
+
+template<hex::detail::arithmetic T>
+constexpr void hex::vector_batch<T>::push_back(vector<T> const& vec)
+{
+    m_q.push_back(vec.q().value());
+    m_r.push_back(vec.r().value());
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::vector_batch<T>::operator[](size_type index) const -> vector<T>
+{
+    return vector<T>{q_coordinate<T>(m_q[index]), r_coordinate<T>(m_r[index])};
+}
+
+template<hex::detail::arithmetic T>
+constexpr void hex::vector_batch<T>::set(size_type index, vector<T> const& vec)
+{
+    m_q[index] = vec.q().value();
+    m_r[index] = vec.r().value();
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::vector_batch<T>::q_data() noexcept -> T*
+{
+    return m_q.data();
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::vector_batch<T>::q_data() const noexcept -> T const*
+{
+    return m_q.data();
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::vector_batch<T>::r_data() noexcept -> T*
+{
+    return m_r.data();
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::vector_batch<T>::r_data() const noexcept -> T const*
+{
+    return m_r.data();
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::vector_batch<T>::operator+=(vector<T> const& rhs) -> vector_batch&
+{
+    detail::simd_update(m_q.data(),
+                        m_r.data(),
+                        size(),
+                        [rhs_q = rhs.q().value(), rhs_r = rhs.r().value()]<typename L>(L, auto q, auto r) {
+                            return std::pair(L::add(q, L::broadcast(rhs_q)), L::add(r, L::broadcast(rhs_r)));
+                        });
+    return *this;
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::vector_batch<T>::operator-=(vector<T> const& rhs) -> vector_batch&
+{
+    detail::simd_update(m_q.data(),
+                        m_r.data(),
+                        size(),
+                        [rhs_q = rhs.q().value(), rhs_r = rhs.r().value()]<typename L>(L, auto q, auto r) {
+                            return std::pair(L::sub(q, L::broadcast(rhs_q)), L::sub(r, L::broadcast(rhs_r)));
+                        });
+    return *this;
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::vector_batch<T>::operator*=(T const& rhs) -> vector_batch&
+{
+    detail::simd_update(m_q.data(),
+                        m_r.data(),
+                        size(),
+                        [rhs]<typename L>(L, auto q, auto r) {
+                            return std::pair(L::mul(q, L::broadcast(rhs)), L::mul(r, L::broadcast(rhs)));
+                        });
+    return *this;
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::vector_batch<T>::operator+=(vector_batch const& rhs) -> vector_batch&
+{
+    if (rhs.size() != size())
+        throw std::invalid_argument("batch sizes do not match");
+    detail::simd_combine(m_q.data(),
+                         m_r.data(),
+                         rhs.m_q.data(),
+                         rhs.m_r.data(),
+                         size(),
+                         []<typename L>(L, auto q, auto r, auto other_q, auto other_r)
+                         { return std::pair(L::add(q, other_q), L::add(r, other_r)); });
+    return *this;
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::vector_batch<T>::operator-=(vector_batch const& rhs) -> vector_batch&
+{
+    if (rhs.size() != size())
+        throw std::invalid_argument("batch sizes do not match");
+    detail::simd_combine(m_q.data(),
+                         m_r.data(),
+                         rhs.m_q.data(),
+                         rhs.m_r.data(),
+                         size(),
+                         []<typename L>(L, auto q, auto r, auto other_q, auto other_r)
+                         { return std::pair(L::sub(q, other_q), L::sub(r, other_r)); });
+    return *this;
+}
+
+template<hex::detail::arithmetic T>
+constexpr void hex::vector_batch<T>::norm(std::span<T> out) const
+{
+    if (out.size() != size())
+        throw std::invalid_argument("output size does not match batch size");
+    detail::simd_map(m_q.data(),
+                     m_r.data(),
+                     out.data(),
+                     size(),
+                     []<typename L>(L, auto q, auto r)
+                     {
+                         auto const s = L::neg(L::add(q, r));
+                         return L::max(L::max(L::abs(q), L::abs(r)), L::abs(s));
+                     });
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::operator+(vector_batch<T> lhs, vector<T> const& rhs) -> vector_batch<T>
+{
+    lhs += rhs;
+    return lhs;
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::operator+(vector<T> const& lhs, vector_batch<T> rhs) -> vector_batch<T>
+{
+    rhs += lhs;
+    return rhs;
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::operator+(vector_batch<T> lhs, vector_batch<T> const& rhs) -> vector_batch<T>
+{
+    lhs += rhs;
+    return lhs;
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::operator-(vector_batch<T> lhs, vector<T> const& rhs) -> vector_batch<T>
+{
+    lhs -= rhs;
+    return lhs;
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::operator-(vector_batch<T> lhs, vector_batch<T> const& rhs) -> vector_batch<T>
+{
+    lhs -= rhs;
+    return lhs;
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::operator*(vector_batch<T> lhs, std::type_identity_t<T> const& rhs) -> vector_batch<T>
+{
+    lhs *= rhs;
+    return lhs;
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::operator*(std::type_identity_t<T> const& lhs, vector_batch<T> rhs) -> vector_batch<T>
+{
+    rhs *= lhs;
+    return rhs;
+}
+
+template<hex::detail::arithmetic T>
+constexpr void hex::distance(vector_batch<T> const& from, vector<T> const& to, std::span<std::type_identity_t<T>> out)
+{
+    if (out.size() != from.size())
+        throw std::invalid_argument("output size does not match batch size");
+    detail::simd_map(from.q_data(),
+                     from.r_data(),
+                     out.data(),
+                     from.size(),
+                     [to_q = to.q().value(), to_r = to.r().value()]<typename L>(L, auto q, auto r)
+                     {
+                         auto const dq = L::sub(L::broadcast(to_q), q);
+                         auto const dr = L::sub(L::broadcast(to_r), r);
+                         auto const ds = L::neg(L::add(dq, dr));
+                         return L::max(L::max(L::abs(dq), L::abs(dr)), L::abs(ds));
+                     });
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::rotate(vector_batch<T> batch, rotation_steps steps) -> vector_batch<T>
+{
+    // With s = -q - r, every rotation maps (q, r) to a pair of +-q, +-r and +-s.
+    auto const apply = [&](auto kernel) { detail::simd_update(batch.q_data(), batch.r_data(), batch.size(), kernel); };
+    switch (steps.clockwise_steps())
+    {
+    case 0: // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        break;
+    case 1: // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        apply([]<typename L>(L, auto q, auto r) { return std::pair(L::neg(r), L::add(q, r)); });
+        break;
+    case 2: // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        apply([]<typename L>(L, auto q, auto r) { return std::pair(L::neg(L::add(q, r)), q); });
+        break;
+    case 3: // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        apply([]<typename L>(L, auto q, auto r) { return std::pair(L::neg(q), L::neg(r)); });
+        break;
+    case 4: // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        apply([]<typename L>(L, auto q, auto r) { return std::pair(r, L::neg(L::add(q, r))); });
+        break;
+    case 5: // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        apply([]<typename L>(L, auto q, auto r) { return std::pair(L::add(q, r), L::neg(q)); });
+        break;
+    default:
+        std::unreachable();
+    }
+    return batch;
+}
+
+template<hex::detail::arithmetic T>
+constexpr auto hex::reflect(vector_batch<T> batch, coordinate_axis axis) -> vector_batch<T>
+{
+    auto const apply = [&](auto kernel) { detail::simd_update(batch.q_data(), batch.r_data(), batch.size(), kernel); };
+    switch (axis)
+    {
+    case coordinate_axis::q:
+        apply([]<typename L>(L, auto q, auto r) { return std::pair(q, L::neg(L::add(q, r))); });
+        break;
+    case coordinate_axis::r:
+        apply([]<typename L>(L, auto q, auto r) { return std::pair(L::neg(L::add(q, r)), r); });
+        break;
+    case coordinate_axis::s:
+        apply([]<typename L>(L, auto q, auto r) { return std::pair(r, q); });
+        break;
+    }
+    return batch;
+}
+
+#endif // HEX_VECTOR_BATCH_HPP
@@ -30,7 +30,10 @@
 #include "hex/vector/vector.hpp"
 #include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
 #include "hex/views/convex_polygon/detail/detail_convex_polygon_iterator.hpp"
+#include "hex/views/convex_polygon/detail/detail_convex_polygon_rows.hpp"
 #include "hex/views/convex_polygon/detail/detail_hexagon_size.hpp"
+#include "hex/views/convex_polygon/detail/detail_row_start_table.hpp"
+#include "hex/views/rows/rows_view.hpp"
 
 #include <concepts>
 #include <ranges>
@@ -41,39 +44,52 @@ namespace hex
 {
 // A view that models std::ranges::sized_range, std::ranges::common_range, std::ranges::random_access_range,
 // std::ranges::borrowed_range and std::constant_range, producing all hex positions in a convex polygon.
-template<std::signed_integral T>
-class convex_polygon_view : public std::ranges::view_interface<convex_polygon_view<T>>
+//
+// If MaxRows is non-zero, the view precomputes the index of the first tile of every q row for polygons with at most
+// MaxRows rows, turning the conversions between indices and positions into a table lookup. The table is stored inline
+// and costs (MaxRows + 1) * sizeof(std::size_t) bytes, about 8 KB for MaxRows = 1025, which every copy of the view and
+// of a grid over it pays again; pass such views and grids by reference. The view is no longer a borrowed_range since
+// its iterators refer to the table. Larger polygons fall back to the closed-form conversions.
+template<std::signed_integral T, std::size_t MaxRows = 0>
+class convex_polygon_view : public std::ranges::view_interface<convex_polygon_view<T, MaxRows>>
 {
   public:
+    using iterator = detail::convex_polygon_iterator<T, MaxRows>;
+
     // Constructs the view with the given parameters.
     constexpr convex_polygon_view(convex_polygon_parameters<T> const& params);
 
-    [[nodiscard]] constexpr auto begin() const noexcept -> detail::convex_polygon_iterator<T>;
-    [[nodiscard]] constexpr auto end() const noexcept -> detail::convex_polygon_iterator<T>;
+    [[nodiscard]] constexpr auto begin() const noexcept -> iterator;
+    [[nodiscard]] constexpr auto end() const noexcept -> iterator;
 
     [[nodiscard]] constexpr auto size() const noexcept -> std::size_t;
 
     // Returns true if the given element is in the range, otherwise false. O(1).
     [[nodiscard]] constexpr auto contains(vector<T> const& v) const noexcept -> bool;
     // Returns an iterator to the given element if it is in the range, otherwise end().
-    [[nodiscard]] constexpr auto find(vector<T> const& v) const noexcept -> detail::convex_polygon_iterator<T>;
+    [[nodiscard]] constexpr auto find(vector<T> const& v) const noexcept -> iterator;
 
-    // Returns the element at the specified index. Note that this operation, while O(1), has a fairly large constant
-    // factor. Results are correct as long as max(q_max-q_min, r_max-r_min, s_max-s_min) <= 2^31 − 1. UB if the given
-    // index is out of range.
+    // Returns the element at the specified index. Unless the row start table is in use, this operation, while O(1),
+    // has a fairly large constant factor; with the table it is O(log(rows)). Results are correct as long as
+    // max(q_max-q_min, r_max-r_min, s_max-s_min) <= 2^31 − 1. UB if the given index is out of range.
     [[nodiscard]] constexpr auto operator[](std::size_t idx) const noexcept -> vector<T>;
-    // Returns the index of the given element. Note that this operation, while O(1), has a fairly large constant
-    // factor. Results are correct as long as max(q_max-q_min, r_max-r_min, s_max-s_min) <= 2^31 − 1. UB if the given
-    // element is out of range.
+    // Returns the index of the given element. Unless the row start table is in use, this operation, while O(1), has a
+    // fairly large constant factor. Results are correct as long as max(q_max-q_min, r_max-r_min, s_max-s_min) <=
+    // 2^31 − 1. UB if the given element is out of range.
     [[nodiscard]] constexpr auto operator[](vector<T> const& v) const noexcept -> std::size_t;
 
+    // Returns a random-access view of the polygon's q rows, in iteration order. Each row runs along +r, and its tiles
+    // are contiguous in iteration order.
+    [[nodiscard]] constexpr auto rows() const noexcept -> rows_view<detail::convex_polygon_row<T>>;
+
     // Retrieves the parameters used for construction.
     [[nodiscard]] constexpr auto parameters() const noexcept -> convex_polygon_parameters<T> const&;
 
     [[nodiscard]] constexpr auto operator==(convex_polygon_view const& other) const -> bool;
 
   private:
-    convex_polygon_parameters<T> m_params;
+    convex_polygon_parameters<T>        m_params;
+    detail::row_start_table<T, MaxRows> m_rows;
 };
 
 namespace views
@@ -85,59 +101,63 @@ template<std::signed_integral T = int>
 
 // ------------------------------ implementation below ------------------------------
 
-template<std::signed_integral T>
-constexpr convex_polygon_view<T>::convex_polygon_view(convex_polygon_parameters<T> const& params)
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr convex_polygon_view<T, MaxRows>::convex_polygon_view(convex_polygon_parameters<T> const& params)
     : m_params(params)
+    , m_rows(params)
 {
 }
 
-template<std::signed_integral T>
-constexpr auto convex_polygon_view<T>::begin() const noexcept -> detail::convex_polygon_iterator<T>
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr auto convex_polygon_view<T, MaxRows>::begin() const noexcept -> iterator
 {
-    return detail::convex_polygon_iterator<T>(m_params, vector(m_params.qmin(), m_params.smax()), 0UZ);
+    return iterator(*this, vector(m_params.qmin(), m_params.smax()));
 }
-template<std::signed_integral T>
-constexpr auto convex_polygon_view<T>::end() const noexcept -> detail::convex_polygon_iterator<T>
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr auto convex_polygon_view<T, MaxRows>::end() const noexcept -> iterator
 {
-    using namespace literals;
-    return ++detail::convex_polygon_iterator<T>(m_params, vector(m_params.qmax(), m_params.smin()), size() - 1);
+    return iterator(*this, size());
 }
 
-template<std::signed_integral T>
-constexpr auto convex_polygon_view<T>::size() const noexcept -> std::size_t
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr auto convex_polygon_view<T, MaxRows>::size() const noexcept -> std::size_t
 {
     return m_params.count();
 }
 
-template<std::signed_integral T>
-constexpr auto convex_polygon_view<T>::contains(vector<T> const& v) const noexcept -> bool
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr auto convex_polygon_view<T, MaxRows>::contains(vector<T> const& v) const noexcept -> bool
 {
     return m_params.contains(v);
 }
 
-template<std::signed_integral T>
-constexpr auto convex_polygon_view<T>::find(vector<T> const& v) const noexcept -> detail::convex_polygon_iterator<T>
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr auto convex_polygon_view<T, MaxRows>::find(vector<T> const& v) const noexcept -> iterator
 {
     if (!contains(v))
         return end();
-    return detail::convex_polygon_iterator<T>(m_params, v);
+    return iterator(*this, v);
 }
 
-template<std::signed_integral T>
-constexpr auto convex_polygon_view<T>::operator[](std::size_t idx) const noexcept -> vector<T>
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr auto convex_polygon_view<T, MaxRows>::operator[](std::size_t idx) const noexcept -> vector<T>
 {
+    if (m_rows.tabulated())
+        return m_rows.position_of(idx, m_params);
     auto const [q, r] = detail::index_to_qr(idx,
                                             m_params.qmin().value(),
                                             m_params.rmin().value(),
                                             m_params.smin().value(),
                                             m_params.rmax().value(),
                                             m_params.smax().value());
-    return vector(q_coordinate<T>{q}, r_coordinate<T>{r});
+    return vector(q_coordinate<T>{static_cast<T>(q)}, r_coordinate<T>{static_cast<T>(r)});
 }
 
-template<std::signed_integral T>
-constexpr auto convex_polygon_view<T>::operator[](vector<T> const& v) const noexcept -> std::size_t
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr auto convex_polygon_view<T, MaxRows>::operator[](vector<T> const& v) const noexcept -> std::size_t
 {
+    if (m_rows.tabulated())
+        return m_rows.index_of(v, m_params);
     return detail::qr_to_index(v.q().value(),
                                v.r().value(),
                                m_params.qmin().value(),
@@ -147,14 +167,23 @@ constexpr auto convex_polygon_view<T>::operator[](vector<T> const& v) const noex
                                m_params.smax().value());
 }
 
-template<std::signed_integral T>
-constexpr auto convex_polygon_view<T>::parameters() const noexcept -> convex_polygon_parameters<T> const&
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr auto convex_polygon_view<T, MaxRows>::rows() const noexcept -> rows_view<detail::convex_polygon_row<T>>
+{
+    using row_iterator = detail::generating_random_access_iterator<detail::convex_polygon_row<T>>;
+    auto const row     = detail::convex_polygon_row<T>{m_params};
+    auto const count   = static_cast<std::size_t>(m_params.qmax().value() - m_params.qmin().value()) + 1UZ;
+    return {row_iterator(row, 0UZ), row_iterator(row, count)};
+}
+
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr auto convex_polygon_view<T, MaxRows>::parameters() const noexcept -> convex_polygon_parameters<T> const&
 {
     return m_params;
 }
 
-template<std::signed_integral T>
-constexpr auto convex_polygon_view<T>::operator==(convex_polygon_view const& other) const -> bool
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr auto convex_polygon_view<T, MaxRows>::operator==(convex_polygon_view const& other) const -> bool
 {
     return m_params == other.m_params;
 }
@@ -168,6 +197,6 @@ constexpr auto views::convex_polygon(convex_polygon_parameters<T> const& params)
 } // namespace hex
 
 template<std::signed_integral T>
-inline constexpr bool std::ranges::enable_borrowed_range<hex::convex_polygon_view<T>> = true;
+inline constexpr bool std::ranges::enable_borrowed_range<hex::convex_polygon_view<T, 0>> = true;
 
 #endif // HEX_CONVEX_POLYGON_VIEW_HPP
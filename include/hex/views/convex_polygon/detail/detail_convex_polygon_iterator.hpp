@@ -21,32 +21,53 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 //
-
 #ifndef DETAIL_BOUNDED_POLYGON_ITERATOR_HPP
 #define DETAIL_BOUNDED_POLYGON_ITERATOR_HPP
 
-#include "hex/detail/detail_arithmetic.hpp"
 #include "hex/vector/coordinate.hpp"
 #include "hex/vector/vector.hpp"
-#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
 #include "hex/views/convex_polygon/detail/detail_hexagon_size.hpp"
 
+#include <algorithm>
+#include <array>
 #include <compare>
+#include <concepts>
 #include <iterator>
+#include <type_traits>
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 
 namespace hex
 {
-template<std::signed_integral>
+template<std::signed_integral T, std::size_t MaxRows>
 class convex_polygon_view;
 
 namespace detail
 {
-template<typename T>
+// Iterates a convex polygon row by row. If MaxRows is zero, the iterator holds a copy of the polygon's r and s bounds,
+// which are all that stepping through its rows needs, and the current position, and does not depend on the view.
+// Otherwise it holds only a pointer to the view it was obtained from and the current position, so it must not outlive
+// the view. The position after the last row, (q_max + 1, max(r_min, -q_max - 1 - s_max)), acts as the past-the-end
+// position; it is where operator++ ends up after the last element.
+template<typename T, std::size_t MaxRows = 0>
 class convex_polygon_iterator
 {
+    using view_type = convex_polygon_view<T, MaxRows>;
+
+    // The bounds of the polygon's rows. Without the q bounds, indices are counted from q = -r_max - s_max, the first
+    // row of the parallelogram spanned by the r and s bounds alone. It contains the polygon's rows in iteration order,
+    // so differences of these indices equal differences of the view's indices.
+    struct row_bounds
+    {
+        r_coordinate<T> rmin;
+        r_coordinate<T> rmax;
+        s_coordinate<T> smin;
+        s_coordinate<T> smax;
+    };
+    using view_reference = std::conditional_t<MaxRows == 0, row_bounds, view_type const*>;
+
   public:
     using value_type        = vector<T> const;
     using difference_type   = std::ptrdiff_t;
@@ -54,27 +75,29 @@ class convex_polygon_iterator
     using iterator_category = std::input_iterator_tag;
 
     constexpr convex_polygon_iterator() = default;
-    constexpr convex_polygon_iterator(convex_polygon_parameters<T> params, std::size_t idx)
-        : convex_polygon_iterator(params, from_index(idx, params), idx)
+    constexpr convex_polygon_iterator(view_type const& view, std::size_t idx)
+        : m_view(reference_to(view))
+        , m_v(from_index(view, idx))
     {
     }
-    constexpr convex_polygon_iterator(convex_polygon_parameters<T> params, vector<T> v)
-        : convex_polygon_iterator(params, v, to_index(v, params))
+    constexpr convex_polygon_iterator(view_type const& view, vector<T> v)
+        : m_view(reference_to(view))
+        , m_v(v)
     {
     }
 
     constexpr auto operator++() noexcept -> convex_polygon_iterator&
     {
         using namespace literals;
-        if (m_v.r() < m_params.rmax() && m_v.s() > m_params.smin())
+        auto const bounds = this->bounds();
+        if (m_v.r() < bounds.rmax && m_v.s() > bounds.smin)
             m_v.set(m_v.q(), m_v.r() + 1_r);
         else
         {
-            m_v.set(m_v.q() + 1_q, m_params.rmin());
-            if (m_v.s() > m_params.smax())
-                m_v.set(m_v.q(), m_params.smax());
+            m_v.set(m_v.q() + 1_q, bounds.rmin);
+            if (m_v.s() > bounds.smax)
+                m_v.set(m_v.q(), bounds.smax);
         }
-        ++m_idx;
         return *this;
     }
     constexpr auto operator++(int) noexcept -> convex_polygon_iterator
@@ -86,7 +109,9 @@ class convex_polygon_iterator
     friend constexpr auto operator+(convex_polygon_iterator const& iter,
                                     difference_type                n) noexcept -> convex_polygon_iterator
     {
-        return convex_polygon_iterator{iter.m_params, iter.m_idx + n};
+        auto cp = iter;
+        cp += n;
+        return cp;
     }
     friend constexpr auto operator+(difference_type                n,
                                     convex_polygon_iterator const& iter) noexcept -> convex_polygon_iterator
@@ -95,23 +120,25 @@ class convex_polygon_iterator
     }
     constexpr auto operator+=(difference_type n) noexcept -> convex_polygon_iterator&
     {
-        m_idx += n;
-        m_v = from_index(m_idx, m_params);
+        if constexpr (MaxRows == 0)
+            m_v = from_bounds_index(m_view, bounds_index(m_view, m_v) + n);
+        else
+            m_v = from_index(*m_view, (*m_view)[m_v] + n);
         return *this;
     }
 
     constexpr auto operator--() noexcept -> convex_polygon_iterator&
     {
         using namespace literals;
-        if (m_v.r() > m_params.rmin() && m_v.s() < m_params.smax())
+        auto const bounds = this->bounds();
+        if (m_v.r() > bounds.rmin && m_v.s() < bounds.smax)
             m_v.set(m_v.q(), m_v.r() - 1_r);
         else
         {
-            m_v.set(m_v.q() - 1_q, m_params.rmax());
-            if (m_v.s() < m_params.smin())
-                m_v.set(m_v.q(), m_params.smin());
+            m_v.set(m_v.q() - 1_q, bounds.rmax);
+            if (m_v.s() < bounds.smin)
+                m_v.set(m_v.q(), bounds.smin);
         }
-        --m_idx;
         return *this;
     }
     constexpr auto operator--(int) noexcept -> convex_polygon_iterator
@@ -123,18 +150,29 @@ class convex_polygon_iterator
     friend constexpr auto operator-(convex_polygon_iterator const& iter,
                                     difference_type                n) noexcept -> convex_polygon_iterator
     {
-        return convex_polygon_iterator{iter.m_params, iter.m_idx - n};
+        auto cp = iter;
+        cp -= n;
+        return cp;
     }
     friend constexpr auto operator-(convex_polygon_iterator const& lhs,
                                     convex_polygon_iterator const& rhs) noexcept -> difference_type
     {
-        return lhs.m_idx - rhs.m_idx;
+        if (lhs == rhs)
+            return 0;
+        if constexpr (MaxRows == 0)
+        {
+            return static_cast<difference_type>(bounds_index(lhs.m_view, lhs.m_v))
+                 - static_cast<difference_type>(bounds_index(lhs.m_view, rhs.m_v));
+        }
+        else
+        {
+            auto const& view = lhs.m_view != nullptr ? *lhs.m_view : *rhs.m_view;
+            return static_cast<difference_type>(view[lhs.m_v]) - static_cast<difference_type>(view[rhs.m_v]);
+        }
     }
     constexpr auto operator-=(difference_type n) noexcept -> convex_polygon_iterator&
     {
-        m_idx -= n;
-        m_v = from_index(m_idx, m_params);
-        return *this;
+        return *this += -n;
     }
 
     constexpr auto operator*() const noexcept -> vector<T> const // NOLINT(readability-const-return-type)
@@ -147,55 +185,88 @@ class convex_polygon_iterator
 
     friend constexpr auto operator==(convex_polygon_iterator const& lhs, convex_polygon_iterator const& rhs) -> bool
     {
-        return lhs.m_idx == rhs.m_idx;
+        return lhs.m_v == rhs.m_v;
     }
     friend constexpr auto operator<=>(convex_polygon_iterator const& lhs,
                                       convex_polygon_iterator const& rhs) -> std::strong_ordering
     {
-        if (lhs == rhs)
-            return std::strong_ordering::equal;
-        return lhs.m_idx < rhs.m_idx ? std::strong_ordering::less : std::strong_ordering::greater;
+        // Rows are iterated in order of increasing q, and each row in order of increasing r.
+        if (auto const cmp = lhs.m_v.q() <=> rhs.m_v.q(); cmp != 0)
+            return cmp;
+        return lhs.m_v.r() <=> rhs.m_v.r();
     }
 
   private:
-    constexpr auto from_index(std::size_t idx, convex_polygon_parameters<T> const& params) const noexcept -> vector<T>
-    {
-        auto const [q, r] = detail::index_to_qr(idx,
-                                                params.qmin().value(),
-                                                params.rmin().value(),
-                                                params.smin().value(),
-                                                params.rmax().value(),
-                                                params.smax().value());
-        return vector<T>{q_coordinate<T>{static_cast<T>(q)}, r_coordinate<T>{static_cast<T>(r)}};
+    static constexpr auto reference_to(view_type const& view) noexcept -> view_reference
+    {
+        if constexpr (MaxRows == 0)
+        {
+            auto const& params = view.parameters();
+            return row_bounds{params.rmin(), params.rmax(), params.smin(), params.smax()};
+        }
+        else
+            return &view;
     }
-    constexpr auto to_index(vector<T> const&                    v,
-                            convex_polygon_parameters<T> const& params) const noexcept -> std::size_t
+    static constexpr auto detached() noexcept -> view_reference
     {
-        return detail::qr_to_index(v.q().value(),
-                                   v.r().value(),
-                                   params.qmin().value(),
-                                   params.rmin().value(),
-                                   params.smin().value(),
-                                   params.rmax().value(),
-                                   params.smax().value());
+        if constexpr (MaxRows == 0)
+            return row_bounds{r_coordinate<T>{0}, r_coordinate<T>{0}, s_coordinate<T>{0}, s_coordinate<T>{0}};
+        else
+            return nullptr;
     }
-    constexpr convex_polygon_iterator(convex_polygon_parameters<T> params, vector<T> v, std::size_t idx)
-        : m_params(params)
-        , m_v(v)
-        , m_idx(idx)
+
+    [[nodiscard]] constexpr auto bounds() const noexcept -> row_bounds
+    {
+        if constexpr (MaxRows == 0)
+            return m_view;
+        else
+        {
+            auto const& params = m_view->parameters();
+            return row_bounds{params.rmin(), params.rmax(), params.smin(), params.smax()};
+        }
+    }
+
+    // Returns the index of v, counted from the first row of the parallelogram spanned by the row bounds.
+    static constexpr auto bounds_index(row_bounds const& bounds, vector<T> const& v) noexcept -> std::size_t
     {
+        auto const rmin = static_cast<std::int64_t>(bounds.rmin.value());
+        auto const rmax = static_cast<std::int64_t>(bounds.rmax.value());
+        auto const smin = static_cast<std::int64_t>(bounds.smin.value());
+        auto const smax = static_cast<std::int64_t>(bounds.smax.value());
+        return qr_to_index(v.q().value(), v.r().value(), -rmax - smax, rmin, smin, rmax, smax);
+    }
+    // Returns the position at the given index as returned by bounds_index(). The index after the parallelogram's last
+    // tile maps to the first position of the row after it, like the past-the-end position of a polygon ending there.
+    static constexpr auto from_bounds_index(row_bounds const& bounds, std::size_t idx) noexcept -> vector<T>
+    {
+        auto const rmin = static_cast<std::int64_t>(bounds.rmin.value());
+        auto const rmax = static_cast<std::int64_t>(bounds.rmax.value());
+        auto const smin = static_cast<std::int64_t>(bounds.smin.value());
+        auto const smax = static_cast<std::int64_t>(bounds.smax.value());
+        auto const size = static_cast<std::size_t>(rmax - rmin + 1) * static_cast<std::size_t>(smax - smin + 1);
+        assert(idx <= size);
+        auto const [q, r] = idx == size ? std::array{-rmin - smin + 1, rmin}
+                                        : index_to_qr(idx, -rmax - smax, rmin, smin, rmax, smax);
+        return vector<T>{q_coordinate<T>{static_cast<T>(q)}, r_coordinate<T>{static_cast<T>(r)}};
     }
 
-    convex_polygon_parameters<T> m_params{q_coordinate<T>{0},
-                                          r_coordinate<T>{0},
-                                          s_coordinate<T>{0},
-                                          q_coordinate<T>{0},
-                                          r_coordinate<T>{0},
-                                          s_coordinate<T>{0}};
-    vector<T>                    m_v;
-    std::size_t                  m_idx = 0;
+    static constexpr auto from_index(view_type const& view, std::size_t idx) noexcept -> vector<T>
+    {
+        assert(idx <= view.size());
+        if (idx == view.size())
+            return past_the_end(view);
+        return view[idx];
+    }
+    static constexpr auto past_the_end(view_type const& view) noexcept -> vector<T>
+    {
+        auto const& params = view.parameters();
+        auto const  q      = static_cast<T>(params.qmax().value() + 1);
+        auto const  r      = std::max<T>(params.rmin().value(), static_cast<T>(-q - params.smax().value()));
+        return vector<T>{q_coordinate<T>{q}, r_coordinate<T>{r}};
+    }
 
-    friend class convex_polygon_view<T>;
+    view_reference m_view = detached();
+    vector<T>      m_v;
 };
 } // namespace detail
 } // namespace hex
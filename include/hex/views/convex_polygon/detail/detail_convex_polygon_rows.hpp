@@ -0,0 +1,72 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_DETAIL_CONVEX_POLYGON_ROWS_HPP
+#define HEX_DETAIL_CONVEX_POLYGON_ROWS_HPP
+
+#include "hex/vector/coordinate.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/detail/detail_hexagon_size.hpp"
+#include "hex/views/convex_polygon/detail/detail_row_start_table.hpp"
+#include "hex/views/rows/rows_view.hpp"
+
+#include <cstddef>
+
+namespace hex::detail
+{
+// Maps the row number of a convex polygon to the row_span of its q row. Every row runs along +r.
+template<typename T>
+struct convex_polygon_row
+{
+    convex_polygon_parameters<T> params{q_coordinate<T>{0}, // NOLINT(misc-non-private-member-variables-in-classes)
+                                        r_coordinate<T>{0},
+                                        s_coordinate<T>{0},
+                                        q_coordinate<T>{0},
+                                        r_coordinate<T>{0},
+                                        s_coordinate<T>{0}};
+
+    constexpr auto operator()(std::size_t row) const noexcept -> row_span<T>
+    {
+        auto const q      = static_cast<T>(params.qmin().value() + static_cast<T>(row));
+        auto const rmin   = row_rmin(q, params);
+        auto const rmax   = row_rmax(q, params);
+        auto const offset = qr_to_index(q,
+                                        rmin,
+                                        params.qmin().value(),
+                                        params.rmin().value(),
+                                        params.smin().value(),
+                                        params.rmax().value(),
+                                        params.smax().value());
+        return {vector(q_coordinate<T>{q}, r_coordinate<T>{rmin}),
+                vector(q_coordinate<T>{0}, r_coordinate<T>{1}),
+                offset,
+                static_cast<std::size_t>(rmax - rmin) + 1UZ};
+    }
+
+    constexpr auto operator==(convex_polygon_row const&) const -> bool = default;
+};
+} // namespace hex::detail
+
+#endif // HEX_DETAIL_CONVEX_POLYGON_ROWS_HPP
@@ -0,0 +1,161 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_DETAIL_ROW_START_TABLE_HPP
+#define HEX_DETAIL_ROW_START_TABLE_HPP
+
+#include "hex/vector/coordinate.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+
+#include <cassert>
+#include <cstddef>
+
+namespace hex::detail
+{
+// Stores the linear index of the first tile of every q row of a convex polygon, so that converting between positions
+// and indices is a lookup plus an add (and a binary search over the rows for the inverse). Polygons with more than
+// MaxRows rows are not tabulated, in which case tabulated() returns false and callers must use the closed-form
+// conversions from detail_hexagon_size.hpp instead. The specialization for MaxRows == 0 never tabulates.
+template<std::signed_integral T, std::size_t MaxRows>
+class row_start_table
+{
+  public:
+    constexpr row_start_table() = default;
+    constexpr explicit row_start_table(convex_polygon_parameters<T> const& params) noexcept;
+
+    // Returns true if the polygon used for construction fit into the table.
+    [[nodiscard]] constexpr auto tabulated() const noexcept -> bool;
+
+    // Returns the index of v, which must be inside the polygon described by params. Requires tabulated().
+    [[nodiscard]] constexpr auto index_of(vector<T> const&                    v,
+                                          convex_polygon_parameters<T> const& params) const noexcept -> std::size_t;
+    // Returns the position at index idx, which must be less than the polygon's size. Requires tabulated().
+    [[nodiscard]] constexpr auto position_of(std::size_t                         idx,
+                                             convex_polygon_parameters<T> const& params) const noexcept -> vector<T>;
+
+  private:
+    std::array<std::size_t, MaxRows + 1> m_starts{};
+    std::size_t                          m_rows = 0;
+};
+
+template<std::signed_integral T>
+class row_start_table<T, 0>
+{
+  public:
+    constexpr row_start_table() = default;
+    constexpr explicit row_start_table(convex_polygon_parameters<T> const& /*params*/) noexcept {}
+
+    [[nodiscard]] constexpr auto tabulated() const noexcept -> bool { return false; }
+
+    [[nodiscard]] constexpr auto index_of(vector<T> const& /*v*/,
+                                          convex_polygon_parameters<T> const& /*params*/) const noexcept -> std::size_t
+    {
+        return 0;
+    }
+    [[nodiscard]] constexpr auto position_of(std::size_t /*idx*/,
+                                             convex_polygon_parameters<T> const& /*params*/) const noexcept -> vector<T>
+    {
+        return {};
+    }
+};
+
+// Returns the smallest r of the given q row of a convex polygon.
+template<std::signed_integral T>
+constexpr auto row_rmin(T q, convex_polygon_parameters<T> const& params) noexcept -> T
+{
+    return std::max<T>(params.rmin().value(), -q - params.smax().value());
+}
+
+// Returns the largest r of the given q row of a convex polygon.
+template<std::signed_integral T>
+constexpr auto row_rmax(T q, convex_polygon_parameters<T> const& params) noexcept -> T
+{
+    return std::min<T>(params.rmax().value(), -q - params.smin().value());
+}
+
+// ------------------------------ implementation below ------------------------------
+
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr row_start_table<T, MaxRows>::row_start_table(convex_polygon_parameters<T> const& params) noexcept
+{
+    auto const rows = static_cast<std::size_t>(params.qmax().value() - params.qmin().value()) + 1UZ;
+    if (rows > MaxRows)
+        return;
+
+    m_rows         = rows;
+    std::size_t at = 0;
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        auto const q = static_cast<T>(params.qmin().value() + static_cast<T>(i));
+        m_starts[i]  = at;
+        at += static_cast<std::size_t>(row_rmax(q, params) - row_rmin(q, params)) + 1UZ;
+    }
+    m_starts[rows] = at;
+}
+
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr auto row_start_table<T, MaxRows>::tabulated() const noexcept -> bool
+{
+    return m_rows != 0;
+}
+
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr auto row_start_table<T, MaxRows>::index_of(vector<T> const&                    v,
+                                                     convex_polygon_parameters<T> const& params) const noexcept
+    -> std::size_t
+{
+    assert(tabulated());
+    auto const q   = v.q().value();
+    auto const row = static_cast<std::size_t>(q - params.qmin().value());
+    return m_starts[row] + static_cast<std::size_t>(v.r().value() - row_rmin(q, params));
+}
+
+template<std::signed_integral T, std::size_t MaxRows>
+constexpr auto row_start_table<T, MaxRows>::position_of(std::size_t                         idx,
+                                                        convex_polygon_parameters<T> const& params) const noexcept
+    -> vector<T>
+{
+    assert(tabulated());
+    assert(idx < m_starts[m_rows]);
+    // Find the last row starting at or before idx. Branch-free, since the comparison is unpredictable for random
+    // access patterns.
+    std::size_t row = 0;
+    for (std::size_t n = m_rows; n > 1UZ;)
+    {
+        std::size_t const half = n / 2UZ;
+        row += (m_starts[row + half] <= idx) ? half : 0UZ;
+        n -= half;
+    }
+    auto const q    = static_cast<T>(params.qmin().value() + static_cast<T>(row));
+    auto const r    = static_cast<T>(row_rmin(q, params) + static_cast<T>(idx - m_starts[row]));
+    return vector(q_coordinate<T>{q}, r_coordinate<T>{r});
+}
+} // namespace hex::detail
+
+#endif // HEX_DETAIL_ROW_START_TABLE_HPP
@@ -28,127 +28,95 @@
 #include "hex/vector/coordinate.hpp"
 #include "hex/vector/vector.hpp"
 
-#include <bitset>
+#include <array>
+#include <compare>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <limits>
 
 #include <cstddef>
+#include <cstdint>
 
 namespace hex::detail
 {
-constexpr void m1_move(int& /*q*/, // NOLINT(bugprone-easily-swappable-parameters)
-                       int& r,     // NOLINT(bugprone-easily-swappable-parameters)
-                       int& delta, // NOLINT(bugprone-easily-swappable-parameters)
-                       int  dq,    // NOLINT(bugprone-easily-swappable-parameters)
-                       int /*dr*/, // NOLINT(bugprone-easily-swappable-parameters)
-                       int dir)    // NOLINT(bugprone-easily-swappable-parameters)
+// Lines are rasterized per sextant: a line in sextant n alternates between two neighbor steps, taking the first while
+// its error term is positive and the second otherwise. The second step of sextant n is the first step of sextant n + 1.
+inline constexpr std::array<std::array<std::int8_t, 2>, 6> line_sextant_steps{
+    {{0, 1}, {1, 0}, {1, -1}, {0, -1}, {-1, 0}, {-1, 1}}};
+
+// Returns the sextant in which the line from the origin to (dq, dr) runs.
+template<std::signed_integral T>
+[[nodiscard]] constexpr auto line_sextant(T dq, T dr) noexcept -> int
 {
-    r += dir;
-    delta -= 2 * dq * dir;
-};
-constexpr void m2_move(int& q,     // NOLINT(bugprone-easily-swappable-parameters)
-                       int& /*r*/, // NOLINT(bugprone-easily-swappable-parameters)
-                       int& delta, // NOLINT(bugprone-easily-swappable-parameters)
-                       int /*dq*/, // NOLINT(bugprone-easily-swappable-parameters)
-                       int dr,     // NOLINT(bugprone-easily-swappable-parameters)
-                       int dir)    // NOLINT(bugprone-easily-swappable-parameters)
+    if (dq >= 0)
+    {
+        if (dr > 0)
+            return 0;
+        return dq > -dr ? 1 : 2;
+    }
+    if (dr < 0)
+        return 3;
+    return -dq > dr ? 4 : 5;
+}
+
+// One rasterization step: the position change and the change of the error term. The error term grows to about four
+// times the extent of the line, so it is kept in std::ptrdiff_t rather than in T.
+template<std::signed_integral T>
+struct line_step
 {
-    q += dir;
-    delta += 2 * dr * dir;
+    T              q;     // NOLINT(misc-non-private-member-variables-in-classes)
+    T              r;     // NOLINT(misc-non-private-member-variables-in-classes)
+    std::ptrdiff_t delta; // NOLINT(misc-non-private-member-variables-in-classes)
+
+    constexpr auto operator==(line_step const&) const -> bool = default;
 };
-constexpr void m3_move(int& q,     // NOLINT(bugprone-easily-swappable-parameters)
-                       int& r,     // NOLINT(bugprone-easily-swappable-parameters)
-                       int& delta, // NOLINT(bugprone-easily-swappable-parameters)
-                       int  dq,    // NOLINT(bugprone-easily-swappable-parameters)
-                       int  dr,    // NOLINT(bugprone-easily-swappable-parameters)
-                       int  dir)    // NOLINT(bugprone-easily-swappable-parameters)
+
+// Returns the step in direction (q, r) along a line with extent (dq, dr). The error term changes by twice the cross
+// product of step and extent.
+template<std::signed_integral T>
+[[nodiscard]] constexpr auto make_line_step(int q, int r, std::ptrdiff_t dq, std::ptrdiff_t dr) noexcept -> line_step<T>
 {
-    q += dir;
-    r -= dir;
-    delta += 2 * (dq + dr) * dir;
+    return {static_cast<T>(q), static_cast<T>(r), 2 * ((q * dr) - (r * dq))};
 }
 
-template<typename T>
+// Walks the hex positions on a line. The sextant is resolved once on construction into two steps, so every increment is
+// a single selection between them. The error term stays within (first.delta, second.delta], which determines how many
+// first steps precede any index, so random jumps are O(1) as well. Jumps multiply an index with the error term, so they
+// are exact for lines shorter than 2^30 positions.
+template<std::signed_integral T>
 class line_iterator
 {
   public:
-    using difference_type = std::ptrdiff_t;
-    using value_type      = vector<T> const;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = vector<T> const;
+    using iterator_concept  = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
 
     constexpr line_iterator() noexcept = default;
-    constexpr line_iterator(vector<T> const& p1, vector<T> const& p2) noexcept
-        : m_dq(p2.q().value() - p1.q().value())
-        , m_dr(p2.r().value() - p1.r().value())
-        , m_q(p1.q().value())
+    constexpr line_iterator(vector<T> const& p1, vector<T> const& p2, difference_type index = 0) noexcept
+        : m_q(p1.q().value())
         , m_r(p1.r().value())
     {
-        if (m_dq >= 0)
-        {
-            if (m_dr > 0)
-            {
-                m_delta                    = m_dr - m_dq;
-                m_flags[s_update1_dir_bit] = false;
-                m_flags[s_update2_dir_bit] = false;
-                m_update1                  = &m1_move;
-                m_update2                  = &m2_move;
-                m_remaining                = m_dq + m_dr;
-            }
-            else if (m_dq > -m_dr)
-            {
-                m_delta                    = 2 * m_dr + m_dq;
-                m_flags[s_update1_dir_bit] = false;
-                m_flags[s_update2_dir_bit] = false;
-                m_update1                  = &m2_move;
-                m_update2                  = &m3_move;
-                m_remaining                = m_dq;
-            }
-            else
-            {
-                m_delta                    = m_dr + 2 * m_dq;
-                m_flags[s_update1_dir_bit] = false;
-                m_flags[s_update2_dir_bit] = true;
-                m_update1                  = &m3_move;
-                m_update2                  = &m1_move;
-                m_remaining                = -m_dr;
-            }
-        }
-        else
-        {
-            if (m_dr < 0)
-            {
-                m_delta                    = m_dq - m_dr;
-                m_flags[s_update1_dir_bit] = true;
-                m_flags[s_update2_dir_bit] = true;
-                m_update1                  = &m1_move;
-                m_update2                  = &m2_move;
-                m_remaining                = -m_dq - m_dr;
-            }
-            else if (-m_dq > m_dr)
-            {
-                m_delta                    = -2 * m_dr - m_dq;
-                m_flags[s_update1_dir_bit] = true;
-                m_flags[s_update2_dir_bit] = true;
-                m_update1                  = &m2_move;
-                m_update2                  = &m3_move;
-                m_remaining                = -m_dq;
-            }
-            else
-            {
-                m_delta                    = -2 * m_dq - m_dr;
-                m_flags[s_update1_dir_bit] = true;
-                m_flags[s_update2_dir_bit] = false;
-                m_update1                  = &m3_move;
-                m_update2                  = &m1_move;
-                m_remaining                = -m_dr;
-            }
-        }
+        auto const dq      = static_cast<std::ptrdiff_t>(p2.q().value()) - p1.q().value();
+        auto const dr      = static_cast<std::ptrdiff_t>(p2.r().value()) - p1.r().value();
+        auto const sextant = line_sextant(dq, dr);
+        auto const first   = line_sextant_steps[sextant];
+        auto const second  = line_sextant_steps[(sextant + 1) % 6];
+        m_first            = make_line_step<T>(first[0], first[1], dq, dr);
+        m_second           = make_line_step<T>(second[0], second[1], dq, dr);
+        m_delta            = initial_delta();
+        if (index != 0)
+            *this += index;
     }
 
     constexpr auto operator++() noexcept -> line_iterator&
     {
-        --m_remaining;
-        if (m_delta > 0)
-            m_update1(m_q, m_r, m_delta, m_dq, m_dr, m_flags[s_update1_dir_bit] ? -1 : 1);
-        else
-            m_update2(m_q, m_r, m_delta, m_dq, m_dr, m_flags[s_update2_dir_bit] ? -1 : 1);
+        ++m_index;
+        auto const& step = m_delta > 0 ? m_first : m_second;
+        m_q += step.q;
+        m_r += step.r;
+        m_delta += step.delta;
         return *this;
     }
     constexpr auto operator++(int) noexcept -> line_iterator
@@ -157,28 +125,191 @@ class line_iterator
         ++(*this);
         return copy;
     }
+    friend constexpr auto operator+(line_iterator const& iter, difference_type n) noexcept -> line_iterator
+    {
+        auto cp = iter;
+        cp += n;
+        return cp;
+    }
+    friend constexpr auto operator+(difference_type n, line_iterator const& iter) noexcept -> line_iterator
+    {
+        return iter + n;
+    }
+    constexpr auto operator+=(difference_type n) noexcept -> line_iterator&
+    {
+        auto const firsts = first_steps_before(m_index + n) - first_steps_before(m_index);
+        m_index += n;
+        m_q += static_cast<T>(firsts * m_first.q + (n - firsts) * m_second.q);
+        m_r += static_cast<T>(firsts * m_first.r + (n - firsts) * m_second.r);
+        m_delta += (firsts * m_first.delta) + ((n - firsts) * m_second.delta);
+        return *this;
+    }
+
+    constexpr auto operator--() noexcept -> line_iterator&
+    {
+        --m_index;
+        // A first step leaves the error term at most first.delta + second.delta, a second step above that. Lines of a
+        // single position only ever take second steps.
+        bool const  first = m_first.delta != m_second.delta && m_delta <= m_first.delta + m_second.delta;
+        auto const& step  = first ? m_first : m_second;
+        m_q -= step.q;
+        m_r -= step.r;
+        m_delta -= step.delta;
+        return *this;
+    }
+    constexpr auto operator--(int) noexcept -> line_iterator
+    {
+        auto copy = *this;
+        --(*this);
+        return copy;
+    }
+    friend constexpr auto operator-(line_iterator const& iter, difference_type n) noexcept -> line_iterator
+    {
+        auto cp = iter;
+        cp -= n;
+        return cp;
+    }
+    friend constexpr auto operator-(line_iterator const& lhs, line_iterator const& rhs) noexcept -> difference_type
+    {
+        return lhs.m_index - rhs.m_index;
+    }
+    constexpr auto operator-=(difference_type n) noexcept -> line_iterator& { return *this += -n; }
 
     [[nodiscard]] constexpr auto operator*() const noexcept -> vector<T> const // NOLINT(readability-const-return-type)
     {
         return {q_coordinate<T>{m_q}, r_coordinate<T>{m_r}};
     }
 
-    constexpr auto operator==(line_iterator const& other) const -> bool { return m_remaining == other.m_remaining; };
+    // NOLINTNEXTLINE(readability-const-return-type)
+    [[nodiscard]] constexpr auto operator[](difference_type n) const noexcept -> vector<T> const
+    {
+        return *(*this + n);
+    }
+
+    constexpr auto operator==(line_iterator const& other) const -> bool { return m_index == other.m_index; };
+    constexpr auto operator<=>(line_iterator const& other) const -> std::strong_ordering
+    {
+        return m_index <=> other.m_index;
+    };
 
   private:
-    std::size_t m_remaining = -1;
-    T           m_dq;
-    T           m_dr;
-    T           m_q;
-    T           m_r;
-    T           m_delta;
-    void (*m_update1)(T&, T&, T&, T, T, int);
-    void (*m_update2)(T&, T&, T&, T, T, int);
-    std::bitset<2> m_flags;
-
-    static constexpr int s_update1_dir_bit = 0;
-    static constexpr int s_update2_dir_bit = 1;
+    [[nodiscard]] constexpr auto initial_delta() const noexcept -> difference_type
+    {
+        return (m_first.delta + m_second.delta) / 2;
+    }
+    // Returns the number of first steps among the first index steps of the line.
+    [[nodiscard]] constexpr auto first_steps_before(difference_type index) const noexcept -> difference_type
+    {
+        auto const span = m_second.delta - m_first.delta;
+        if (span == 0)
+            return 0;
+        return (span / 2 + index * m_second.delta - 1) / span;
+    }
+
+    difference_type m_index  = 0;
+    T               m_q      = 0;
+    T               m_r      = 0;
+    difference_type m_delta  = 0;
+    line_step<T>    m_first  = {};
+    line_step<T>    m_second = {};
+};
+
+// Like line_iterator, for a line known to run in the given sextant. The position steps are compile-time constants, so
+// only the error term changes need to be kept.
+template<std::signed_integral T, int Sextant>
+class sextant_line_iterator
+{
+    static_assert(Sextant >= 0 && Sextant < 6);
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using value_type      = vector<T> const;
+
+    constexpr sextant_line_iterator() noexcept = default;
+    constexpr sextant_line_iterator(vector<T> const& p1, vector<T> const& p2) noexcept
+        : m_remaining(distance(p1, p2))
+        , m_q(p1.q().value())
+        , m_r(p1.r().value())
+    {
+        auto const dq  = static_cast<std::ptrdiff_t>(p2.q().value()) - p1.q().value();
+        auto const dr  = static_cast<std::ptrdiff_t>(p2.r().value()) - p1.r().value();
+        m_first_delta  = make_line_step<T>(s_first[0], s_first[1], dq, dr).delta;
+        m_second_delta = make_line_step<T>(s_second[0], s_second[1], dq, dr).delta;
+        m_delta        = (m_first_delta + m_second_delta) / 2;
+    }
+
+    constexpr auto operator++() noexcept -> sextant_line_iterator&
+    {
+        --m_remaining;
+        bool const first = m_delta > 0;
+        m_q += first ? s_first[0] : s_second[0];
+        m_r += first ? s_first[1] : s_second[1];
+        m_delta += first ? m_first_delta : m_second_delta;
+        return *this;
+    }
+    constexpr auto operator++(int) noexcept -> sextant_line_iterator
+    {
+        auto copy = *this;
+        ++(*this);
+        return copy;
+    }
+
+    // NOLINTNEXTLINE(readability-const-return-type)
+    [[nodiscard]] constexpr auto operator*() const noexcept -> vector<T> const
+    {
+        return {q_coordinate<T>{m_q}, r_coordinate<T>{m_r}};
+    }
+
+    constexpr auto operator==(sextant_line_iterator const& other) const -> bool
+    {
+        return m_remaining == other.m_remaining;
+    };
+
+  private:
+    static constexpr auto s_first  = line_sextant_steps[Sextant];
+    static constexpr auto s_second = line_sextant_steps[(Sextant + 1) % 6];
+
+    std::size_t    m_remaining    = std::numeric_limits<std::size_t>::max();
+    T              m_q            = 0;
+    T              m_r            = 0;
+    std::ptrdiff_t m_delta        = 0;
+    std::ptrdiff_t m_first_delta  = 0;
+    std::ptrdiff_t m_second_delta = 0;
 };
+
+// Invokes fn with every position on the line from p1 to p2, in order. The sextant is dispatched once, and the loop runs
+// on sextant_line_iterator.
+template<std::signed_integral T, typename Fn>
+constexpr void for_each_line_position(vector<T> const& p1, vector<T> const& p2, Fn&& fn)
+{
+    auto const walk = [&]<int Sextant>()
+    {
+        auto iter = sextant_line_iterator<T, Sextant>(p1, p2);
+        for (auto const end = sextant_line_iterator<T, Sextant>(); iter != end; ++iter)
+            std::invoke(fn, *iter);
+    };
+    switch (line_sextant(p2.q().value() - p1.q().value(), p2.r().value() - p1.r().value()))
+    {
+    case 0:
+        walk.template operator()<0>();
+        break;
+    case 1:
+        walk.template operator()<1>();
+        break;
+    case 2:
+        walk.template operator()<2>();
+        break;
+    case 3:
+        walk.template operator()<3>();
+        break;
+    case 4:
+        walk.template operator()<4>();
+        break;
+    default:
+        walk.template operator()<5>();
+        break;
+    }
+}
 } // namespace hex::detail
 
 #endif // HEX_DETAIL_LINE_ITERATOR_HPP
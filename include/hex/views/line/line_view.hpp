@@ -35,8 +35,9 @@
 
 namespace hex
 {
-// A view that models std::ranges::sized_range, std::ranges::common_range, std::ranges::forward_range,
+// A view that models std::ranges::sized_range, std::ranges::common_range, std::ranges::random_access_range,
 // std::ranges::borrowed_range and std::constant_range, producing all hex positions on a line between to positions.
+// Random access computes the k-th position directly, without walking the line.
 template<std::signed_integral T>
 class line_view : public std::ranges::view_interface<line_view<T>>
 {
@@ -58,7 +59,7 @@ class line_view : public std::ranges::view_interface<line_view<T>>
 
 namespace views
 {
-// A range factory returning a view containing the hex positions on a line between two positions.
+// A range factory returning a random-access view containing the hex positions on a line between two positions.
 template<std::signed_integral T = int>
 [[nodiscard]] constexpr auto line(vector<T> const& from, vector<T> const& to) -> line_view<T>;
 } // namespace views
@@ -80,7 +81,7 @@ constexpr auto hex::line_view<T>::begin() const noexcept -> hex::detail::line_it
 template<std::signed_integral T>
 constexpr auto hex::line_view<T>::end() const noexcept -> hex::detail::line_iterator<T>
 {
-    return hex::detail::line_iterator<T>();
+    return hex::detail::line_iterator<T>(m_from, m_to, static_cast<std::ptrdiff_t>(size()));
 }
 template<std::signed_integral T>
 constexpr auto hex::line_view<T>::size() const noexcept -> std::size_t
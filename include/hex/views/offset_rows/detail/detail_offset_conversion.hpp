@@ -29,6 +29,7 @@
 #include "hex/vector/coordinate_axis.hpp"
 #include "hex/vector/vector.hpp"
 #include "hex/views/offset_rows/offset_parity.hpp"
+#include "hex/views/rows/rows_view.hpp"
 
 #include <array>
 #include <utility>
@@ -121,6 +122,29 @@ constexpr auto to_even_s(vector<T> v) noexcept -> std::array<T, 2>
     auto const x = v.q().value() + (y + (y & 1)) / 2;
     return {x, y};
 }
+// Converts offset coordinates to cubic coordinates for an axis and parity known at compile time.
+template<coordinate_axis Axis, offset_parity Parity, typename T>
+constexpr auto from_offset(T x, T y) noexcept -> vector<T>
+{
+    if constexpr (Axis == coordinate_axis::q)
+        return Parity == offset_parity::odd ? from_odd_q(x, y) : from_even_q(x, y);
+    else if constexpr (Axis == coordinate_axis::r)
+        return Parity == offset_parity::odd ? from_odd_r(x, y) : from_even_r(x, y);
+    else
+        return Parity == offset_parity::odd ? from_odd_s(x, y) : from_even_s(x, y);
+}
+// Converts cubic coordinates to offset coordinates for an axis and parity known at compile time.
+template<coordinate_axis Axis, offset_parity Parity, typename T>
+constexpr auto to_offset(vector<T> v) noexcept -> std::array<T, 2>
+{
+    if constexpr (Axis == coordinate_axis::q)
+        return Parity == offset_parity::odd ? to_odd_q(v) : to_even_q(v);
+    else if constexpr (Axis == coordinate_axis::r)
+        return Parity == offset_parity::odd ? to_odd_r(v) : to_even_r(v);
+    else
+        return Parity == offset_parity::odd ? to_odd_s(v) : to_even_s(v);
+}
+
 template<typename T>
 constexpr auto select_offset_to_cubic_function(coordinate_axis axis, offset_parity parity) -> vector<T> (*)(T, T)
 {
@@ -159,6 +183,41 @@ struct apply_offset_conversion
 
     constexpr auto operator==(apply_offset_conversion const&) const -> bool = default;
 };
+
+// Maps the row number y of an offset_rows_view to the row_span of its width tiles.
+template<typename T>
+struct apply_offset_row_conversion
+{
+    vector<T>   corner;         // NOLINT(misc-non-private-member-variables-in-classes)
+    std::size_t width;          // NOLINT(misc-non-private-member-variables-in-classes)
+    vector<T> (*convert)(T, T); // NOLINT(misc-non-private-member-variables-in-classes)
+
+    constexpr auto operator()(std::size_t row) const -> row_span<T>
+    {
+        T const    y     = static_cast<T>(row);
+        auto const first = convert(0, y);
+        return {first + corner, convert(1, y) - first, row * width, width};
+    }
+
+    constexpr auto operator==(apply_offset_row_conversion const&) const -> bool = default;
+};
+
+// Like apply_offset_row_conversion, for an axis and parity known at compile time.
+template<typename T, coordinate_axis Axis, offset_parity Parity>
+struct apply_static_offset_row_conversion
+{
+    vector<T>   corner; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::size_t width;  // NOLINT(misc-non-private-member-variables-in-classes)
+
+    constexpr auto operator()(std::size_t row) const -> row_span<T>
+    {
+        T const    y     = static_cast<T>(row);
+        auto const first = from_offset<Axis, Parity>(T{0}, y);
+        return {first + corner, from_offset<Axis, Parity>(T{1}, y) - first, row * width, width};
+    }
+
+    constexpr auto operator==(apply_static_offset_row_conversion const&) const -> bool = default;
+};
 } // namespace hex::detail
 
 #endif // HEX_DETAIL_OFFSET_CONVERSION_HPP
@@ -0,0 +1,163 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_DETAIL_OFFSET_ROWS_ITERATOR_HPP
+#define HEX_DETAIL_OFFSET_ROWS_ITERATOR_HPP
+
+#include "hex/vector/coordinate_axis.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/offset_rows/detail/detail_offset_conversion.hpp"
+#include "hex/views/offset_rows/offset_parity.hpp"
+
+#include <compare>
+#include <iterator>
+
+#include <cstddef>
+
+namespace hex::detail
+{
+// Iterates offset rows for an axis and parity known at compile time. Keeps the offset coordinates of the current
+// element and steps them directly, so neither increments nor dereferences need to divide; only random jumps do.
+template<typename T, coordinate_axis Axis, offset_parity Parity>
+class offset_rows_iterator
+{
+  public:
+    using value_type        = vector<T> const;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_concept  = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+
+    constexpr offset_rows_iterator() = default;
+    constexpr offset_rows_iterator(vector<T> corner, std::size_t height, std::size_t idx) noexcept
+        : m_corner(corner)
+        , m_height(static_cast<T>(height))
+    {
+        seek(static_cast<difference_type>(idx));
+    }
+
+    constexpr auto operator++() noexcept -> offset_rows_iterator&
+    {
+        if (++m_x == m_height)
+        {
+            m_x = 0;
+            ++m_y;
+        }
+        return *this;
+    }
+    constexpr auto operator++(int) noexcept -> offset_rows_iterator
+    {
+        auto cp = *this;
+        ++(*this);
+        return cp;
+    }
+    friend constexpr auto operator+(offset_rows_iterator const& iter, difference_type n) noexcept
+        -> offset_rows_iterator
+    {
+        auto cp = iter;
+        cp += n;
+        return cp;
+    }
+    friend constexpr auto operator+(difference_type n, offset_rows_iterator const& iter) noexcept
+        -> offset_rows_iterator
+    {
+        return iter + n;
+    }
+    constexpr auto operator+=(difference_type n) noexcept -> offset_rows_iterator&
+    {
+        seek(index() + n);
+        return *this;
+    }
+
+    constexpr auto operator--() noexcept -> offset_rows_iterator&
+    {
+        if (m_x-- == 0)
+        {
+            m_x = m_height - 1;
+            --m_y;
+        }
+        return *this;
+    }
+    constexpr auto operator--(int) noexcept -> offset_rows_iterator
+    {
+        auto cp = *this;
+        --(*this);
+        return cp;
+    }
+    friend constexpr auto operator-(offset_rows_iterator const& iter, difference_type n) noexcept
+        -> offset_rows_iterator
+    {
+        auto cp = iter;
+        cp -= n;
+        return cp;
+    }
+    friend constexpr auto operator-(offset_rows_iterator const& lhs, offset_rows_iterator const& rhs) noexcept
+        -> difference_type
+    {
+        return lhs.index() - rhs.index();
+    }
+    constexpr auto operator-=(difference_type n) noexcept -> offset_rows_iterator&
+    {
+        return *this += -n;
+    }
+
+    // NOLINTNEXTLINE(readability-const-return-type)
+    constexpr auto operator*() const noexcept -> value_type { return from_offset<Axis, Parity>(m_x, m_y) + m_corner; }
+
+    // NOLINTNEXTLINE(readability-const-return-type)
+    constexpr auto operator[](difference_type n) const noexcept -> value_type { return *(*this + n); }
+
+    friend constexpr auto operator==(offset_rows_iterator const& lhs, offset_rows_iterator const& rhs) noexcept
+        -> bool
+    {
+        return lhs.m_x == rhs.m_x && lhs.m_y == rhs.m_y;
+    }
+    friend constexpr auto operator<=>(offset_rows_iterator const& lhs, offset_rows_iterator const& rhs) noexcept
+        -> std::strong_ordering
+    {
+        if (auto const cmp = lhs.m_y <=> rhs.m_y; cmp != 0)
+            return cmp;
+        return lhs.m_x <=> rhs.m_x;
+    }
+
+  private:
+    [[nodiscard]] constexpr auto index() const noexcept -> difference_type
+    {
+        return static_cast<difference_type>(m_y) * m_height + m_x;
+    }
+    constexpr void seek(difference_type idx) noexcept
+    {
+        if (m_height == 0)
+            return;
+        m_x = static_cast<T>(idx % m_height);
+        m_y = static_cast<T>(idx / m_height);
+    }
+
+    vector<T> m_corner = {};
+    T         m_height = 0;
+    T         m_x      = 0; // position within the row
+    T         m_y      = 0; // row
+};
+} // namespace hex::detail
+
+#endif // HEX_DETAIL_OFFSET_ROWS_ITERATOR_HPP
@@ -27,12 +27,18 @@
 
 #include "hex/detail/detail_generating_random_access_iterator.hpp"
 #include "hex/vector/vector.hpp"
+#include "hex/vector/coordinate_axis.hpp"
 #include "hex/views/offset_rows/detail/detail_offset_conversion.hpp"
+#include "hex/views/offset_rows/detail/detail_offset_rows_iterator.hpp"
+#include "hex/views/offset_rows/offset_parity.hpp"
 #include "hex/views/offset_rows/offset_rows_parameters.hpp"
+#include "hex/views/rows/rows_view.hpp"
 
 #include <array>
 #include <concepts>
 #include <ranges>
+#include <stdexcept>
+#include <utility>
 
 #include <cstddef>
 
@@ -40,8 +46,13 @@ namespace hex
 {
 // A view that models std::ranges::sized_range, std::ranges::common_range, std::ranges::random_access_range,
 // std::ranges::borrowed_range and std::constant_range, producing all hex positions in a semi-rectangular pattern.
+// offset_rows_view<T> takes axis and parity from its parameters at runtime, while offset_rows_view<T, Axis, Parity>
+// fixes them at compile time, so that the offset conversion inlines and iteration steps through the rows directly.
+template<std::signed_integral T, auto... Layout>
+class offset_rows_view;
+
 template<std::signed_integral T>
-class offset_rows_view : public std::ranges::view_interface<offset_rows_view<T>>
+class offset_rows_view<T> : public std::ranges::view_interface<offset_rows_view<T>>
 {
   public:
     using iterator = detail::generating_random_access_iterator<detail::apply_offset_conversion<T>>;
@@ -61,6 +72,10 @@ class offset_rows_view : public std::ranges::view_interface<offset_rows_view<T>>
     // Reverse random access operator: Returns the index of v. UB if v is not in the view.
     [[nodiscard]] constexpr auto operator[](vector<T> const& v) const noexcept -> std::size_t;
 
+    // Returns a random-access view of the parameters().width() rows of the view, each made up of parameters().height()
+    // tiles that are contiguous in iteration order. All rows run in the same direction, which depends on the axis.
+    [[nodiscard]] constexpr auto rows() const noexcept -> rows_view<detail::apply_offset_row_conversion<T>>;
+
     // Provides access to the parameters passed on construction.
     [[nodiscard]] constexpr auto parameters() const -> offset_rows_parameters<T> const&;
 
@@ -72,12 +87,61 @@ class offset_rows_view : public std::ranges::view_interface<offset_rows_view<T>>
     std::array<T, 2> (*m_to_offset)(vector<T>);
 };
 
+template<std::signed_integral T, coordinate_axis Axis, offset_parity Parity>
+class offset_rows_view<T, Axis, Parity> : public std::ranges::view_interface<offset_rows_view<T, Axis, Parity>>
+{
+  public:
+    using iterator = detail::offset_rows_iterator<T, Axis, Parity>;
+
+    // Constructs the view with the given parameters. Throws std::invalid_argument if their axis or parity differ from
+    // Axis and Parity.
+    constexpr explicit offset_rows_view(offset_rows_parameters<T> const& parameters);
+
+    // Constructs the view of width rows with height tiles each, starting at corner.
+    constexpr offset_rows_view(std::size_t width, std::size_t height, vector<T> corner = {});
+
+    [[nodiscard]] constexpr auto begin() const noexcept -> iterator;
+    [[nodiscard]] constexpr auto end() const noexcept -> iterator;
+
+    // Returns true if the given element is in the range, otherwise false. O(1).
+    [[nodiscard]] constexpr auto contains(vector<T> const& v) const noexcept -> bool;
+
+    // Returns the past-the-end iterator if v is not in the view, otherwise the iterator to v.
+    [[nodiscard]] constexpr auto find(vector<T> const& v) const noexcept -> iterator;
+
+    // Reverse random access operator: Returns the index of v. UB if v is not in the view.
+    [[nodiscard]] constexpr auto operator[](vector<T> const& v) const noexcept -> std::size_t;
+
+    // Returns a random-access view of the parameters().width() rows of the view, see offset_rows_view<T>::rows().
+    [[nodiscard]] constexpr auto rows() const noexcept
+        -> rows_view<detail::apply_static_offset_row_conversion<T, Axis, Parity>>;
+
+    // Provides access to the parameters passed on construction.
+    [[nodiscard]] constexpr auto parameters() const -> offset_rows_parameters<T> const&;
+
+    [[nodiscard]] constexpr auto operator==(offset_rows_view const& other) const -> bool = default;
+
+    // Returns the equivalent runtime-configured view.
+    [[nodiscard]] constexpr explicit operator offset_rows_view<T>() const;
+
+  private:
+    offset_rows_parameters<T> m_params;
+};
+
+template<std::signed_integral T>
+offset_rows_view(offset_rows_parameters<T> const&) -> offset_rows_view<T>;
+
 namespace views
 {
 // A range factory returning a random-access view containing all coordinates within a semi-rectangular region.
 // The first produced element is always equal to the specified corner.
 template<std::signed_integral T = int>
 [[nodiscard]] constexpr auto offset_rows(offset_rows_parameters<T> const& parameters) -> offset_rows_view<T>;
+
+// As above, with axis and parity fixed at compile time.
+template<coordinate_axis Axis, offset_parity Parity, std::signed_integral T = int>
+[[nodiscard]] constexpr auto offset_rows(std::size_t width, std::size_t height, vector<T> corner = {})
+    -> offset_rows_view<T, Axis, Parity>;
 } // namespace views
 } // namespace hex
 
@@ -129,6 +193,16 @@ constexpr auto hex::offset_rows_view<T>::operator[](hex::vector<T> const& v) con
     return x + this->m_params.height() * y;
 }
 template<std::signed_integral T>
+constexpr auto hex::offset_rows_view<T>::rows() const noexcept
+    -> hex::rows_view<hex::detail::apply_offset_row_conversion<T>>
+{
+    using row_iterator = hex::detail::generating_random_access_iterator<hex::detail::apply_offset_row_conversion<T>>;
+    auto const row     = hex::detail::apply_offset_row_conversion<T>(m_params.corner(),
+                                                                     m_params.height(),
+                                                                     m_from_offset);
+    return {row_iterator(row, 0UZ), row_iterator(row, m_params.width())};
+}
+template<std::signed_integral T>
 constexpr auto hex::offset_rows_view<T>::parameters() const -> hex::offset_rows_parameters<T> const&
 {
     return m_params;
@@ -139,13 +213,87 @@ constexpr auto hex::offset_rows_view<T>::operator==(hex::offset_rows_view<T> con
     return m_params == other.m_params && m_from_offset == other.m_from_offset && m_to_offset == other.m_to_offset;
 }
 
+template<std::signed_integral T, hex::coordinate_axis Axis, hex::offset_parity Parity>
+constexpr hex::offset_rows_view<T, Axis, Parity>::offset_rows_view(offset_rows_parameters<T> const& parameters)
+    : m_params(parameters)
+{
+    if (parameters.axis() != Axis || parameters.parity() != Parity)
+        throw std::invalid_argument("Axis or parity of offset rows parameters do not match the view");
+}
+template<std::signed_integral T, hex::coordinate_axis Axis, hex::offset_parity Parity>
+constexpr hex::offset_rows_view<T, Axis, Parity>::offset_rows_view(std::size_t    width,
+                                                                    std::size_t    height,
+                                                                    hex::vector<T> corner)
+    : m_params(width, height, Axis, Parity, corner)
+{
+}
+template<std::signed_integral T, hex::coordinate_axis Axis, hex::offset_parity Parity>
+constexpr auto hex::offset_rows_view<T, Axis, Parity>::begin() const noexcept
+    -> hex::offset_rows_view<T, Axis, Parity>::iterator
+{
+    return iterator(m_params.corner(), m_params.height(), 0UZ);
+}
+template<std::signed_integral T, hex::coordinate_axis Axis, hex::offset_parity Parity>
+constexpr auto hex::offset_rows_view<T, Axis, Parity>::end() const noexcept
+    -> hex::offset_rows_view<T, Axis, Parity>::iterator
+{
+    return iterator(m_params.corner(), m_params.height(), m_params.width() * m_params.height());
+}
+template<std::signed_integral T, hex::coordinate_axis Axis, hex::offset_parity Parity>
+constexpr auto hex::offset_rows_view<T, Axis, Parity>::contains(hex::vector<T> const& v) const noexcept -> bool
+{
+    auto [x, y] = hex::detail::to_offset<Axis, Parity>(v - m_params.corner());
+    return std::cmp_greater_equal(x, 0) && std::cmp_greater_equal(y, 0) && std::cmp_less(x, m_params.height())
+           && std::cmp_less(y, m_params.width());
+}
+template<std::signed_integral T, hex::coordinate_axis Axis, hex::offset_parity Parity>
+constexpr auto hex::offset_rows_view<T, Axis, Parity>::find(hex::vector<T> const& v) const noexcept
+    -> hex::offset_rows_view<T, Axis, Parity>::iterator
+{
+    if (!contains(v))
+        return end();
+    return iterator(m_params.corner(), m_params.height(), (*this)[v]);
+}
+template<std::signed_integral T, hex::coordinate_axis Axis, hex::offset_parity Parity>
+constexpr auto hex::offset_rows_view<T, Axis, Parity>::operator[](hex::vector<T> const& v) const noexcept -> std::size_t
+{
+    auto const [x, y] = hex::detail::to_offset<Axis, Parity>(v - m_params.corner());
+    return x + m_params.height() * y;
+}
+template<std::signed_integral T, hex::coordinate_axis Axis, hex::offset_parity Parity>
+constexpr auto hex::offset_rows_view<T, Axis, Parity>::rows() const noexcept
+    -> hex::rows_view<hex::detail::apply_static_offset_row_conversion<T, Axis, Parity>>
+{
+    using row_conversion = hex::detail::apply_static_offset_row_conversion<T, Axis, Parity>;
+    using row_iterator   = hex::detail::generating_random_access_iterator<row_conversion>;
+    auto const row       = row_conversion(m_params.corner(), m_params.height());
+    return {row_iterator(row, 0UZ), row_iterator(row, m_params.width())};
+}
+template<std::signed_integral T, hex::coordinate_axis Axis, hex::offset_parity Parity>
+constexpr auto hex::offset_rows_view<T, Axis, Parity>::parameters() const -> hex::offset_rows_parameters<T> const&
+{
+    return m_params;
+}
+template<std::signed_integral T, hex::coordinate_axis Axis, hex::offset_parity Parity>
+constexpr hex::offset_rows_view<T, Axis, Parity>::operator hex::offset_rows_view<T>() const
+{
+    return hex::offset_rows_view<T>(m_params);
+}
+
 template<std::signed_integral T>
 constexpr auto hex::views::offset_rows(hex::offset_rows_parameters<T> const& parameters) -> hex::offset_rows_view<T>
 {
     return offset_rows_view<T>(parameters);
 }
 
-template<std::signed_integral T>
-inline constexpr bool std::ranges::enable_borrowed_range<hex::offset_rows_view<T>> = true;
+template<hex::coordinate_axis Axis, hex::offset_parity Parity, std::signed_integral T>
+constexpr auto hex::views::offset_rows(std::size_t width, std::size_t height, hex::vector<T> corner)
+    -> hex::offset_rows_view<T, Axis, Parity>
+{
+    return offset_rows_view<T, Axis, Parity>(width, height, corner);
+}
+
+template<std::signed_integral T, auto... Layout>
+inline constexpr bool std::ranges::enable_borrowed_range<hex::offset_rows_view<T, Layout...>> = true;
 
 #endif // HEX_OFFSET_ROWS_VIEW_HPP
@@ -0,0 +1,68 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_ROWS_VIEW_HPP
+#define HEX_ROWS_VIEW_HPP
+
+#include "hex/detail/detail_generating_random_access_iterator.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <concepts>
+#include <ranges>
+
+#include <cstddef>
+
+namespace hex
+{
+// A contiguous run of positions of a shape: the size positions first, first + step, first + 2 * step, ... are stored
+// at the consecutive indices offset, offset + 1, offset + 2, ... of the shape.
+template<std::signed_integral T>
+struct row_span
+{
+    vector<T>   first;  // NOLINT(misc-non-private-member-variables-in-classes)
+    vector<T>   step;   // NOLINT(misc-non-private-member-variables-in-classes)
+    std::size_t offset; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::size_t size;   // NOLINT(misc-non-private-member-variables-in-classes)
+
+    // Returns the i-th position of the row. UB if i >= size.
+    [[nodiscard]] constexpr auto operator[](std::size_t i) const noexcept -> vector<T>;
+
+    [[nodiscard]] constexpr auto operator==(row_span const& other) const noexcept -> bool = default;
+};
+
+// A random-access view of the row_spans of a shape, in the order of their offsets. Fn maps a row number to its
+// row_span.
+template<typename Fn>
+using rows_view = std::ranges::subrange<detail::generating_random_access_iterator<Fn>>;
+
+// ------------------------------ implementation below ------------------------------
+
+template<std::signed_integral T>
+constexpr auto row_span<T>::operator[](std::size_t i) const noexcept -> vector<T>
+{
+    return first + step * static_cast<T>(i);
+}
+} // namespace hex
+
+#endif // HEX_ROWS_VIEW_HPP
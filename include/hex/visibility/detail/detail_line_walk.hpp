@@ -0,0 +1,131 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_DETAIL_LINE_WALK_HPP
+#define HEX_DETAIL_LINE_WALK_HPP
+
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/line/detail/detail_line_iterator.hpp"
+#include "hex/views/neighbors/detail/detail_neighbors.hpp"
+
+#include <concepts>
+
+#include <cstddef>
+
+namespace hex::detail
+{
+// Returns the index into views::neighbors() of line_sextant_steps[sextant].
+[[nodiscard]] constexpr auto line_step_neighbor(int sextant) noexcept -> int
+{
+    return (sextant + 5) % 6; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+}
+static_assert([]
+              {
+                  for (int sextant = 0; sextant < 6; ++sextant)
+                  {
+                      auto const step     = line_sextant_steps[sextant];
+                      auto const neighbor = neighbors[line_step_neighbor(sextant)];
+                      if (neighbor.q().value() != step[0] || neighbor.r().value() != step[1])
+                          return false;
+                  }
+                  return true;
+              }());
+
+// Moves cursor along the line with extent (dq, dr), one cursor.move(neighbor) per step, and returns the first step in
+// [1, limit] after which the cursor reports its position as blocking, or limit + 1 if there is none.
+template<typename Cursor, std::signed_integral T>
+constexpr auto first_blocked_step(Cursor cursor, T dq, T dr, std::ptrdiff_t limit) -> std::ptrdiff_t
+{
+    auto const sextant         = line_sextant(dq, dr);
+    auto const first           = line_sextant_steps[sextant];
+    auto const second          = line_sextant_steps[(sextant + 1) % 6];
+    auto const first_delta     = make_line_step<T>(first[0], first[1], dq, dr).delta;
+    auto const second_delta    = make_line_step<T>(second[0], second[1], dq, dr).delta;
+    auto const first_neighbor  = line_step_neighbor(sextant);
+    auto const second_neighbor = line_step_neighbor((sextant + 1) % 6);
+
+    auto delta = (first_delta + second_delta) / 2;
+    for (std::ptrdiff_t step = 1; step <= limit; ++step)
+    {
+        bool const take_first = delta > 0;
+        delta += take_first ? first_delta : second_delta;
+        if (!cursor.move(take_first ? first_neighbor : second_neighbor))
+            return step;
+    }
+    return limit + 1;
+}
+
+// Walks a grid by position, looking every position up in the shape. Positions outside of the grid block.
+template<typename Grid>
+class shape_line_cursor
+{
+  public:
+    using key_type = typename Grid::key_type;
+
+    constexpr shape_line_cursor(Grid const& blockers, key_type const& from)
+        : m_blockers(&blockers)
+        , m_position(from)
+    {
+    }
+
+    // Moves to the given neighbor, returning false if it blocks.
+    constexpr auto move(int neighbor) -> bool
+    {
+        m_position += coordinate_cast<typename key_type::mapped_type>(neighbors[neighbor]);
+        return m_blockers->contains(m_position) && !static_cast<bool>((*m_blockers)[m_position]);
+    }
+
+  private:
+    Grid const* m_blockers;
+    key_type    m_position;
+};
+
+// Walks a grid by storage index, following a neighbor_table of its shape. Positions outside of the grid block.
+template<typename T, std::unsigned_integral Index>
+class table_line_cursor
+{
+  public:
+    constexpr table_line_cursor(T const* blockers, neighbor_table<Index> const& neighbors, std::size_t from)
+        : m_blockers(blockers)
+        , m_neighbors(&neighbors)
+        , m_index(static_cast<Index>(from))
+    {
+    }
+
+    // Moves to the given neighbor, returning false if it blocks.
+    constexpr auto move(int neighbor) -> bool
+    {
+        m_index = (*m_neighbors)[m_index][neighbor];
+        return m_index != neighbor_table<Index>::no_neighbor && !static_cast<bool>(m_blockers[m_index]);
+    }
+
+  private:
+    T const*                     m_blockers;
+    neighbor_table<Index> const* m_neighbors;
+    Index                        m_index;
+};
+} // namespace hex::detail
+
+#endif // HEX_DETAIL_LINE_WALK_HPP
@@ -0,0 +1,144 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_DETAIL_SHADOWCAST_HPP
+#define HEX_DETAIL_SHADOWCAST_HPP
+
+#include "hex/vector/vector.hpp"
+#include "hex/views/neighbors/detail/detail_neighbors.hpp"
+#include "hex/visibility/field_of_view_mode.hpp"
+
+#include <utility>
+
+#include <cstddef>
+
+namespace hex::detail
+{
+// A position within a sextant, where 0 points at its first and 1 at its second corner. The denominator is positive.
+struct shadow_slope
+{
+    std::ptrdiff_t numerator;
+    std::ptrdiff_t denominator;
+};
+
+// Returns the slope of the edge between the positions col - 1 and col of the row at depth.
+[[nodiscard]] constexpr auto shadow_edge_slope(std::ptrdiff_t col, std::ptrdiff_t depth) noexcept -> shadow_slope
+{
+    return {(2 * col) - 1, 2 * depth};
+}
+
+// Returns the largest integer not greater than n / d for d > 0.
+[[nodiscard]] constexpr auto shadow_floor_div(std::ptrdiff_t n, std::ptrdiff_t d) noexcept -> std::ptrdiff_t
+{
+    return (n / d) - (n % d < 0 ? 1 : 0);
+}
+
+// Casts shadows through the six sextants around an origin and calls visit once for every visible position. Sextant k
+// spans the rows from depth * neighbors[k] to depth * neighbors[k + 1], which are straight lines stepping by
+// neighbors[k + 2]; the last position of each row belongs to the next sextant. Positions outside of the grid are
+// opaque and never visited.
+template<typename Grid, typename Visit>
+class shadowcaster
+{
+  public:
+    using key_type   = typename Grid::key_type;
+    using value_type = typename key_type::mapped_type;
+
+    constexpr shadowcaster(Grid const&        opacity,
+                           key_type const&    origin,
+                           std::ptrdiff_t     radius,
+                           field_of_view_mode mode,
+                           Visit&             visit)
+        : m_opacity(&opacity)
+        , m_visit(&visit)
+        , m_origin(origin)
+        , m_radius(radius)
+        , m_mode(mode)
+    {
+    }
+
+    // Visits the origin and all visible positions around it.
+    constexpr void operator()()
+    {
+        if (m_radius < 0 || !m_opacity->contains(m_origin))
+            return;
+        (*m_visit)(std::as_const(m_origin));
+        for (std::size_t sextant = 0; sextant < neighbors.size(); ++sextant)
+        {
+            m_corner = coordinate_cast<value_type>(neighbors[sextant]);
+            m_step   = coordinate_cast<value_type>(neighbors[(sextant + 2) % neighbors.size()]);
+            scan(1, {0, 1}, {1, 1});
+        }
+    }
+
+  private:
+    // Scans the positions of the row at depth between the slopes start and end, and recurses into the next row once
+    // per run of transparent positions.
+    constexpr void scan(std::ptrdiff_t depth, shadow_slope start, shadow_slope const& end)
+    {
+        if (depth > m_radius)
+            return;
+
+        auto const first = shadow_floor_div((2 * depth * start.numerator) + start.denominator, 2 * start.denominator);
+        auto const last  = -shadow_floor_div(end.denominator - (2 * depth * end.numerator), 2 * end.denominator);
+        auto position    = coordinate_cast<value_type>(m_origin + (m_corner * depth) + (m_step * first));
+        bool previous_opaque = true;
+        for (auto col = first; col <= last; ++col, position += m_step)
+        {
+            bool const inside = m_opacity->contains(position);
+            bool const opaque = !inside || static_cast<bool>((*m_opacity)[position]);
+            if (inside && col < depth && (opaque || centre_in_view(col, depth, start, end)))
+                (*m_visit)(std::as_const(position));
+            if (col != first && previous_opaque && !opaque)
+                start = shadow_edge_slope(col, depth);
+            if (!previous_opaque && opaque)
+                scan(depth + 1, start, shadow_edge_slope(col, depth));
+            previous_opaque = opaque;
+        }
+        if (!previous_opaque)
+            scan(depth + 1, start, end);
+    }
+
+    // Returns true if the position col of the row at depth is visible although it is transparent.
+    [[nodiscard]] constexpr auto centre_in_view(std::ptrdiff_t      col,
+                                                std::ptrdiff_t      depth,
+                                                shadow_slope const& start,
+                                                shadow_slope const& end) const noexcept -> bool
+    {
+        if (m_mode == field_of_view_mode::permissive)
+            return true;
+        return col * start.denominator >= depth * start.numerator && col * end.denominator <= depth * end.numerator;
+    }
+
+    Grid const*        m_opacity;
+    Visit*             m_visit;
+    key_type           m_origin;
+    key_type           m_corner{};
+    key_type           m_step{};
+    std::ptrdiff_t     m_radius;
+    field_of_view_mode m_mode;
+};
+} // namespace hex::detail
+
+#endif // HEX_DETAIL_SHADOWCAST_HPP
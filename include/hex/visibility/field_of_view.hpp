@@ -0,0 +1,87 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_FIELD_OF_VIEW_HPP
+#define HEX_FIELD_OF_VIEW_HPP
+
+#include "hex/grid/grid.hpp"
+#include "hex/visibility/detail/detail_shadowcast.hpp"
+#include "hex/visibility/field_of_view_mode.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <ranges>
+
+#include <cstddef>
+
+namespace hex
+{
+// Calls visit(position) once for every position of opacity within radius of origin that is visible from origin. A
+// position is opaque if it is outside of the grid or its value converts to true. Uses shadowcasting, which looks at
+// every position within radius at most once and does not allocate. Nothing is visible if origin is outside of the grid.
+template<typename T, grid_shape Shape, class Allocator, typename Visit>
+    requires std::invocable<Visit&, std::ranges::range_value_t<Shape> const&>
+constexpr void field_of_view(grid<T, Shape, Allocator> const&                      opacity,
+                             typename grid<T, Shape, Allocator>::key_type const& origin,
+                             std::ptrdiff_t                                        radius,
+                             Visit                                                 visit,
+                             field_of_view_mode mode = field_of_view_mode::symmetric);
+// As above, but sets every value of visible to whether its position is visible. The shape of visible must contain the
+// shape of opacity.
+template<typename T, grid_shape Shape, class Allocator, typename U, class VisibleAllocator>
+    requires std::assignable_from<U&, bool>
+constexpr void field_of_view(grid<T, Shape, Allocator> const&                      opacity,
+                             typename grid<T, Shape, Allocator>::key_type const& origin,
+                             std::ptrdiff_t                                        radius,
+                             grid<U, Shape, VisibleAllocator>&                     visible,
+                             field_of_view_mode mode = field_of_view_mode::symmetric);
+} // namespace hex
+
+// ------------------------------ implementation below ------------------------------
+
+template<typename T, hex::grid_shape Shape, class Allocator, typename Visit>
+    requires std::invocable<Visit&, std::ranges::range_value_t<Shape> const&>
+constexpr void hex::field_of_view(hex::grid<T, Shape, Allocator> const&                      opacity,
+                                  typename hex::grid<T, Shape, Allocator>::key_type const& origin,
+                                  std::ptrdiff_t                                             radius,
+                                  Visit                                                      visit,
+                                  hex::field_of_view_mode                                    mode)
+{
+    hex::detail::shadowcaster(opacity, origin, radius, mode, visit)();
+}
+
+template<typename T, hex::grid_shape Shape, class Allocator, typename U, class VisibleAllocator>
+    requires std::assignable_from<U&, bool>
+constexpr void hex::field_of_view(hex::grid<T, Shape, Allocator> const&                      opacity,
+                                  typename hex::grid<T, Shape, Allocator>::key_type const& origin,
+                                  std::ptrdiff_t                                             radius,
+                                  hex::grid<U, Shape, VisibleAllocator>&                     visible,
+                                  hex::field_of_view_mode                                    mode)
+{
+    std::ranges::fill(visible | std::views::values, false);
+    hex::field_of_view(
+        opacity, origin, radius, [&](auto const& position) { visible[position] = true; }, mode);
+}
+
+#endif // HEX_FIELD_OF_VIEW_HPP
@@ -0,0 +1,43 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_FIELD_OF_VIEW_MODE_HPP
+#define HEX_FIELD_OF_VIEW_MODE_HPP
+
+#include <cstdint>
+
+namespace hex
+{
+// Selects which positions field_of_view() reports as visible.
+enum class field_of_view_mode : std::uint8_t
+{
+    // Transparent positions are visible if their centre is in view, opaque positions if any part of them is. Visibility
+    // between two transparent positions is symmetric.
+    symmetric,
+    // All positions are visible if any part of them is in view.
+    permissive,
+};
+} // namespace hex
+
+#endif // HEX_FIELD_OF_VIEW_MODE_HPP
@@ -0,0 +1,133 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HEX_LINE_OF_SIGHT_HPP
+#define HEX_LINE_OF_SIGHT_HPP
+
+#include "hex/grid/grid.hpp"
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/visibility/detail/detail_line_walk.hpp"
+
+#include <concepts>
+#include <span>
+
+#include <cstddef>
+
+namespace hex
+{
+// Returns true if none of the positions strictly between from and to on views::line(from, to) blocks sight, otherwise
+// false. A position blocks if it is outside of the grid or its value converts to true; the end points are never
+// checked. Stops at the first blocking position.
+template<typename T, grid_shape Shape, class Allocator>
+[[nodiscard]] constexpr auto line_of_sight(grid<T, Shape, Allocator> const&                      blockers,
+                                           typename grid<T, Shape, Allocator>::key_type const& from,
+                                           typename grid<T, Shape, Allocator>::key_type const& to) -> bool;
+// As above, but steps through the storage of the grid using neighbors, which must have been built for its shape,
+// instead of looking up every position in the shape. UB if from is not in the grid.
+template<typename T, grid_shape Shape, class Allocator, std::unsigned_integral Index>
+[[nodiscard]] constexpr auto line_of_sight(grid<T, Shape, Allocator> const&                      blockers,
+                                           neighbor_table<Index> const&                          neighbors,
+                                           typename grid<T, Shape, Allocator>::key_type const& from,
+                                           typename grid<T, Shape, Allocator>::key_type const& to) -> bool;
+
+// Sets visible[i] to line_of_sight(blockers, from, targets[i]) for every target. The walk state at from is set up once
+// and shared by all lines, each of which stops at its first blocking position. Does not allocate. UB if visible is
+// shorter than targets.
+template<typename T, grid_shape Shape, class Allocator>
+constexpr void line_of_sight_many(grid<T, Shape, Allocator> const&                                 blockers,
+                                  typename grid<T, Shape, Allocator>::key_type const&              from,
+                                  std::span<typename grid<T, Shape, Allocator>::key_type const> targets,
+                                  std::span<bool>                                                  visible);
+// As above, but steps through the storage of the grid using neighbors, which must have been built for its shape,
+// instead of looking up every position in the shape. UB if from is not in the grid.
+template<typename T, grid_shape Shape, class Allocator, std::unsigned_integral Index>
+constexpr void line_of_sight_many(grid<T, Shape, Allocator> const&                                 blockers,
+                                  neighbor_table<Index> const&                                     neighbors,
+                                  typename grid<T, Shape, Allocator>::key_type const&              from,
+                                  std::span<typename grid<T, Shape, Allocator>::key_type const> targets,
+                                  std::span<bool>                                                  visible);
+
+namespace detail
+{
+// Returns line_of_sight() of the line from the cursor position by d.
+template<typename Cursor, typename Key>
+constexpr auto line_of_sight_from(Cursor const& cursor, Key const& d) -> bool
+{
+    auto const length = static_cast<std::ptrdiff_t>(d.norm());
+    return first_blocked_step(cursor, d.q().value(), d.r().value(), length - 1) == length;
+}
+
+// Implements line_of_sight_many() for the given cursor at from.
+template<typename Cursor, typename Key>
+constexpr void line_of_sight_many_from(Cursor const&        cursor,
+                                       Key const&           from,
+                                       std::span<Key const> targets,
+                                       std::span<bool>      visible)
+{
+    for (std::size_t i = 0; i < targets.size(); ++i)
+        visible[i] = line_of_sight_from(cursor, targets[i] - from);
+}
+} // namespace detail
+} // namespace hex
+
+// ------------------------------ implementation below ------------------------------
+
+template<typename T, hex::grid_shape Shape, class Allocator>
+constexpr auto hex::line_of_sight(hex::grid<T, Shape, Allocator> const&                      blockers,
+                                  typename hex::grid<T, Shape, Allocator>::key_type const& from,
+                                  typename hex::grid<T, Shape, Allocator>::key_type const& to) -> bool
+{
+    return hex::detail::line_of_sight_from(hex::detail::shape_line_cursor(blockers, from), to - from);
+}
+template<typename T, hex::grid_shape Shape, class Allocator, std::unsigned_integral Index>
+constexpr auto hex::line_of_sight(hex::grid<T, Shape, Allocator> const&                      blockers,
+                                  hex::neighbor_table<Index> const&                          neighbors,
+                                  typename hex::grid<T, Shape, Allocator>::key_type const& from,
+                                  typename hex::grid<T, Shape, Allocator>::key_type const& to) -> bool
+{
+    auto const cursor = hex::detail::table_line_cursor(blockers.data(), neighbors, blockers.shape()[from]);
+    return hex::detail::line_of_sight_from(cursor, to - from);
+}
+
+template<typename T, hex::grid_shape Shape, class Allocator>
+constexpr void hex::line_of_sight_many(hex::grid<T, Shape, Allocator> const&                                 blockers,
+                                       typename hex::grid<T, Shape, Allocator>::key_type const&              from,
+                                       std::span<typename hex::grid<T, Shape, Allocator>::key_type const> targets,
+                                       std::span<bool>                                                       visible)
+{
+    hex::detail::line_of_sight_many_from(hex::detail::shape_line_cursor(blockers, from), from, targets, visible);
+}
+template<typename T, hex::grid_shape Shape, class Allocator, std::unsigned_integral Index>
+constexpr void hex::line_of_sight_many(hex::grid<T, Shape, Allocator> const&                                 blockers,
+                                       hex::neighbor_table<Index> const&                                     neighbors,
+                                       typename hex::grid<T, Shape, Allocator>::key_type const&              from,
+                                       std::span<typename hex::grid<T, Shape, Allocator>::key_type const> targets,
+                                       std::span<bool>                                                       visible)
+{
+    auto const cursor = hex::detail::table_line_cursor(blockers.data(), neighbors, blockers.shape()[from]);
+    hex::detail::line_of_sight_many_from(cursor, from, targets, visible);
+}
+
+#endif // HEX_LINE_OF_SIGHT_HPP
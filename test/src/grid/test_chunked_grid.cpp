@@ -0,0 +1,176 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/chunked_grid.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+
+#include <cstddef>
+
+using namespace hex;
+using namespace hex::literals;
+
+TEST_CASE("chunked_grid")
+{
+    using int_grid = chunked_grid<int, 4>;
+
+    SECTION("concepts")
+    {
+        STATIC_CHECK(std::ranges::sized_range<int_grid>);
+        STATIC_CHECK(std::ranges::bidirectional_range<int_grid>);
+        STATIC_CHECK(std::ranges::common_range<int_grid>);
+        STATIC_CHECK(std::ranges::bidirectional_range<int_grid const>);
+    }
+
+    SECTION("default constructor")
+    {
+        int_grid const grid;
+        CHECK(grid.empty());
+        CHECK(grid.size() == 0);
+        CHECK(grid.chunk_count() == 0);
+        CHECK(grid.begin() == grid.end());
+        CHECK_FALSE(grid.contains(vector{0_q, 0_r}));
+        CHECK(grid.find(vector{0_q, 0_r}) == grid.end());
+    }
+
+    SECTION("chunk_origin")
+    {
+        STATIC_CHECK(int_grid::chunk_origin(vector{0_q, 0_r}) == vector{0_q, 0_r});
+        STATIC_CHECK(int_grid::chunk_origin(vector{3_q, 5_r}) == vector{0_q, 4_r});
+        STATIC_CHECK(int_grid::chunk_origin(vector{-1_q, -4_r}) == vector{-4_q, -4_r});
+        STATIC_CHECK(int_grid::chunk_origin(vector{-5_q, 4_r}) == vector{-8_q, 4_r});
+    }
+
+    SECTION("operator[] allocates chunks lazily")
+    {
+        int_grid grid;
+        grid[vector{1_q, 2_r}] = 5;
+        CHECK(grid.chunk_count() == 1);
+        CHECK(grid.size() == int_grid::chunk_volume);
+        CHECK(grid.contains(vector{3_q, 3_r}));
+        CHECK_FALSE(grid.contains(vector{4_q, 3_r}));
+        CHECK(grid[vector{1_q, 2_r}] == 5);
+        CHECK(grid[vector{0_q, 0_r}] == 0);
+
+        grid[vector{3_q, 0_r}] = 6;
+        CHECK(grid.chunk_count() == 1);
+
+        grid[vector{-1_q, 0_r}] = 7;
+        CHECK(grid.chunk_count() == 2);
+        CHECK(grid[vector{-1_q, 0_r}] == 7);
+        CHECK(grid[vector{1_q, 2_r}] == 5);
+    }
+
+    SECTION("references are stable")
+    {
+        int_grid grid;
+        int&     value = grid[vector{0_q, 0_r}];
+        for (int q = -100; q <= 100; q += 4)
+            grid[vector{q_coordinate{q}, 50_r}] = q;
+        value = 42;
+        CHECK(grid[vector{0_q, 0_r}] == 42);
+    }
+
+    SECTION("at")
+    {
+        int_grid grid{{vector{0_q, 0_r}, 1}};
+        CHECK(grid.at(vector{0_q, 0_r}) == 1);
+        CHECK(std::as_const(grid).at(vector{1_q, 1_r}) == 0);
+        CHECK_THROWS_AS(grid.at(vector{0_q, -1_r}), std::out_of_range);
+        CHECK_THROWS_AS(std::as_const(grid).at(vector{4_q, 0_r}), std::out_of_range);
+    }
+
+    SECTION("iteration")
+    {
+        int_grid grid{{vector{-3_q, 7_r}, 1}, {vector{10_q, -10_r}, 2}};
+        CHECK(grid.chunk_count() == 2);
+        CHECK(static_cast<std::size_t>(std::ranges::distance(grid)) == grid.size());
+        CHECK(static_cast<std::size_t>(std::ranges::distance(grid.rbegin(), grid.rend())) == grid.size());
+        CHECK(std::ranges::all_of(grid, [&grid](auto&& e) { return grid.find(e.first) != grid.end(); }));
+        CHECK(std::ranges::count_if(grid, [](auto&& e) { return e.second != 0; }) == 2);
+
+        for (auto&& [key, value] : grid)
+            value = key.q().value() * 100 + key.r().value();
+        CHECK(grid[vector{-3_q, 7_r}] == -293);
+        CHECK(grid[vector{9_q, -9_r}] == 891);
+    }
+
+    SECTION("positions within a chunk are ordered like convex_polygon_view")
+    {
+        int_grid const                           grid{{vector{1_q, 2_r}, 1}};
+        constexpr convex_polygon_parameters<int> params(0_q, 0_r, -6_s, 3_q, 3_r, 0_s);
+        CHECK(std::ranges::equal(grid | std::views::keys, views::convex_polygon(params)));
+    }
+
+    SECTION("find")
+    {
+        int_grid grid{{vector{5_q, -6_r}, 3}};
+        auto     iter = grid.find(vector{5_q, -6_r});
+        REQUIRE(iter != grid.end());
+        CHECK((*iter).first == vector{5_q, -6_r});
+        CHECK((*iter).second == 3);
+        CHECK(grid.find(vector{5_q, 6_r}) == grid.end());
+    }
+
+    SECTION("clear and swap")
+    {
+        int_grid lhs{{vector{0_q, 0_r}, 1}};
+        int_grid rhs;
+        swap(lhs, rhs);
+        CHECK(lhs.empty());
+        CHECK(rhs.chunk_count() == 1);
+        rhs.clear();
+        CHECK(rhs.empty());
+        CHECK(rhs.begin() == rhs.end());
+    }
+
+    SECTION("move leaves the source empty")
+    {
+        int_grid source{{vector{0_q, 0_r}, 1}, {vector{9_q, -9_r}, 2}};
+        int_grid constructed(std::move(source));
+        CHECK(constructed.chunk_count() == 2);
+        CHECK(source.empty()); // NOLINT(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+        CHECK(source.chunk_count() == 0);
+        CHECK_FALSE(source.contains(vector{0_q, 0_r}));
+        CHECK(source.find(vector{9_q, -9_r}) == source.end());
+        CHECK(source.begin() == source.end());
+
+        int_grid assigned;
+        assigned = std::move(constructed);
+        CHECK(assigned[vector{9_q, -9_r}] == 2);
+        CHECK(constructed.empty()); // NOLINT(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+        CHECK_FALSE(constructed.contains(vector{0_q, 0_r}));
+
+        constructed[vector{1_q, 1_r}] = 3;
+        CHECK(constructed.chunk_count() == 1);
+    }
+}
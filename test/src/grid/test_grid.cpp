@@ -29,9 +29,11 @@
 #include <catch2/catch_all.hpp>
 
 #include <algorithm>
+#include <array>
 #include <iterator>
 #include <memory>
 #include <ranges>
+#include <span>
 #include <stdexcept>
 #include <utility>
 
@@ -60,6 +62,11 @@ TEST_CASE("grid")
         STATIC_CHECK(std::ranges::sized_range<rectangular_grid>);
         STATIC_CHECK(std::ranges::bidirectional_range<rectangular_grid>);
         STATIC_CHECK(std::ranges::common_range<rectangular_grid>);
+
+        STATIC_CHECK(std::ranges::random_access_range<convex_grid>);
+        STATIC_CHECK(std::ranges::random_access_range<convex_grid const>);
+        STATIC_CHECK(std::ranges::random_access_range<rectangular_grid>);
+        STATIC_CHECK(std::ranges::random_access_range<rectangular_grid const>);
     }
 
     SECTION("constructor with shape")
@@ -218,6 +225,33 @@ TEST_CASE("grid")
             CHECK(i == 0);
         }
     }
+    SECTION("random access")
+    {
+        convex_grid quadrangular_grid(quadrangle_shape);
+        int         i = 0;
+        for (auto& v : quadrangular_grid | std::views::values)
+            v = i++;
+
+        auto const first = quadrangular_grid.begin();
+        auto const last  = quadrangular_grid.end();
+        CHECK(last - first == static_cast<std::ptrdiff_t>(quadrangular_grid.size()));
+        CHECK(first < last);
+        for (std::ptrdiff_t n = 0; n < last - first; ++n)
+        {
+            CAPTURE(n);
+            CHECK((*(first + n)).first == quadrangle_shape[static_cast<std::size_t>(n)]);
+            CHECK(first[n].second == n);
+            CHECK((last - (last - first - n)) == first + n);
+        }
+
+        rectangular_grid grid(rectangular_shape);
+        auto             iter = grid.begin() + 3;
+        (*iter).second        = 42;
+        CHECK(grid[*(rectangular_shape.begin() + 3)] == 42);
+        iter -= 2;
+        CHECK((*iter).first == *(rectangular_shape.begin() + 1));
+    }
+
     SECTION("default-constructed iterator equals end()")
     {
         convex_grid const triangular_grid(triangle_shape);
@@ -240,6 +274,53 @@ TEST_CASE("grid")
         CHECK(triangular_grid[{-1_q, 0_r}] == 0);
     }
 
+    SECTION("shape and data")
+    {
+        convex_grid triangular_grid({{{-1_q, 0_r}, 1}, {{0_q, 0_r}, 42}}, triangle_shape);
+        CHECK(triangular_grid.shape() == triangle_shape);
+        CHECK(triangular_grid.data()[triangle_shape[{-1_q, 0_r}]] == 1);
+        CHECK(std::as_const(triangular_grid).data()[triangle_shape[{0_q, 0_r}]] == 42);
+
+        triangular_grid.data()[triangle_shape[{0_q, 0_r}]] = 7;
+        CHECK(triangular_grid[{0_q, 0_r}] == 7);
+    }
+
+    SECTION("rows")
+    {
+        SECTION("convex")
+        {
+            convex_grid quadrangular_grid(quadrangle_shape);
+            for (auto const& [key, value] : quadrangular_grid)
+                value = key.q().value() * 10 + key.r().value(); // NOLINT(readability-magic-numbers)
+
+            auto const shape_rows = quadrangle_shape.rows();
+            auto       rows       = quadrangular_grid.rows();
+            CHECK(std::ranges::size(rows) == std::ranges::size(shape_rows));
+            for (std::size_t row = 0; row < shape_rows.size(); ++row)
+            {
+                std::span<int> const values = rows[static_cast<std::ptrdiff_t>(row)];
+                REQUIRE(values.size() == shape_rows[row].size);
+                for (std::size_t i = 0; i < values.size(); ++i)
+                    CHECK(values[i] == quadrangular_grid[shape_rows[row][i]]);
+            }
+
+            for (auto const values : rows)
+                std::ranges::fill(values, 3);
+            CHECK(std::ranges::all_of(std::as_const(quadrangular_grid).rows(),
+                                      [](std::span<int const> values)
+                                      { return std::ranges::all_of(values, [](int v) { return v == 3; }); }));
+        }
+        SECTION("rectangular")
+        {
+            rectangular_grid const grid({{{-1_q, 0_r}, 1}, {{0_q, 0_r}, 2}, {{1_q, -1_r}, 3}}, rectangular_shape);
+            auto const             rows = grid.rows();
+            REQUIRE(std::ranges::size(rows) == 3);
+            CHECK(std::ranges::equal(rows[0], std::array{1, 0}));
+            CHECK(std::ranges::equal(rows[1], std::array{2, 0}));
+            CHECK(std::ranges::equal(rows[2], std::array{3, 0}));
+        }
+    }
+
     SECTION("find")
     {
         SECTION("convex")
@@ -0,0 +1,118 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/neighbors/neighbors_view.hpp"
+#include "hex/views/offset_rows/offset_rows_parameters.hpp"
+#include "hex/views/offset_rows/offset_rows_view.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <ranges>
+#include <stdexcept>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+using namespace hex::literals;
+
+namespace
+{
+template<class Shape, class Table>
+auto matches_neighbors(Shape const& shape, Table const& table) -> bool
+{
+    if (table.size() != static_cast<std::size_t>(shape.size()))
+        return false;
+    return std::ranges::all_of(shape,
+                               [&](auto const& key)
+                               {
+                                   auto const& row = table[shape[key]];
+                                   std::size_t i   = 0;
+                                   for (auto const& neighbor : views::neighbors(key))
+                                   {
+                                       auto const expected =
+                                           shape.contains(neighbor) ? shape[neighbor] : Table::no_neighbor;
+                                       if (row[i++] != expected)
+                                           return false;
+                                   }
+                                   return true;
+                               });
+}
+} // namespace
+
+TEST_CASE("neighbor_table")
+{
+    SECTION("default constructor")
+    {
+        neighbor_table<> const table;
+        CHECK(table.empty());
+        CHECK(table.size() == 0);
+        CHECK(table.begin() == table.end());
+    }
+
+    SECTION("single hex")
+    {
+        neighbor_table<> const table(views::convex_polygon(make_regular_hexagon_parameters(0)));
+        REQUIRE(table.size() == 1);
+        CHECK(std::ranges::all_of(table[0], [](auto i) { return i == neighbor_table<>::no_neighbor; }));
+    }
+
+    SECTION("convex polygon")
+    {
+        auto const hexagon = views::convex_polygon(make_regular_hexagon_parameters(3));
+        CHECK(matches_neighbors(hexagon, neighbor_table<>(hexagon)));
+
+        auto const center = hexagon[vector{0_q, 0_r}];
+        CHECK(std::ranges::none_of(neighbor_table<>(hexagon)[center],
+                                   [](auto i) { return i == neighbor_table<>::no_neighbor; }));
+
+        auto const polygon = views::convex_polygon(convex_polygon_parameters{-2_q, -1_r, -3_s, 4_q, 2_r, 1_s});
+        CHECK(matches_neighbors(polygon, neighbor_table<std::uint16_t>(polygon)));
+    }
+
+    SECTION("offset rows")
+    {
+        auto const rows = views::offset_rows(offset_rows_parameters<int>(5, 4));
+        CHECK(matches_neighbors(rows, neighbor_table<>(rows)));
+    }
+
+    SECTION("from grid")
+    {
+        grid<int, convex_polygon_view<int>> const g(views::convex_polygon(make_regular_hexagon_parameters(2)));
+        neighbor_table<> const                    table(g.shape());
+        CHECK(table.size() == g.size());
+        CHECK(table == neighbor_table<>(g.shape()));
+    }
+
+    SECTION("index type too small")
+    {
+        CHECK_THROWS_AS(neighbor_table<std::uint8_t>(views::convex_polygon(make_regular_hexagon_parameters(10))),
+                        std::length_error);
+    }
+}
@@ -0,0 +1,154 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/soa_grid.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/offset_rows/offset_rows_parameters.hpp"
+#include "hex/views/offset_rows/offset_rows_view.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+using namespace hex::literals;
+
+TEST_CASE("soa_grid")
+{
+    constexpr convex_polygon_view<int> triangle_shape{make_regular_triangle_parameters(1_q, 0_r, 1_s)};
+    constexpr offset_rows_view<int>    rectangular_shape{{3, 2, coordinate_axis::q, offset_parity::odd, {-1_q, 0_r}}};
+
+    using convex_grid      = soa_grid<convex_polygon_view<int>, int, float, std::uint8_t>;
+    using rectangular_grid = soa_grid<offset_rows_view<int>, int, double>;
+
+    SECTION("concepts")
+    {
+        STATIC_CHECK(std::ranges::sized_range<convex_grid>);
+        STATIC_CHECK(std::ranges::bidirectional_range<convex_grid>);
+        STATIC_CHECK(std::ranges::common_range<convex_grid>);
+
+        STATIC_CHECK(std::ranges::sized_range<rectangular_grid>);
+        STATIC_CHECK(std::ranges::bidirectional_range<rectangular_grid>);
+        STATIC_CHECK(std::ranges::common_range<rectangular_grid>);
+    }
+
+    SECTION("constructor with shape")
+    {
+        convex_grid const grid(triangle_shape);
+        CHECK(grid.size() == 6);
+        CHECK(grid.field<0>().size() == 6);
+        CHECK(grid.field<1>().size() == 6);
+        CHECK(grid.field<2>().size() == 6);
+        CHECK(static_cast<std::size_t>(std::ranges::distance(grid)) == grid.size());
+        CHECK(std::ranges::all_of(grid.field<0>(), [](int i) { return i == 0; }));
+    }
+
+    SECTION("initializer_list constructor")
+    {
+        rectangular_grid const grid({{vector{-1_q, 0_r}, {1, 1.5}}, {vector{0_q, 0_r}, {2, 2.5}}}, rectangular_shape);
+        CHECK(grid.size() == 6);
+        CHECK(grid[vector{-1_q, 0_r}] == std::tuple{1, 1.5});
+        CHECK(grid[vector{0_q, 0_r}] == std::tuple{2, 2.5});
+        CHECK(std::reduce(grid.field<0>().begin(), grid.field<0>().end()) == 3);
+    }
+
+    SECTION("element access")
+    {
+        convex_grid grid(triangle_shape);
+        for (auto&& [key, fields] : grid)
+        {
+            auto&& [a, b, c] = fields;
+            a                = key.q().value();
+            b                = static_cast<float>(key.r().value());
+            c                = 7;
+        }
+
+        for (auto const& key : triangle_shape)
+        {
+            auto const [a, b, c] = grid[key];
+            CHECK(a == key.q().value());
+            CHECK(b == static_cast<float>(key.r().value()));
+            CHECK(c == 7);
+            CHECK(grid.field<0>(key) == a);
+            CHECK(grid.field<0>()[grid.index_of(key)] == a);
+            CHECK(std::get<1>(grid.element(grid.index_of(key))) == b);
+        }
+
+        std::get<0>(grid[vector{1_q, 0_r}]) = 42;
+        CHECK(grid.field<0>(vector{1_q, 0_r}) == 42);
+        CHECK(std::get<0>(std::as_const(grid).at(vector{1_q, 0_r})) == 42);
+    }
+
+    SECTION("at")
+    {
+        convex_grid grid(triangle_shape);
+        CHECK_NOTHROW(grid.at(vector{1_q, 0_r}));
+        CHECK_THROWS_AS(grid.at(vector{5_q, 5_r}), std::out_of_range);
+        CHECK_THROWS_AS(std::as_const(grid).at(vector{5_q, 5_r}), std::out_of_range);
+    }
+
+    SECTION("field spans are independent")
+    {
+        rectangular_grid grid(rectangular_shape);
+        std::ranges::fill(grid.field<1>(), 0.5);
+        std::iota(grid.field<0>().begin(), grid.field<0>().end(), 0);
+        for (std::size_t i = 0; i < grid.size(); ++i)
+        {
+            CHECK(grid.field<0>()[i] == static_cast<int>(i));
+            CHECK(grid.field<1>()[i] == 0.5);
+        }
+    }
+
+    SECTION("find and contains")
+    {
+        convex_grid const grid(triangle_shape);
+        CHECK(grid.contains(vector{1_q, 0_r}));
+        CHECK_FALSE(grid.contains(vector{5_q, 5_r}));
+        CHECK(grid.count(vector{1_q, 0_r}) == 1);
+        CHECK(grid.find(vector{5_q, 5_r}) == grid.end());
+        CHECK((*grid.find(vector{1_q, 0_r})).first == vector{1_q, 0_r});
+    }
+
+    SECTION("equality and swap")
+    {
+        rectangular_grid lhs(rectangular_shape);
+        rectangular_grid rhs(rectangular_shape);
+        CHECK(lhs == rhs);
+        std::get<1>(rhs[vector{0_q, 0_r}]) = 1.;
+        CHECK(lhs != rhs);
+        swap(lhs, rhs);
+        CHECK(lhs.field<1>(vector{0_q, 0_r}) == 1.);
+        CHECK(rhs.field<1>(vector{0_q, 0_r}) == 0.);
+    }
+}
@@ -0,0 +1,134 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "hex/grid/grid.hpp"
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/grid/space_filling_order.hpp"
+#include "hex/grid/space_filling_shape.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/neighbors/neighbors_view.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <ranges>
+#include <vector>
+
+#include <cstddef>
+
+using namespace hex;
+using namespace hex::literals;
+
+namespace
+{
+// Returns the keys of shape, sorted.
+template<class Shape>
+auto sorted_keys(Shape const& shape) -> std::vector<vector<int>>
+{
+    std::vector<vector<int>> keys(std::ranges::begin(shape), std::ranges::end(shape));
+    std::ranges::sort(keys);
+    return keys;
+}
+} // namespace
+
+TEST_CASE("space_filling_shape", "[space_filling_shape]")
+{
+    auto const hexagon       = convex_polygon_view<int>(make_regular_hexagon_parameters(7));
+    auto const parallelogram = convex_polygon_view<int>(convex_polygon_parameters{-3_q, -6_r, -14_s, 12_q, 2_r, 9_s});
+    auto const order         = GENERATE(space_filling_order::morton, space_filling_order::hilbert);
+    auto const base          = GENERATE(true, false) ? hexagon : parallelogram;
+    auto const shape         = space_filling_shape(base, order);
+
+    SECTION("holds the positions of the base shape")
+    {
+        CHECK(shape.order() == order);
+        CHECK(shape.size() == base.size());
+        CHECK(sorted_keys(shape) == sorted_keys(base));
+    }
+
+    SECTION("indices follow iteration order")
+    {
+        std::size_t index = 0;
+        for (auto const& key : shape)
+        {
+            CHECK(shape[key] == index);
+            CHECK(shape[index] == key);
+            CHECK(shape.find(key) == shape.begin() + static_cast<std::ptrdiff_t>(index));
+            ++index;
+        }
+    }
+
+    SECTION("contains")
+    {
+        for (int q = -20; q <= 20; ++q)
+        {
+            for (int r = -20; r <= 20; ++r)
+            {
+                auto const key = vector{q_coordinate(q), r_coordinate(r)};
+                CHECK(shape.contains(key) == base.contains(key));
+                if (!base.contains(key))
+                    CHECK(shape.find(key) == shape.end());
+            }
+        }
+    }
+
+    SECTION("hilbert order steps to adjacent positions")
+    {
+        if (order == space_filling_order::hilbert && base == hexagon)
+        {
+            // The curve leaves the shape at times, but most steps are to a neighbor in (q, r).
+            std::size_t adjacent = 0;
+            for (std::size_t i = 1; i < shape.size(); ++i)
+            {
+                auto const step = shape[i] - shape[i - 1];
+                adjacent += std::abs(step.q().value()) + std::abs(step.r().value()) == 1 ? 1 : 0;
+            }
+            CHECK(adjacent * 10 >= shape.size() * 9);
+        }
+    }
+
+    SECTION("grid")
+    {
+        grid<int, space_filling_shape<convex_polygon_view<int>>> values(shape);
+        for (auto const& key : base)
+            values[key] = key.q().value() * 100 + key.r().value(); // NOLINT(*-magic-numbers)
+        for (auto const& [key, value] : values)
+            CHECK(value == key.q().value() * 100 + key.r().value()); // NOLINT(*-magic-numbers)
+        for (auto const& key : base)
+            CHECK(values.data()[shape[key]] == values[key]);
+        CHECK(values.contains(vector{0_q, 0_r}));
+        CHECK_FALSE(values.contains(vector{40_q, 0_r}));
+
+        neighbor_table<> const table(shape);
+        for (auto const& key : shape)
+        {
+            auto const& row = table[shape[key]];
+            CHECK(std::ranges::count_if(row, [](auto index) { return index != neighbor_table<>::no_neighbor; })
+                  == std::ranges::count_if(views::neighbors(key), [&](auto const& n) { return base.contains(n); }));
+        }
+    }
+}
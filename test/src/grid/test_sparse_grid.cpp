@@ -0,0 +1,264 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/sparse_grid.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+using namespace hex::literals;
+
+namespace
+{
+// Throws on construction from a negative value.
+struct throwing_value
+{
+    throwing_value() = default;
+    explicit throwing_value(int v)
+        : value(v)
+    {
+        if (v < 0)
+            throw std::invalid_argument("negative value");
+    }
+
+    int value = 0; // NOLINT(misc-non-private-member-variables-in-classes)
+};
+} // namespace
+
+TEST_CASE("sparse_grid")
+{
+    using int_grid = sparse_grid<int>;
+
+    SECTION("concepts")
+    {
+        STATIC_CHECK(std::ranges::sized_range<int_grid>);
+        STATIC_CHECK(std::ranges::bidirectional_range<int_grid>);
+        STATIC_CHECK(std::ranges::common_range<int_grid>);
+        STATIC_CHECK(std::ranges::bidirectional_range<int_grid const>);
+    }
+
+    SECTION("default constructor")
+    {
+        int_grid const grid;
+        CHECK(grid.empty());
+        CHECK(grid.size() == 0);
+        CHECK(grid.capacity() == 0);
+        CHECK(grid.begin() == grid.end());
+        CHECK_FALSE(grid.contains(vector{0_q, 0_r}));
+        CHECK(grid.find(vector{0_q, 0_r}) == grid.end());
+    }
+
+    SECTION("initializer_list constructor")
+    {
+        int_grid const grid{
+            {vector{0_q, 0_r}, 1},
+            {vector{-3_q, 7_r}, 2},
+            {vector{100_q, -100_r}, 3},
+        };
+        CHECK(grid.size() == 3);
+        CHECK(static_cast<std::size_t>(std::ranges::distance(grid)) == grid.size());
+        CHECK(grid[vector{0_q, 0_r}] == 1);
+        CHECK(grid[vector{-3_q, 7_r}] == 2);
+        CHECK(grid[vector{100_q, -100_r}] == 3);
+    }
+
+    SECTION("iterator constructor")
+    {
+        std::vector<std::pair<vector<int> const, int>> const values{{vector{1_q, 2_r}, 4}, {vector{-1_q, -2_r}, 5}};
+        int_grid const                                         grid(values.begin(), values.end());
+        CHECK(grid.size() == 2);
+        CHECK(grid.at(vector{1_q, 2_r}) == 4);
+        CHECK(grid.at(vector{-1_q, -2_r}) == 5);
+    }
+
+    SECTION("operator[] inserts")
+    {
+        int_grid grid;
+        grid[vector{2_q, -1_r}] += 3;
+        grid[vector{2_q, -1_r}] += 3;
+        CHECK(grid.size() == 1);
+        CHECK(grid[vector{2_q, -1_r}] == 6);
+    }
+
+    SECTION("at")
+    {
+        int_grid grid{{vector{0_q, 0_r}, 1}};
+        CHECK(grid.at(vector{0_q, 0_r}) == 1);
+        CHECK_THROWS_AS(grid.at(vector{0_q, 1_r}), std::out_of_range);
+        CHECK_THROWS_AS(std::as_const(grid).at(vector{0_q, 1_r}), std::out_of_range);
+    }
+
+    SECTION("try_emplace")
+    {
+        int_grid grid;
+        auto [iter, inserted] = grid.try_emplace(vector{1_q, 1_r}, 7);
+        CHECK(inserted);
+        CHECK((*iter).first == vector{1_q, 1_r});
+        CHECK((*iter).second == 7);
+
+        std::tie(iter, inserted) = grid.try_emplace(vector{1_q, 1_r}, 8);
+        CHECK_FALSE(inserted);
+        CHECK((*iter).second == 7);
+    }
+
+    SECTION("try_emplace leaves the grid unchanged if the value constructor throws")
+    {
+        sparse_grid<throwing_value> grid;
+        grid.try_emplace(vector{0_q, 0_r}, 1);
+        CHECK_THROWS_AS(grid.try_emplace(vector{1_q, 1_r}, -1), std::invalid_argument);
+        CHECK(grid.size() == 1);
+        CHECK_FALSE(grid.contains(vector{1_q, 1_r}));
+        CHECK(grid.at(vector{0_q, 0_r}).value == 1);
+    }
+
+    SECTION("growth and iteration")
+    {
+        int_grid grid;
+        for (int q = -20; q <= 20; ++q)
+        {
+            for (int r = -20; r <= 20; ++r)
+                grid[vector{q_coordinate{q}, r_coordinate{r}}] = q * 100 + r;
+        }
+        CHECK(grid.size() == 41 * 41);
+        CHECK(grid.capacity() >= grid.size());
+        CHECK(static_cast<std::size_t>(std::ranges::distance(grid)) == grid.size());
+        CHECK(static_cast<std::size_t>(std::ranges::distance(grid.rbegin(), grid.rend())) == grid.size());
+        CHECK(std::ranges::all_of(grid,
+                                  [](auto&& e)
+                                  { return e.second == e.first.q().value() * 100 + e.first.r().value(); }));
+
+        for (auto&& [key, value] : grid)
+            value = -value;
+        CHECK(grid[vector{3_q, -4_r}] == -296);
+    }
+
+    SECTION("erase")
+    {
+        int_grid grid;
+        for (int q = -10; q <= 10; ++q)
+        {
+            for (int r = -10; r <= 10; ++r)
+                grid[vector{q_coordinate{q}, r_coordinate{r}}] = q + r;
+        }
+        auto const capacity = grid.capacity();
+
+        CHECK(grid.erase(vector{50_q, 50_r}) == 0);
+        for (int q = -10; q <= 10; q += 2)
+        {
+            for (int r = -10; r <= 10; ++r)
+                CHECK(grid.erase(vector{q_coordinate{q}, r_coordinate{r}}) == 1);
+        }
+        CHECK(grid.size() == 10 * 21);
+        CHECK(grid.capacity() == capacity);
+        CHECK(static_cast<std::size_t>(std::ranges::distance(grid)) == grid.size());
+        for (int q = -10; q <= 10; ++q)
+        {
+            for (int r = -10; r <= 10; ++r)
+                CHECK(grid.contains(vector{q_coordinate{q}, r_coordinate{r}}) == (q % 2 != 0));
+        }
+    }
+
+    SECTION("reserve and clear")
+    {
+        CHECK(int_grid(0).capacity() == 0);
+        STATIC_CHECK(noexcept(std::declval<int_grid&>().clear()));
+        STATIC_CHECK_FALSE(noexcept(std::declval<sparse_grid<std::vector<int>>&>().clear()));
+
+        int_grid grid;
+        grid.reserve(0);
+        CHECK(grid.capacity() == 0);
+        grid.reserve(1000);
+        CHECK(grid.capacity() >= 1000);
+        auto const capacity = grid.capacity();
+        for (int q = 0; q < 1000; ++q)
+            grid[vector{q_coordinate{q}, 0_r}] = q;
+        CHECK(grid.capacity() == capacity);
+
+        grid.clear();
+        CHECK(grid.empty());
+        CHECK(grid.capacity() == capacity);
+        CHECK(grid.begin() == grid.end());
+    }
+
+    SECTION("equality")
+    {
+        int_grid lhs{{vector{0_q, 0_r}, 1}, {vector{1_q, 0_r}, 2}};
+        int_grid rhs{{vector{1_q, 0_r}, 2}, {vector{0_q, 0_r}, 1}};
+        CHECK(lhs == rhs);
+        rhs[vector{1_q, 0_r}] = 3;
+        CHECK(lhs != rhs);
+        rhs.erase(vector{1_q, 0_r});
+        CHECK(lhs != rhs);
+    }
+
+    SECTION("swap")
+    {
+        int_grid lhs{{vector{0_q, 0_r}, 1}};
+        int_grid rhs;
+        swap(lhs, rhs);
+        CHECK(lhs.empty());
+        CHECK(rhs.size() == 1);
+    }
+
+    SECTION("move leaves the source empty")
+    {
+        int_grid source{{vector{0_q, 0_r}, 1}, {vector{2_q, -1_r}, 2}};
+        int_grid constructed(std::move(source));
+        CHECK(constructed.size() == 2);
+        CHECK(source.empty()); // NOLINT(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+        CHECK_FALSE(source.contains(vector{0_q, 0_r}));
+        CHECK(source.find(vector{2_q, -1_r}) == source.end());
+        CHECK(source.begin() == source.end());
+
+        int_grid assigned;
+        assigned = std::move(constructed);
+        CHECK(assigned[vector{2_q, -1_r}] == 2);
+        CHECK(constructed.empty()); // NOLINT(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+        CHECK_FALSE(constructed.contains(vector{0_q, 0_r}));
+
+        constructed[vector{1_q, 1_r}] = 3;
+        CHECK(constructed.size() == 1);
+    }
+
+    SECTION("extreme coordinates")
+    {
+        sparse_grid<int, std::int16_t> grid;
+        auto const                     max = q_coordinate<std::int16_t>::max_value;
+        grid[vector{q_coordinate<std::int16_t>(max), r_coordinate<std::int16_t>(-max)}] = 1;
+        grid[vector{q_coordinate<std::int16_t>(-max), r_coordinate<std::int16_t>(max)}] = 2;
+        CHECK(grid.size() == 2);
+        CHECK((*grid.find(vector{q_coordinate<std::int16_t>(max), r_coordinate<std::int16_t>(-max)})).second == 1);
+        CHECK((*grid.find(vector{q_coordinate<std::int16_t>(-max), r_coordinate<std::int16_t>(max)})).second == 2);
+    }
+}
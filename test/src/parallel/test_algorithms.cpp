@@ -0,0 +1,108 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/parallel/algorithms.hpp"
+#include "hex/parallel/thread_pool.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/offset_rows/offset_rows_parameters.hpp"
+#include "hex/views/offset_rows/offset_rows_view.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+using namespace hex::literals;
+
+TEST_CASE("parallel algorithms")
+{
+    using convex_grid      = grid<std::int64_t, convex_polygon_view<int>>;
+    using rectangular_grid = grid<std::int64_t, offset_rows_view<int>>;
+
+    parallel::thread_pool   pool(4);
+    parallel::options const opts{.block_size = 17, .pool = &pool};
+
+    convex_grid      hexagonal(views::convex_polygon(make_regular_hexagon_parameters(20)));
+    rectangular_grid rectangular(views::offset_rows(offset_rows_parameters<int>(30, 20)));
+
+    auto const key_value = [](auto const& key) { return std::int64_t{key.q().value()} * 1000 + key.r().value(); };
+
+    SECTION("for_each")
+    {
+        parallel::for_each(hexagonal, [&](auto const& key, std::int64_t& value) { value = key_value(key); }, opts);
+        CHECK(std::ranges::all_of(hexagonal, [&](auto&& e) { return e.second == key_value(e.first); }));
+
+        parallel::for_each(rectangular, [&](auto const& key, std::int64_t& value) { value = key_value(key); });
+        CHECK(std::ranges::all_of(rectangular, [&](auto&& e) { return e.second == key_value(e.first); }));
+
+        std::atomic<std::size_t> visited = 0;
+        parallel::for_each(std::as_const(hexagonal), [&](auto const&, std::int64_t const&) { ++visited; }, opts);
+        CHECK(visited == hexagonal.size());
+    }
+
+    SECTION("transform")
+    {
+        parallel::for_each(hexagonal, [&](auto const& key, std::int64_t& value) { value = key_value(key); }, opts);
+
+        grid<std::string, convex_polygon_view<int>> strings(hexagonal.shape());
+        parallel::transform(
+            hexagonal, strings, [](auto const&, std::int64_t value) { return std::to_string(value); }, opts);
+        CHECK(std::ranges::all_of(strings, [&](auto&& e) { return e.second == std::to_string(key_value(e.first)); }));
+    }
+
+    SECTION("reduce")
+    {
+        parallel::for_each(rectangular, [](auto const&, std::int64_t& value) { value = 1; }, opts);
+        CHECK(parallel::reduce(rectangular, std::int64_t{5}, std::plus<>{}, opts) == 5 + 600);
+        CHECK(parallel::reduce(rectangular, std::int64_t{0}) == 600);
+
+        auto const sum_q = parallel::transform_reduce(
+            hexagonal, std::int64_t{0}, std::plus<>{}, [](auto const& key, auto) { return key.q().value(); }, opts);
+        CHECK(sum_q == 0);
+
+        auto const max_r = parallel::transform_reduce(
+            hexagonal,
+            std::int64_t{-1000},
+            [](std::int64_t a, std::int64_t b) { return std::max(a, b); },
+            [](auto const& key, auto) { return key.r().value(); },
+            opts);
+        CHECK(max_r == 20);
+    }
+
+    SECTION("single element")
+    {
+        convex_grid single(views::convex_polygon(make_regular_hexagon_parameters(0)));
+        parallel::for_each(single, [](auto const&, std::int64_t& value) { value = 4; }, opts);
+        CHECK(parallel::reduce(single, std::int64_t{3}, std::plus<>{}, opts) == 7);
+    }
+}
@@ -0,0 +1,109 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/parallel/thread_pool.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+
+using namespace hex;
+
+TEST_CASE("thread_pool")
+{
+    parallel::thread_pool pool(4);
+
+    SECTION("thread_count")
+    {
+        CHECK(pool.thread_count() == 4);
+        CHECK(parallel::thread_pool(1).thread_count() == 1);
+        CHECK(parallel::thread_pool::default_pool().thread_count() >= 1);
+    }
+
+    SECTION("covers every index exactly once")
+    {
+        for (std::size_t const count : {0UZ, 1UZ, 7UZ, 64UZ, 1000UZ})
+        {
+            for (std::size_t const block_size : {1UZ, 3UZ, 64UZ, 5000UZ})
+            {
+                std::vector<std::atomic<int>> visits(count);
+                std::atomic<bool>             oversized = false;
+                pool.run_blocks(count,
+                                block_size,
+                                [&](std::size_t first, std::size_t last)
+                                {
+                                    oversized = oversized || last - first > block_size;
+                                    for (auto i = first; i < last; ++i)
+                                        ++visits[i];
+                                });
+                CHECK_FALSE(oversized);
+                CHECK(std::ranges::all_of(visits, [](auto const& v) { return v == 1; }));
+            }
+        }
+    }
+
+    SECTION("runs on several threads")
+    {
+        std::vector<std::thread::id> ids(256);
+        pool.run_blocks(ids.size(),
+                        1,
+                        [&](std::size_t first, std::size_t)
+                        {
+                            ids[first] = std::this_thread::get_id();
+                            std::this_thread::yield();
+                        });
+        CHECK(std::ranges::all_of(ids, [](auto id) { return id != std::thread::id{}; }));
+    }
+
+    SECTION("nested loops run inline")
+    {
+        std::atomic<std::size_t> sum = 0;
+        pool.run_blocks(8,
+                        1,
+                        [&](std::size_t, std::size_t)
+                        { pool.run_blocks(8, 1, [&](std::size_t first, std::size_t) { sum += first; }); });
+        CHECK(sum == 8 * 28);
+    }
+
+    SECTION("exceptions are rethrown")
+    {
+        CHECK_THROWS_AS(pool.run_blocks(100,
+                                        1,
+                                        [](std::size_t first, std::size_t)
+                                        {
+                                            if (first == 42)
+                                                throw std::runtime_error("block");
+                                        }),
+                        std::runtime_error);
+
+        std::atomic<int> calls = 0;
+        pool.run_blocks(10, 1, [&](std::size_t, std::size_t) { ++calls; });
+        CHECK(calls == 10);
+    }
+}
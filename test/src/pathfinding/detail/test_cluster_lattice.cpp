@@ -0,0 +1,79 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/pathfinding/detail/detail_cluster_lattice.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+
+using namespace hex;
+using namespace hex::detail;
+
+TEST_CASE("cluster_lattice")
+{
+    SECTION("every position is in exactly one hexagon")
+    {
+        for (int radius = 0; radius <= 4; ++radius)
+        {
+            cluster_lattice<int> const lattice(radius);
+            for (int q = -12; q <= 12; ++q)
+            {
+                for (int r = -12; r <= 12; ++r)
+                {
+                    auto const position = vector{q_coordinate<int>(q), r_coordinate<int>(r)};
+                    std::size_t containing = 0;
+                    for (int a = -13; a <= 13; ++a)
+                    {
+                        for (int b = -13; b <= 13; ++b)
+                        {
+                            if (distance(lattice.center({a, b}), position) <= radius)
+                                ++containing;
+                        }
+                    }
+                    INFO("radius " << radius << " at " << q << ", " << r);
+                    REQUIRE(containing == 1);
+                    CHECK(distance(lattice.center(lattice.cell_of(position)), position) <= radius);
+                }
+            }
+        }
+    }
+
+    SECTION("the hexagons in the directions are the neighbors")
+    {
+        for (int radius = 0; radius <= 4; ++radius)
+        {
+            cluster_lattice<int> const lattice(radius);
+            auto const                 origin = lattice.center({2, -3});
+            for (std::size_t d = 0; d < 6; ++d)
+            {
+                auto const& direction = cluster_lattice<int>::directions[d];
+                auto const& opposite  = cluster_lattice<int>::directions[(d + 3) % 6];
+                CHECK(direction.a == -opposite.a);
+                CHECK(direction.b == -opposite.b);
+                CHECK(distance(lattice.center({2 + direction.a, -3 + direction.b}), origin) == (2 * radius) + 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,77 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/pathfinding/detail/detail_generation_stamps.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex::detail;
+
+TEST_CASE("generation_stamps", "[detail]")
+{
+    generation_stamps<std::uint8_t> stamps;
+    stamps.resize(4);
+    REQUIRE(stamps.size() == 4);
+
+    auto const none_marked = [&]
+    {
+        for (std::size_t index = 0; index < stamps.size(); ++index)
+        {
+            if (stamps.marked(index))
+                return false;
+        }
+        return true;
+    };
+    CHECK(none_marked());
+
+    SECTION("mark")
+    {
+        stamps.mark(2);
+        CHECK(stamps.marked(2));
+        CHECK_FALSE(stamps.marked(1));
+        stamps.next_generation();
+        CHECK_FALSE(stamps.marked(2));
+    }
+
+    SECTION("wrap-around")
+    {
+        // Several times around the 8-bit generation, marking a different index in every generation.
+        for (std::size_t generation = 0; generation < 3 * 256; ++generation) // NOLINT(*-magic-numbers)
+        {
+            stamps.mark(generation % stamps.size());
+            REQUIRE(stamps.marked(generation % stamps.size()));
+            stamps.next_generation();
+            REQUIRE(none_marked());
+        }
+    }
+
+    SECTION("resize unmarks all indices")
+    {
+        stamps.mark(0);
+        stamps.resize(2);
+        CHECK(none_marked());
+    }
+}
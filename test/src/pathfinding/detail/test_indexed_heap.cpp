@@ -0,0 +1,98 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/pathfinding/detail/detail_indexed_heap.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex::detail;
+
+TEST_CASE("indexed_heap", "[detail]")
+{
+    indexed_heap<int, std::uint16_t> heap;
+    heap.resize(64); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    CHECK(heap.capacity() == 64);
+    CHECK(heap.empty());
+
+    std::vector<int> priorities(heap.capacity());
+    for (std::size_t i = 0; i < priorities.size(); ++i)
+    {
+        priorities[i] = static_cast<int>((i * 37) % 64); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        heap.push_or_update(static_cast<std::uint16_t>(i), priorities[i]);
+    }
+    CHECK(heap.size() == 64);
+
+    SECTION("pops in priority order")
+    {
+        std::vector<int> popped;
+        while (!heap.empty())
+        {
+            auto const e = heap.pop();
+            CHECK(priorities[e.index] == e.priority);
+            CHECK_FALSE(heap.contains(e.index));
+            popped.push_back(e.priority);
+        }
+        CHECK(std::ranges::is_sorted(popped));
+    }
+
+    SECTION("updates and erases")
+    {
+        for (std::uint16_t i = 0; i < 64; i += 3)
+        {
+            priorities[i] = 100 - priorities[i]; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            heap.push_or_update(i, priorities[i]);
+        }
+        for (std::uint16_t i = 1; i < 64; i += 5)
+        {
+            heap.erase(i);
+            heap.erase(i);
+            priorities[i] = -1;
+        }
+        CHECK(heap.top().priority == 3);
+
+        std::vector<int> popped;
+        while (!heap.empty())
+        {
+            auto const e = heap.pop();
+            CHECK(priorities[e.index] == e.priority);
+            popped.push_back(e.priority);
+        }
+        CHECK(std::ranges::is_sorted(popped));
+        CHECK(std::ranges::count(priorities, -1) + popped.size() == 64);
+    }
+
+    SECTION("clear")
+    {
+        heap.clear();
+        CHECK(heap.empty());
+        CHECK_FALSE(heap.contains(5));
+        heap.push_or_update(5, 3);
+        CHECK(heap.pop().index == 5);
+    }
+}
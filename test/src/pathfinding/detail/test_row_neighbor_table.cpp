@@ -0,0 +1,103 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/pathfinding/detail/detail_row_neighbor_table.hpp"
+#include "hex/vector/coordinate_axis.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/offset_rows/offset_parity.hpp"
+#include "hex/views/offset_rows/offset_rows_parameters.hpp"
+#include "hex/views/offset_rows/offset_rows_view.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+using namespace hex::detail;
+using namespace hex::literals;
+
+namespace
+{
+// Returns true if table resolves the same neighbors as a neighbor_table, for every position of shape.
+template<typename Shape>
+auto matches_neighbor_table(Shape const& shape) -> bool
+{
+    row_neighbor_table const table(shape);
+    neighbor_table<> const   expected(shape);
+    for (std::size_t index = 0; index < expected.size(); ++index)
+    {
+        auto actual = expected[index];
+        std::ranges::fill(actual, neighbor_table<>::no_neighbor);
+        std::ptrdiff_t count = 0;
+        table.for_each_neighbor({static_cast<std::uint32_t>(index), table.row_of(index)},
+                                [&](row_position const& next)
+                                {
+                                    if (next.row != table.row_of(next.index))
+                                        return;
+                                    auto const d = std::ranges::find(expected[index], next.index);
+                                    if (d != expected[index].end())
+                                        actual[static_cast<std::size_t>(d - expected[index].begin())] = next.index;
+                                    ++count;
+                                });
+        if (actual != expected[index] || count != 6 - std::ranges::count(actual, neighbor_table<>::no_neighbor))
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("row_neighbor_table", "[detail]")
+{
+    SECTION("convex polygons")
+    {
+        CHECK(matches_neighbor_table(views::convex_polygon(make_regular_hexagon_parameters(4))));
+        auto const polygon = views::convex_polygon(convex_polygon_parameters{-2_q, -1_r, -3_s, 4_q, 2_r, 1_s});
+        CHECK(matches_neighbor_table(polygon));
+        CHECK(matches_neighbor_table(views::convex_polygon(make_regular_hexagon_parameters(0))));
+    }
+
+    SECTION("offset rows")
+    {
+        auto const axis   = GENERATE(coordinate_axis::q, coordinate_axis::r, coordinate_axis::s);
+        auto const parity = GENERATE(offset_parity::even, offset_parity::odd);
+        CHECK(matches_neighbor_table(views::offset_rows(offset_rows_parameters<int>(5, 4, axis, parity))));
+        CHECK(matches_neighbor_table(views::offset_rows(offset_rows_parameters<int>(1, 7, axis, parity))));
+        CHECK(matches_neighbor_table(views::offset_rows(offset_rows_parameters<int>(6, 1, axis, parity))));
+    }
+
+    SECTION("row_of")
+    {
+        auto const               hexagon = views::convex_polygon(make_regular_hexagon_parameters(2));
+        row_neighbor_table const table(hexagon);
+        CHECK(table.row_of(0) == 0);
+        CHECK(table.row_of(2) == 0);
+        CHECK(table.row_of(3) == 1);
+        CHECK(table.row_of(18) == 4);
+    }
+}
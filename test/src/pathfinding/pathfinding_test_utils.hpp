@@ -0,0 +1,155 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef HEX_TEST_PATHFINDING_TEST_UTILS_HPP
+#define HEX_TEST_PATHFINDING_TEST_UTILS_HPP
+
+#include "hex/grid/grid.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/neighbors/neighbors_view.hpp"
+
+#include <functional>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+// Fixtures and reference implementations shared by the pathfinding tests. Costs are stored as the cost of entering a
+// position, with 0 for impassable positions.
+namespace hex::test
+{
+// The distance of positions that cannot be reached in reference_field().
+inline constexpr auto unreachable = std::numeric_limits<std::uint32_t>::max();
+
+// Returns a grid over shape with pseudo-random costs in [0, modulus).
+template<typename Shape>
+auto make_costs(Shape const& shape, std::size_t modulus) -> grid<std::uint8_t, Shape>
+{
+    grid<std::uint8_t, Shape> costs(shape);
+    std::size_t               i = 0;
+    for (auto& cost : costs | std::views::values)
+        cost = static_cast<std::uint8_t>((i++ * 7919) % modulus); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    return costs;
+}
+
+// The grid of costs most pathfinding tests run on.
+using cost_grid = grid<std::uint8_t, convex_polygon_view<int>>;
+
+// Returns a regular hexagon of the given radius and center with pseudo-random costs in [0, 5).
+inline auto make_terrain(int radius, vector<int> const& center = {}) -> cost_grid
+{
+    return make_costs(views::convex_polygon(make_regular_hexagon_parameters(radius, center)), 5); // NOLINT(*-numbers)
+}
+
+// Returns the cost of entering a position with the given cost, the cost function passed to the pathfinders.
+inline auto entering(std::uint8_t cost) -> std::optional<std::uint32_t>
+{
+    if (cost == 0)
+        return std::nullopt;
+    return cost;
+}
+
+// Reference implementation with Dijkstra's algorithm. Returns the cost of the cheapest path from any of the sources to
+// every position of the shape, in the order of the grid's data, or unreachable.
+template<typename Shape>
+auto reference_field(grid<std::uint8_t, Shape> const& costs, std::vector<vector<int>> const& sources)
+    -> std::vector<std::uint32_t>
+{
+    auto const&                shape = costs.shape();
+    std::vector<std::uint32_t> field(costs.size(), unreachable);
+    using entry = std::pair<std::uint32_t, vector<int>>;
+    std::priority_queue<entry, std::vector<entry>, std::greater<>> open;
+    for (auto const& source : sources)
+    {
+        if (costs.contains(source))
+        {
+            field[shape[source]] = 0;
+            open.emplace(0, source);
+        }
+    }
+    while (!open.empty())
+    {
+        auto const [cost, position] = open.top();
+        open.pop();
+        if (cost != field[shape[position]])
+            continue;
+        for (auto const& next : views::neighbors(position))
+        {
+            if (!costs.contains(next) || costs[next] == 0 || cost + costs[next] >= field[shape[next]])
+                continue;
+            field[shape[next]] = cost + costs[next];
+            open.emplace(field[shape[next]], next);
+        }
+    }
+    return field;
+}
+
+// Returns the cost of the cheapest path from from to to, or std::nullopt if there is none.
+template<typename Shape>
+auto cheapest_cost(grid<std::uint8_t, Shape> const& costs, vector<int> const& from, vector<int> const& to)
+    -> std::optional<std::uint32_t>
+{
+    if (!costs.contains(to))
+        return std::nullopt;
+    auto const cost = reference_field(costs, {from})[costs.shape()[to]];
+    if (cost == unreachable)
+        return std::nullopt;
+    return cost;
+}
+
+// Returns the cost of path if it is a walk between neighboring passable positions from from to to, otherwise
+// std::nullopt.
+template<typename Shape>
+auto path_cost(grid<std::uint8_t, Shape> const& costs,
+               std::vector<vector<int>> const&  path,
+               vector<int> const&               from,
+               vector<int> const&               to) -> std::optional<std::uint32_t>
+{
+    if (path.empty() || path.front() != from || path.back() != to)
+        return std::nullopt;
+    std::uint32_t total = 0;
+    for (std::size_t i = 1; i < path.size(); ++i)
+    {
+        if (distance(path[i - 1], path[i]) != 1 || !costs.contains(path[i]) || costs[path[i]] == 0)
+            return std::nullopt;
+        total += costs[path[i]];
+    }
+    return total;
+}
+
+// Returns the values of g in the order of its data.
+template<typename Grid>
+auto values_of(Grid const& g) -> std::vector<typename Grid::mapped_type>
+{
+    return {g.data(), g.data() + g.size()};
+}
+} // namespace hex::test
+
+#endif // HEX_TEST_PATHFINDING_TEST_UTILS_HPP
@@ -0,0 +1,111 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/pathfinding/distance_field.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/offset_rows/offset_rows_parameters.hpp"
+#include "hex/views/offset_rows/offset_rows_view.hpp"
+#include "pathfinding_test_utils.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+using namespace hex::literals;
+using namespace hex::test;
+
+TEST_CASE("distance_field")
+{
+    auto const hexagon = views::convex_polygon(make_regular_hexagon_parameters(9));
+    auto const sources = std::vector{vector{0_q, 0_r}, vector{5_q, -9_r}, vector{20_q, 0_r}, vector{-3_q, 7_r}};
+
+    SECTION("matches Dijkstra")
+    {
+        auto const modulus = GENERATE(2UZ, 6UZ, 17UZ);
+        auto const costs   = make_costs(hexagon, modulus);
+        CHECK(values_of(distance_field(hexagon, sources, costs)) == reference_field(costs, sources));
+
+        auto const rows       = views::offset_rows(offset_rows_parameters<int>(14, 9, coordinate_axis::r));
+        auto const row_costs  = make_costs(rows, modulus);
+        auto const row_source = std::vector{vector{0_q, 0_r}, vector{3_q, 5_r}};
+        CHECK(values_of(distance_field(rows, row_source, row_costs)) == reference_field(row_costs, row_source));
+    }
+
+    SECTION("unit costs")
+    {
+        auto const field = distance_field(hexagon, sources);
+        for (auto const& [position, value] : field)
+        {
+            auto const to_source = [&](vector<int> const& source) { return distance(position, source); };
+            auto const nearest   = std::ranges::min(sources | std::views::transform(to_source));
+            CHECK(value == static_cast<std::uint32_t>(nearest));
+        }
+    }
+
+    SECTION("no sources")
+    {
+        auto const field = distance_field<std::uint16_t>(hexagon, std::vector<vector<int>>{});
+        CHECK(std::ranges::all_of(field | std::views::values,
+                                  [](auto value) { return value == std::numeric_limits<std::uint16_t>::max(); }));
+    }
+
+    SECTION("distances beyond the range of Dist are unreachable")
+    {
+        // BFS: the distance of a position is its distance from the origin.
+        auto const large = views::convex_polygon(make_regular_hexagon_parameters(260)); // NOLINT(*-magic-numbers)
+        auto const field = distance_field<std::uint8_t>(large, std::vector{vector{0_q, 0_r}});
+        CHECK(field[vector{254_q, 0_r}] == 254);
+        CHECK(field[vector{255_q, 0_r}] == std::numeric_limits<std::uint8_t>::max());
+        CHECK(field[vector{260_q, 0_r}] == std::numeric_limits<std::uint8_t>::max());
+
+        // Dial's algorithm: every step costs 100.
+        auto costs = make_costs(hexagon, 1);
+        for (auto& cost : costs | std::views::values)
+            cost = 100; // NOLINT(*-magic-numbers)
+        auto const costly = distance_field<std::uint8_t>(hexagon, std::vector{vector{0_q, 0_r}}, costs);
+        CHECK(costly[vector{1_q, 0_r}] == 100);
+        CHECK(costly[vector{2_q, 0_r}] == 200);
+        CHECK(costly[vector{3_q, 0_r}] == std::numeric_limits<std::uint8_t>::max());
+    }
+
+    SECTION("costs of another shape")
+    {
+        auto const smaller = make_costs(views::convex_polygon(make_regular_hexagon_parameters(2)), 3);
+        CHECK_THROWS_AS(distance_field(hexagon, sources, smaller), std::invalid_argument);
+
+        // Same size, but shifted, so that indices refer to other positions.
+        auto const shifted = make_costs(views::convex_polygon(make_regular_hexagon_parameters(9, vector{1_q, 0_r})), 3);
+        REQUIRE(shifted.size() == hexagon.size());
+        CHECK_THROWS_AS(distance_field(hexagon, sources, shifted), std::invalid_argument);
+    }
+}
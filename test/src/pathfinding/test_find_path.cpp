@@ -0,0 +1,119 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/pathfinding/find_path.hpp"
+#include "hex/pathfinding/search_workspace.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/neighbors/neighbors_view.hpp"
+#include "pathfinding_test_utils.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+using namespace hex::literals;
+using namespace hex::test;
+
+namespace
+{
+auto make_open(cost_grid const& terrain) -> cost_grid
+{
+    cost_grid open(terrain.shape());
+    std::ranges::fill(open | std::views::values, 1);
+    return open;
+}
+} // namespace
+
+TEST_CASE("find_path")
+{
+    auto const               terrain = make_costs(views::convex_polygon(make_regular_hexagon_parameters(9)), 6);
+    search_workspace         workspace(terrain.shape());
+    std::vector<vector<int>> path;
+
+    SECTION("open terrain")
+    {
+        auto const open = make_open(terrain);
+        auto const to   = vector{4_q, -7_r};
+        CHECK(find_path(open, vector<int>{}, to, entering, workspace, path) == 7u);
+        CHECK(path.size() == 8);
+        CHECK(path_cost(open, path, vector<int>{}, to) == 7u);
+        CHECK(workspace.expanded() == 8);
+    }
+
+    SECTION("same position")
+    {
+        CHECK(find_path(terrain, vector{1_q, 1_r}, vector{1_q, 1_r}, entering, workspace, path) == 0u);
+        CHECK(path == std::vector{vector{1_q, 1_r}});
+    }
+
+    SECTION("no path")
+    {
+        auto walled = make_open(terrain);
+        for (auto const& v : views::neighbors(vector{3_q, 3_r}))
+            walled[v] = 0;
+        path.push_back(vector<int>{});
+        CHECK(find_path(walled, vector<int>{}, vector{3_q, 3_r}, entering, workspace, path) == std::nullopt);
+        CHECK(path.empty());
+        CHECK(find_path(walled, vector<int>{}, vector{10_q, 0_r}, entering, workspace, path) == std::nullopt);
+        CHECK(find_path(walled, vector<int>{}, vector{3_q, 3_r}, entering).empty());
+    }
+
+    SECTION("matches Dijkstra")
+    {
+        auto const from = GENERATE(vector{0_q, 0_r}, vector{-5_q, 9_r}, vector{7_q, -2_r});
+        for (auto const& to : terrain.shape())
+        {
+            auto const expected = cheapest_cost(terrain, from, to);
+            auto const actual   = find_path(terrain, from, to, entering, workspace, path);
+            CHECK(actual == expected);
+            if (actual)
+                CHECK(path_cost(terrain, path, from, to) == actual);
+        }
+        auto const to = vector{-7_q, 2_r};
+        CHECK(path_cost(terrain, find_path(terrain, from, to, entering), from, to)
+              == cheapest_cost(terrain, from, to));
+    }
+
+    SECTION("workspace of another shape")
+    {
+        search_workspace other(views::convex_polygon(make_regular_hexagon_parameters(2)));
+        CHECK_THROWS_AS(find_path(terrain, vector<int>{}, vector{1_q, 0_r}, entering, other, path),
+                        std::invalid_argument);
+
+        // Same size, but shifted, so that indices refer to other positions.
+        search_workspace shifted(views::convex_polygon(make_regular_hexagon_parameters(9, vector{1_q, 0_r})));
+        REQUIRE(shifted.size() == terrain.size());
+        CHECK_THROWS_AS(find_path(terrain, vector<int>{}, vector{1_q, 0_r}, entering, shifted, path),
+                        std::invalid_argument);
+    }
+}
@@ -0,0 +1,119 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/pathfinding/distance_field.hpp"
+#include "hex/pathfinding/flow_field.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/neighbors/neighbors_view.hpp"
+#include "pathfinding_test_utils.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+using namespace hex::literals;
+using namespace hex::test;
+
+TEST_CASE("flow_field")
+{
+    auto       costs   = make_costs(views::convex_polygon(make_regular_hexagon_parameters(10)), 5); // NOLINT(*-numbers)
+    auto const sources = std::vector{vector{0_q, 0_r}, vector{6_q, -9_r}};
+    using field_type   = flow_field<convex_polygon_view<int>>;
+
+    SECTION("steepest descent")
+    {
+        flow_field const field(distance_field(costs.shape(), sources, costs));
+        for (auto const& [position, distance] : field.distances())
+        {
+            auto const direction = field[position];
+            if (distance == 0 || distance == field_type::unreachable)
+            {
+                CHECK(direction == field_type::none);
+                continue;
+            }
+            REQUIRE(direction < 6);
+            auto const next = views::neighbors(position)[direction];
+            CHECK(field.distances()[next] + costs[position] == distance);
+        }
+        CHECK(field[vector{0_q, 0_r}] == field_type::none);
+    }
+
+    SECTION("update matches recomputation")
+    {
+        flow_field  field(distance_field(costs.shape(), sources, costs));
+        std::size_t seed = GENERATE(1UZ, 2UZ, 3UZ);
+        for (int round = 0; round < 1000; ++round) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        {
+            // Several changes per call, so that lowered and raised positions interact.
+            std::vector<vector<int>> changed;
+            for (int i = 0; i <= round % 6; ++i) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            {
+                seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL; // NOLINT(*-magic-numbers)
+                auto const index    = static_cast<std::ptrdiff_t>((seed >> 33U) % costs.size()); // NOLINT(*-numbers)
+                auto const position = *std::ranges::next(costs.shape().begin(), index);
+                costs[position]     = static_cast<std::uint8_t>((seed >> 20U) % 6); // NOLINT(*-magic-numbers)
+                changed.push_back(position);
+            }
+            changed.push_back(vector{40_q, 0_r});
+
+            field.update(costs, changed);
+            flow_field const expected(distance_field(costs.shape(), sources, costs));
+            REQUIRE(values_of(field.distances()) == values_of(expected.distances()));
+            REQUIRE(values_of(field.directions()) == values_of(expected.directions()));
+        }
+    }
+
+    SECTION("update is local")
+    {
+        flow_field field(distance_field(costs.shape(), sources, costs));
+        auto const far = vector{-10_q, 5_r};
+        costs[far]     = 0;
+        CHECK(field.update(costs, std::vector{far}) < 10);
+        costs[far] = 1;
+        CHECK(field.update(costs, std::vector{far}) < 10);
+        CHECK(values_of(field.distances()) == values_of(distance_field(costs.shape(), sources, costs)));
+    }
+
+    SECTION("costs of another shape")
+    {
+        flow_field field(distance_field(costs.shape(), sources, costs));
+        CHECK_THROWS_AS(field.update(cost_grid(views::convex_polygon(make_regular_hexagon_parameters(2))),
+                                     std::vector<vector<int>>{}),
+                        std::invalid_argument);
+
+        // Same size, but shifted, so that indices refer to other positions.
+        cost_grid const shifted(views::convex_polygon(make_regular_hexagon_parameters(10, vector{1_q, 0_r})));
+        REQUIRE(shifted.size() == costs.size());
+        CHECK_THROWS_AS(field.update(shifted, std::vector<vector<int>>{}), std::invalid_argument);
+    }
+}
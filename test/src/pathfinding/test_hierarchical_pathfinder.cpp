@@ -0,0 +1,186 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/pathfinding/find_path.hpp"
+#include "hex/pathfinding/hierarchical_pathfinder.hpp"
+#include "hex/pathfinding/search_workspace.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "pathfinding_test_utils.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+using namespace hex::literals;
+using namespace hex::test;
+
+namespace
+{
+// Checks that pathfinder finds a valid path between every pair of a sample of positions exactly when find_path() finds
+// one, and that it is at most half again as expensive.
+void check_against_find_path(cost_grid const& costs, hierarchical_pathfinder<convex_polygon_view<int>>& pathfinder)
+{
+    search_workspace<convex_polygon_view<int>> workspace(costs.shape());
+    std::vector<vector<int>>                   path;
+    std::vector<vector<int>>                   flat;
+    std::vector<vector<int>>                   sample;
+    std::size_t                                i = 0;
+    for (auto const& position : costs.shape())
+    {
+        if (i++ % 37 == 0) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            sample.push_back(position);
+    }
+    for (auto const& from : sample)
+    {
+        for (auto const& to : sample)
+        {
+            auto const cost     = pathfinder.find_path(costs, from, to, path);
+            auto const cheapest = hex::find_path(costs, from, to, entering, workspace, flat);
+            INFO("from " << from.q().value() << ", " << from.r().value() << " to " << to.q().value() << ", "
+                         << to.r().value());
+            REQUIRE(cost.has_value() == cheapest.has_value());
+            if (!cost)
+            {
+                CHECK(path.empty());
+                continue;
+            }
+            REQUIRE(path.front() == from);
+            REQUIRE(path.back() == to);
+            CHECK(path_cost(costs, path, from, to) == cost);
+            CHECK(*cost >= *cheapest);
+            CHECK(*cost <= (*cheapest * 3 / 2) + 4); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        }
+    }
+}
+} // namespace
+
+TEST_CASE("hierarchical_pathfinder")
+{
+    SECTION("partitions the shape into hexagons")
+    {
+        auto const                                        costs = make_terrain(14);
+        hierarchical_pathfinder<convex_polygon_view<int>> pathfinder(costs, 3);
+        CHECK(pathfinder.cluster_count() > 1);
+        for (auto const& position : costs.shape())
+        {
+            auto const cluster = pathfinder.cluster_of(position);
+            REQUIRE(cluster < pathfinder.cluster_count());
+            CHECK(pathfinder.cluster_parameters(cluster).contains(position));
+        }
+        CHECK(pathfinder.cluster_parameters(pathfinder.cluster_of({})) == make_regular_hexagon_parameters(3));
+        CHECK(pathfinder.transition_count() > 0);
+    }
+
+    SECTION("rejects invalid arguments")
+    {
+        auto const costs = make_terrain(14);
+        CHECK_THROWS_AS((hierarchical_pathfinder<convex_polygon_view<int>>(costs, 0)), std::invalid_argument);
+
+        hierarchical_pathfinder<convex_polygon_view<int>> pathfinder(costs, 3);
+        cost_grid const other(views::convex_polygon(make_regular_hexagon_parameters(2)));
+        std::vector<vector<int>>                          path;
+        CHECK_THROWS_AS(pathfinder.find_path(other, {}, {}, path), std::invalid_argument);
+        CHECK_THROWS_AS(pathfinder.update(other, std::vector<vector<int>>{}), std::invalid_argument);
+
+        // Same size, but shifted, so that indices refer to other positions.
+        auto const shifted = make_terrain(14, vector{1_q, 0_r});
+        REQUIRE(shifted.size() == costs.size());
+        CHECK_THROWS_AS(pathfinder.find_path(shifted, {}, {}, path), std::invalid_argument);
+        CHECK_THROWS_AS(pathfinder.update(shifted, std::vector<vector<int>>{}), std::invalid_argument);
+    }
+
+    SECTION("handles trivial queries")
+    {
+        auto costs = make_terrain(14);
+        hierarchical_pathfinder<convex_polygon_view<int>> pathfinder(costs, 3);
+        std::vector<vector<int>>                          path{{}, {}};
+        CHECK(pathfinder.find_path(costs, {}, {}, path) == 0U);
+        CHECK(path == std::vector<vector<int>>{{}});
+        CHECK_FALSE(pathfinder.find_path(costs, {}, vector{100_q, 0_r}, path));
+        CHECK(path.empty());
+    }
+
+    SECTION("finds paths close to the cheapest")
+    {
+        auto const costs = make_terrain(14);
+        for (int radius = 1; radius <= 5; ++radius)
+        {
+            hierarchical_pathfinder<convex_polygon_view<int>> pathfinder(costs, radius);
+            check_against_find_path(costs, pathfinder);
+        }
+    }
+
+    SECTION("expands fewer nodes than the flat search")
+    {
+        auto                                              costs = make_terrain(14);
+        hierarchical_pathfinder<convex_polygon_view<int>> pathfinder(costs, 4);
+        search_workspace<convex_polygon_view<int>>        workspace(costs.shape());
+        std::vector<vector<int>>                          path;
+        auto const from = vector{q_coordinate<int>(-12), r_coordinate<int>(0)};
+        auto const to   = vector{q_coordinate<int>(12), r_coordinate<int>(0)};
+        costs[from]     = 1;
+        costs[to]       = 1;
+        pathfinder.update(costs, std::vector{from, to});
+        REQUIRE(pathfinder.find_path(costs, from, to, path));
+        REQUIRE(hex::find_path(costs, from, to, entering, workspace, path));
+        CHECK(pathfinder.expanded() < workspace.expanded());
+    }
+
+    SECTION("updates match a rebuild")
+    {
+        auto                                              costs = make_terrain(14);
+        hierarchical_pathfinder<convex_polygon_view<int>> pathfinder(costs, 3);
+        std::vector<vector<int>>                          changed;
+        std::size_t                                       i = 0;
+        for (auto [position, cost] : costs)
+        {
+            if (i++ % 11 == 0) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            {
+                cost = static_cast<std::uint8_t>((cost + 2) % 5); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+                changed.push_back(position);
+            }
+            if (changed.size() == 20) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+                break;
+        }
+        CHECK(pathfinder.update(costs, changed) > 0);
+        check_against_find_path(costs, pathfinder);
+
+        hierarchical_pathfinder<convex_polygon_view<int>> rebuilt(costs, 3);
+        std::vector<vector<int>>                          path;
+        std::vector<vector<int>>                          expected;
+        for (auto const& to : costs.shape())
+        {
+            CHECK(pathfinder.find_path(costs, {}, to, path) == rebuilt.find_path(costs, {}, to, expected));
+            CHECK(path == expected);
+        }
+        CHECK(pathfinder.transition_count() == rebuilt.transition_count());
+    }
+}
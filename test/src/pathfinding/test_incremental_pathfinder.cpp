@@ -0,0 +1,176 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/pathfinding/find_path.hpp"
+#include "hex/pathfinding/incremental_pathfinder.hpp"
+#include "hex/pathfinding/search_workspace.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "pathfinding_test_utils.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+using namespace hex::literals;
+using namespace hex::test;
+
+namespace
+{
+auto at(int q, int r) -> vector<int>
+{
+    return vector{q_coordinate<int>(q), r_coordinate<int>(r)};
+}
+} // namespace
+
+TEST_CASE("incremental_pathfinder")
+{
+    SECTION("rejects invalid arguments")
+    {
+        using pathfinder_type = incremental_pathfinder<convex_polygon_view<int>>;
+        auto const costs      = make_terrain(10);
+        CHECK_THROWS_AS(pathfinder_type(costs, {}, at(11, 0)), std::invalid_argument);
+        CHECK_THROWS_AS(pathfinder_type(costs, at(0, 11), {}), std::invalid_argument);
+
+        pathfinder_type          pathfinder(costs, {}, at(5, 0));
+        cost_grid const          other(views::convex_polygon(make_regular_hexagon_parameters(2)));
+        std::vector<vector<int>> path;
+        CHECK_THROWS_AS(pathfinder.find_path(other, path), std::invalid_argument);
+        CHECK_THROWS_AS(pathfinder.update(other, std::vector<vector<int>>{}), std::invalid_argument);
+
+        // Same size, but shifted, so that indices refer to other positions.
+        auto const shifted = make_terrain(10, at(1, 0));
+        REQUIRE(shifted.size() == costs.size());
+        CHECK_THROWS_AS(pathfinder.find_path(shifted, path), std::invalid_argument);
+        CHECK_THROWS_AS(pathfinder.update(shifted, std::vector<vector<int>>{}), std::invalid_argument);
+    }
+
+    SECTION("finds cheapest paths")
+    {
+        auto const                                 costs = make_terrain(10);
+        search_workspace<convex_polygon_view<int>> workspace(costs.shape());
+        std::vector<vector<int>>                   path;
+        std::vector<vector<int>>                   expected;
+        for (auto const& goal : costs.shape())
+        {
+            incremental_pathfinder<convex_polygon_view<int>> pathfinder(costs, at(-7, 3), goal);
+            auto const cost     = pathfinder.find_path(costs, path);
+            auto const cheapest = hex::find_path(costs, at(-7, 3), goal, entering, workspace, expected);
+            INFO("to " << goal.q().value() << ", " << goal.r().value());
+            REQUIRE(cost == cheapest);
+            if (!cost)
+            {
+                CHECK(path.empty());
+                continue;
+            }
+            CHECK(path.front() == at(-7, 3));
+            CHECK(path.back() == goal);
+            CHECK(path_cost(costs, path, at(-7, 3), goal) == cost);
+            CHECK(pathfinder.start() == at(-7, 3));
+            CHECK(pathfinder.goal() == goal);
+        }
+    }
+
+    SECTION("finds the trivial path")
+    {
+        auto const                                       costs = make_terrain(10);
+        incremental_pathfinder<convex_polygon_view<int>> pathfinder(costs, at(1, 1), at(1, 1));
+        std::vector<vector<int>>                         path;
+        CHECK(pathfinder.find_path(costs, path) == 0U);
+        CHECK(path == std::vector{at(1, 1)});
+    }
+
+    SECTION("repairs the path while walking and changing costs")
+    {
+        auto                                             costs = make_terrain(10);
+        auto const                                       goal  = at(8, -2);
+        costs[goal]                                            = 1;
+        incremental_pathfinder<convex_polygon_view<int>> pathfinder(costs, at(-8, 2), goal);
+        search_workspace<convex_polygon_view<int>>       workspace(costs.shape());
+        std::vector<vector<int>>                         path;
+        std::vector<vector<int>>                         expected;
+        REQUIRE(pathfinder.find_path(costs, path));
+        auto const initial = pathfinder.expanded();
+
+        std::size_t tick = 0;
+        while (pathfinder.start() != goal)
+        {
+            // Block the tile ahead every other tick, and reopen tiles elsewhere.
+            ++tick;
+            std::vector<vector<int>> changed;
+            if (path.size() > 2 && tick % 2 == 0)
+            {
+                costs[path[2]] = 0;
+                changed.push_back(path[2]);
+            }
+            auto const reopened = at(static_cast<int>(tick % 7) - 3, 2 - static_cast<int>(tick % 5));
+            if (reopened != pathfinder.start() && costs[reopened] == 0)
+            {
+                costs[reopened] = 3;
+                changed.push_back(reopened);
+            }
+            pathfinder.update(costs, changed);
+
+            auto const cost     = pathfinder.find_path(costs, path);
+            auto const cheapest = hex::find_path(costs, pathfinder.start(), goal, entering, workspace, expected);
+            INFO("tick " << tick);
+            REQUIRE(cost == cheapest);
+            if (!cost)
+                break;
+            CHECK(path_cost(costs, path, pathfinder.start(), goal) == cost);
+            CHECK(pathfinder.expanded() < initial);
+            if (path.size() > 1)
+                pathfinder.move_start(path[1]);
+        }
+        CHECK(tick > 5);
+    }
+
+    SECTION("reports unreachable goals until they become reachable")
+    {
+        auto       costs = make_terrain(10);
+        auto const goal  = at(0, 0);
+        for (auto const& neighbor : std::array{at(1, 0), at(1, -1), at(0, -1), at(-1, 0), at(-1, 1), at(0, 1)})
+            costs[neighbor] = 0;
+        costs[goal] = 1;
+        incremental_pathfinder<convex_polygon_view<int>> pathfinder(costs, at(5, 5), goal);
+        std::vector<vector<int>>                         path{goal};
+        CHECK_FALSE(pathfinder.find_path(costs, path));
+        CHECK(path.empty());
+
+        costs[at(0, 1)] = 1;
+        pathfinder.update(costs, std::array{at(0, 1)});
+        auto const cost = pathfinder.find_path(costs, path);
+        REQUIRE(cost);
+        CHECK(path.back() == goal);
+        CHECK(path[path.size() - 2] == at(0, 1));
+        CHECK(path_cost(costs, path, at(5, 5), goal) == cost);
+    }
+}
@@ -0,0 +1,227 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "hex/vector/cartesian_batch.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <numbers>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+// 37 positions, so that every conversion also runs its scalar tail.
+template<typename T>
+auto make_positions() -> std::vector<vector<T>>
+{
+    std::vector<vector<T>> positions;
+    for (int i = 0; i < 37; ++i) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    {
+        auto const q = static_cast<T>(((i * 7) % 23) - 11); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        auto const r = static_cast<T>(((i * 5) % 19) - 9);  // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        positions.push_back(vector{q_coordinate<T>(q), r_coordinate<T>(r)});
+    }
+    return positions;
+}
+
+// Random points, plus points on the borders and corners between tiles.
+template<typename T>
+auto make_points() -> std::vector<std::array<T, 2>>
+{
+    std::mt19937                      gen(7);              // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    std::uniform_real_distribution<T> coordinate(-50, 50); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    std::vector<std::array<T, 2>>     points;
+    for (int i = 0; i < 997; ++i) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        points.push_back({coordinate(gen), coordinate(gen)});
+    for (auto const& position : make_positions<int>())
+    {
+        auto const [x, y] = to_cartesian<T>(position);
+        // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        points.push_back({x + T{0.75}, y});
+        points.push_back({x - T{0.75}, y});
+        points.push_back({x + T{1}, y});
+        points.push_back({x - T{0.5}, y - (std::numbers::sqrt3_v<T> / 2)});
+        // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    }
+    return points;
+}
+
+// Whether the point is within rounding error of a tile edge or corner, i.e. nudging it may change its tile.
+template<typename T>
+auto near_tile_edge(std::array<T, 2> point) -> bool
+{
+    constexpr T epsilon = 1e-9; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    auto const  tile    = pixel_to_hex(point);
+    for (auto const& [dx, dy] : std::array<std::array<T, 2>, 4>{
+             {{epsilon, 0}, {-epsilon, 0}, {0, epsilon}, {0, -epsilon}}
+    })
+    {
+        if (pixel_to_hex(std::array{point[0] + dx, point[1] + dy}) != tile)
+            return true;
+    }
+    return false;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("batch to_cartesian", "[cartesian_batch]", std::int32_t, std::int64_t)
+{
+    auto const positions = make_positions<TestType>();
+
+    SECTION("double")
+    {
+        std::vector<std::array<double, 2>> out(positions.size());
+        to_cartesian(std::span(positions), std::span(out));
+        for (std::size_t i = 0; i < positions.size(); ++i)
+            CHECK(out[i] == to_cartesian<double>(positions[i]));
+    }
+    SECTION("float")
+    {
+        using Catch::Matchers::WithinAbs;
+        std::vector<std::array<float, 2>> out(positions.size());
+        to_cartesian(std::span(positions), std::span(out));
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            auto const expected = to_cartesian<float>(positions[i]);
+            CHECK_THAT(out[i][0], WithinAbs(expected[0], 1e-5));
+            CHECK_THAT(out[i][1], WithinAbs(expected[1], 1e-5));
+        }
+    }
+    SECTION("size mismatch")
+    {
+        std::vector<std::array<double, 2>> out(positions.size() - 1);
+        CHECK_THROWS_AS(to_cartesian(std::span(positions), std::span(out)), std::invalid_argument);
+    }
+}
+
+TEST_CASE("batch from_cartesian", "[cartesian_batch]")
+{
+    SECTION("double")
+    {
+        using Catch::Matchers::WithinAbs;
+        auto const                  points = make_points<double>();
+        std::vector<vector<double>> out(points.size());
+        from_cartesian(std::span(points), std::span(out));
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            auto const expected = from_cartesian<double>(points[i]);
+            CHECK_THAT(out[i].q().value(), WithinAbs(expected.q().value(), 1e-12));
+            CHECK_THAT(out[i].r().value(), WithinAbs(expected.r().value(), 1e-12));
+        }
+    }
+    SECTION("float")
+    {
+        using Catch::Matchers::WithinAbs;
+        auto const                 points = make_points<float>();
+        std::vector<vector<float>> out(points.size());
+        from_cartesian(std::span(points), std::span(out));
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            auto const expected = from_cartesian<float>(points[i]);
+            CHECK_THAT(out[i].q().value(), WithinAbs(expected.q().value(), 1e-4));
+            CHECK_THAT(out[i].r().value(), WithinAbs(expected.r().value(), 1e-4));
+        }
+    }
+    SECTION("integer points")
+    {
+        std::vector<std::array<int, 2>> const points{{0, 0}, {3, 0}, {-3, 2}};
+        std::vector<vector<double>>           out(points.size());
+        from_cartesian(std::span(points), std::span(out));
+        for (std::size_t i = 0; i < points.size(); ++i)
+            CHECK(out[i] == from_cartesian<double>(points[i]));
+    }
+}
+
+TEST_CASE("pixel_to_hex", "[cartesian_batch]")
+{
+    using namespace literals;
+    STATIC_CHECK(pixel_to_hex(std::array{0., 0.}) == vector{});
+    CHECK(pixel_to_hex(std::array{1.5, std::numbers::sqrt3 / 2}) == vector{1_q, 0_r});
+
+    SECTION("tile centers")
+    {
+        for (auto const& position : make_positions<int>())
+            CHECK(pixel_to_hex(to_cartesian(position)) == position);
+    }
+    SECTION("double batch equals rounding every point away from tile edges")
+    {
+        auto const               points = make_points<double>();
+        std::vector<vector<int>> out(points.size());
+        pixel_to_hex(std::span(points), std::span(out));
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            auto const expected = round<int>(from_cartesian<double>(points[i]));
+            if (near_tile_edge(points[i]))
+                CHECK(distance(out[i], expected) <= 1);
+            else
+                CHECK(out[i] == expected);
+        }
+    }
+    SECTION("float batch finds the tile of points inside it")
+    {
+        auto const positions = make_positions<int>();
+        // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        auto const offsets = std::array<std::array<float, 2>, 4>{
+            {{0.F, 0.F}, {0.7F, 0.2F}, {-0.3F, -0.7F}, {0.6F, -0.4F}}
+        };
+        // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        std::vector<std::array<float, 2>> points;
+        std::vector<vector<int>>          expected;
+        for (auto const& position : positions)
+        {
+            for (auto const& [dx, dy] : offsets)
+            {
+                auto const [x, y] = to_cartesian<float>(position);
+                points.push_back({x + dx, y + dy});
+                expected.push_back(position);
+            }
+        }
+        std::vector<vector<int>> out(points.size());
+        pixel_to_hex(std::span<std::array<float, 2> const>(points), std::span(out));
+        CHECK(out == expected);
+    }
+    SECTION("wider results")
+    {
+        auto const                        points = make_points<double>();
+        std::vector<vector<std::int64_t>> out(points.size());
+        pixel_to_hex(std::span(points), std::span(out));
+        for (std::size_t i = 0; i < points.size(); ++i)
+            CHECK(out[i] == pixel_to_hex<std::int64_t>(points[i]));
+    }
+    SECTION("size mismatch")
+    {
+        auto const               points = make_points<double>();
+        std::vector<vector<int>> out(points.size() + 1);
+        CHECK_THROWS_AS(pixel_to_hex(std::span(points), std::span(out)), std::invalid_argument);
+    }
+}
@@ -0,0 +1,241 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "hex/vector/cartesian_batch.hpp"
+#include "hex/vector/layout.hpp"
+#include "hex/vector/layout_orientation.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+// 37 positions, so that every conversion also runs its scalar tail.
+auto make_positions() -> std::vector<vector<int>>
+{
+    std::vector<vector<int>> positions;
+    for (int i = 0; i < 37; ++i) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    {
+        auto const q = ((i * 7) % 23) - 11; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        auto const r = ((i * 5) % 19) - 9;  // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        positions.push_back(vector{q_coordinate(q), r_coordinate(r)});
+    }
+    return positions;
+}
+
+template<typename T>
+auto make_pixels() -> std::vector<std::array<T, 2>>
+{
+    std::mt19937                      gen(3);                // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    std::uniform_real_distribution<T> coordinate(-100, 100); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    std::vector<std::array<T, 2>>     pixels;
+    for (int i = 0; i < 501; ++i) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        pixels.push_back({coordinate(gen), coordinate(gen)});
+    return pixels;
+}
+
+template<typename T>
+auto make_layouts() -> std::vector<layout<T>>
+{
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    return {layout<T>(layout_orientation::flat, 1),
+            layout<T>(layout_orientation::pointy, 1),
+            layout<T>(layout_orientation::flat, {2, 3}, {10, -4}),
+            layout<T>(layout_orientation::pointy, {T{1.5}, T{-1.5}}, {-7, 5})};
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+}
+
+// Whether the pixel is within rounding error of a tile edge or corner, i.e. nudging it may change its tile.
+template<typename T>
+auto near_tile_edge(layout<T> const& layout, std::array<T, 2> pixel) -> bool
+{
+    auto const nudge = std::sqrt(std::numeric_limits<T>::epsilon());
+    auto const tile  = layout.pixel_to_hex(pixel);
+    for (auto const& [dx, dy] : std::array<std::array<T, 2>, 4>{
+             {{nudge, 0}, {-nudge, 0}, {0, nudge}, {0, -nudge}}
+    })
+    {
+        if (layout.pixel_to_hex(std::array{pixel[0] + dx, pixel[1] + dy}) != tile)
+            return true;
+    }
+    return false;
+}
+} // namespace
+
+TEST_CASE("layout", "[layout]")
+{
+    using namespace literals;
+    using Catch::Matchers::WithinAbs;
+    constexpr auto sqrt3 = std::numbers::sqrt3;
+
+    SECTION("construction")
+    {
+        constexpr auto flat = layout<double>(layout_orientation::flat, {2., 3.}, {1., -1.});
+        STATIC_CHECK(flat.orientation() == layout_orientation::flat);
+        STATIC_CHECK(flat.size() == std::array{2., 3.});
+        STATIC_CHECK(flat.origin() == std::array{1., -1.});
+        STATIC_CHECK(flat.to_pixel(vector{}) == std::array{1., -1.});
+        STATIC_CHECK(layout<double>(layout_orientation::pointy, 2.)
+                     == layout<double>(layout_orientation::pointy, {2., 2.}));
+
+        CHECK_THROWS_AS(layout<double>(layout_orientation::flat, 0.), std::invalid_argument);
+        CHECK_THROWS_AS(layout<double>(layout_orientation::pointy, {1., 0.}), std::invalid_argument);
+    }
+
+    SECTION("flat unit layout equals to_cartesian")
+    {
+        auto const flat = layout<double>(layout_orientation::flat, 1.);
+        for (auto const& position : make_positions())
+        {
+            auto const expected = to_cartesian(position);
+            CHECK_THAT(flat.to_pixel(position)[0], WithinAbs(expected[0], 1e-12));
+            CHECK_THAT(flat.to_pixel(position)[1], WithinAbs(expected[1], 1e-12));
+        }
+        for (auto const& pixel : make_pixels<double>())
+            CHECK(flat.pixel_to_hex(pixel) == pixel_to_hex(pixel));
+    }
+
+    SECTION("pointy unit layout")
+    {
+        auto const pointy = layout<double>(layout_orientation::pointy, 1.);
+        CHECK_THAT(pointy.to_pixel(vector{1_q, 0_r})[0], WithinAbs(sqrt3, 1e-12));
+        CHECK_THAT(pointy.to_pixel(vector{1_q, 0_r})[1], WithinAbs(0., 1e-12));
+        CHECK_THAT(pointy.to_pixel(vector{0_q, 1_r})[0], WithinAbs(sqrt3 / 2, 1e-12));
+        CHECK_THAT(pointy.to_pixel(vector{0_q, 1_r})[1], WithinAbs(1.5, 1e-12));
+    }
+
+    SECTION("round trip")
+    {
+        for (auto const& layout : make_layouts<double>())
+        {
+            for (auto const& position : make_positions())
+            {
+                auto const fraction = layout.from_pixel(layout.to_pixel(position));
+                CHECK_THAT(fraction.q().value(), WithinAbs(position.q().value(), 1e-9));
+                CHECK_THAT(fraction.r().value(), WithinAbs(position.r().value(), 1e-9));
+                CHECK(layout.pixel_to_hex(layout.to_pixel(position)) == position);
+            }
+        }
+    }
+
+    SECTION("corners")
+    {
+        for (auto const& layout : make_layouts<double>())
+        {
+            for (auto const& position : make_positions())
+            {
+                auto const center  = layout.to_pixel(position);
+                auto const corners = layout.corners(position);
+                for (auto const& corner : corners)
+                {
+                    // Points just inside a corner belong to the tile, and the corner lies on the tile's outline.
+                    auto const inside = std::array{center[0] + (0.99 * (corner[0] - center[0])),
+                                                   center[1] + (0.99 * (corner[1] - center[1]))};
+                    CHECK(layout.pixel_to_hex(inside) == position);
+                    auto const fraction = layout.from_pixel(corner) - vector<double>(position);
+                    CHECK_THAT(fraction.norm(), WithinAbs(2. / 3., 1e-9));
+                }
+                // Corners shared with the +q neighbor.
+                auto const neighbor = layout.corners(position + vector{1_q, 0_r});
+                auto const shared   = [&](std::array<double, 2> const& corner)
+                {
+                    return std::ranges::any_of(neighbor,
+                                               [&](auto const& other)
+                                               {
+                                                   return std::abs(other[0] - corner[0]) < 1e-9
+                                                       && std::abs(other[1] - corner[1]) < 1e-9;
+                                               });
+                };
+                CHECK(std::ranges::count_if(corners, shared) == 2);
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("layout batch conversions", "[layout]", float, double)
+{
+    using T = TestType;
+    using Catch::Matchers::WithinAbs;
+    auto const positions = make_positions();
+    auto const pixels    = make_pixels<T>();
+    auto const tolerance = 1000 * std::numeric_limits<T>::epsilon(); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+    for (auto const& layout : make_layouts<T>())
+    {
+        std::vector<std::array<T, 2>> centers(positions.size());
+        layout.to_pixel(std::span(positions), std::span(centers));
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            auto const expected = layout.to_pixel(positions[i]);
+            CHECK_THAT(centers[i][0], WithinAbs(expected[0], tolerance));
+            CHECK_THAT(centers[i][1], WithinAbs(expected[1], tolerance));
+        }
+
+        std::vector<vector<T>> fractions(pixels.size());
+        layout.from_pixel(std::span(pixels), std::span(fractions));
+        for (std::size_t i = 0; i < pixels.size(); ++i)
+        {
+            auto const expected = layout.from_pixel(pixels[i]);
+            CHECK_THAT(fractions[i].q().value(), WithinAbs(expected.q().value(), tolerance));
+            CHECK_THAT(fractions[i].r().value(), WithinAbs(expected.r().value(), tolerance));
+        }
+
+        std::vector<vector<int>> tiles(pixels.size());
+        layout.pixel_to_hex(std::span(pixels), std::span(tiles));
+        std::vector<vector<std::int64_t>> wide_tiles(pixels.size());
+        layout.pixel_to_hex(std::span(pixels), std::span(wide_tiles));
+        for (std::size_t i = 0; i < pixels.size(); ++i)
+        {
+            auto const expected = layout.pixel_to_hex(pixels[i]);
+            if (near_tile_edge(layout, pixels[i]))
+            {
+                CHECK(distance(tiles[i], expected) <= 1);
+                CHECK(distance(wide_tiles[i], expected) <= 1);
+            }
+            else
+            {
+                CHECK(tiles[i] == expected);
+                CHECK(wide_tiles[i] == vector<std::int64_t>(expected));
+            }
+        }
+
+        std::vector<vector<int>> too_short(pixels.size() - 1);
+        CHECK_THROWS_AS(layout.pixel_to_hex(std::span(pixels), std::span(too_short)), std::invalid_argument);
+    }
+}
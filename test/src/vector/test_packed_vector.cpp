@@ -0,0 +1,132 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "hex/vector/packed_vector.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+#include <cstdint>
+
+using namespace hex;
+
+TEMPLATE_TEST_CASE("packed_vector", "[packed_vector]", std::uint32_t, std::uint64_t)
+{
+    using namespace literals;
+    using packed          = packed_vector<TestType>;
+    using coordinate_type = packed::coordinate_type;
+    using wide            = std::int64_t;
+
+    SECTION("construction")
+    {
+        STATIC_CHECK(packed{} == packed{vector{}});
+        STATIC_CHECK(packed{}.q() == 0);
+        STATIC_CHECK(packed{}.r() == 0);
+        STATIC_CHECK(packed{vector{3_q, -7_r}}.q() == 3);
+        STATIC_CHECK(packed{vector{3_q, -7_r}}.r() == -7);
+        STATIC_CHECK(packed::from_word(packed{vector{3_q, -7_r}}.word()) == packed{vector{3_q, -7_r}});
+        STATIC_CHECK(vector<int>(packed{vector{3_q, -7_r}}) == vector{3_q, -7_r});
+    }
+
+    SECTION("round trip at the range limits")
+    {
+        for (wide const q : {wide{packed::min_value}, wide{-1}, wide{0}, wide{1}, wide{packed::max_value}})
+        {
+            for (wide const r : {wide{packed::min_value}, wide{-1}, wide{0}, wide{1}, wide{packed::max_value}})
+            {
+                auto const vec = vector{q_coordinate(q), r_coordinate(r)};
+                if (-q - r < packed::min_value || -q - r > packed::max_value)
+                {
+                    CHECK_THROWS_AS(packed(vec), std::invalid_argument);
+                    continue;
+                }
+                auto const packed_vec = packed(vec);
+                CHECK(packed_vec.q() == q);
+                CHECK(packed_vec.r() == r);
+                CHECK(vector<wide>(packed_vec) == vec);
+
+                auto const narrow = vector<coordinate_type>(packed_vec);
+                CHECK(narrow.q().value() == q);
+                CHECK(narrow.r().value() == r);
+                CHECK(narrow.s().value() >= packed::min_value);
+                CHECK(narrow.s().value() <= packed::max_value);
+                CHECK(narrow.s().value() == -q - r);
+            }
+        }
+        auto const small = vector{q_coordinate<std::int8_t>(-63), r_coordinate<std::int8_t>(63)};
+        CHECK(vector<std::int8_t>(packed(small)) == small);
+    }
+
+    SECTION("out of range")
+    {
+        auto const limit = wide{packed::max_value} + 1;
+        CHECK_THROWS_AS(packed(vector{q_coordinate(limit), r_coordinate(wide{0})}), std::invalid_argument);
+        CHECK_THROWS_AS(packed(vector{q_coordinate(wide{0}), r_coordinate(-limit - 1)}), std::invalid_argument);
+        auto const corner = wide{packed::max_value};
+        CHECK_THROWS_AS(packed(vector{q_coordinate(corner), r_coordinate(corner)}), std::invalid_argument);
+        CHECK_THROWS_AS(packed(vector{q_coordinate(-corner), r_coordinate(-corner)}), std::invalid_argument);
+        CHECK_THROWS_AS(packed(vector{q_coordinate(wide{1}), r_coordinate(corner)}), std::invalid_argument);
+        STATIC_CHECK(packed::max_value == q_coordinate<coordinate_type>::max_value);
+        STATIC_CHECK(packed::min_value == q_coordinate<coordinate_type>::min_value);
+        if constexpr (std::same_as<TestType, std::uint32_t>)
+            CHECK_THROWS_AS(packed(vector{20000_q, 20000_r}), std::invalid_argument); // NOLINT(*-magic-numbers)
+    }
+
+    SECTION("ordering equals vector ordering")
+    {
+        std::vector<vector<int>> vectors;
+        for (int q = -3; q <= 3; ++q)
+            for (int r = -3; r <= 3; ++r)
+                vectors.push_back(vector{q_coordinate(q * 1000), r_coordinate(r * 997)}); // NOLINT(*-magic-numbers)
+        for (auto const& a : vectors)
+        {
+            for (auto const& b : vectors)
+            {
+                CHECK((packed(a) <=> packed(b)) == (a <=> b));
+                CHECK((packed(a).word() < packed(b).word()) == (a < b));
+            }
+        }
+    }
+
+    SECTION("hash")
+    {
+        constexpr std::hash<packed> hasher;
+        STATIC_CHECK(hasher(packed{vector{1_q, 2_r}}) != hasher(packed{vector{2_q, 1_r}}));
+
+        std::unordered_set<packed> set;
+        for (coordinate_type q = -10; q <= 10; ++q)
+            for (coordinate_type r = -10; r <= 10; ++r)
+                set.insert(packed{vector{q_coordinate(q), r_coordinate(r)}});
+        CHECK(set.size() == 21 * 21);
+        CHECK(set.contains(packed{vector{-10_q, 10_r}}));
+        CHECK_FALSE(set.contains(packed{vector{11_q, 0_r}}));
+    }
+}
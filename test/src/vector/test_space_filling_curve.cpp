@@ -0,0 +1,93 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "hex/vector/space_filling_curve.hpp"
+#include "hex/vector/vector.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+
+using namespace hex;
+using namespace hex::literals;
+
+TEST_CASE("morton", "[space_filling_curve]")
+{
+    constexpr std::uint64_t origin = 0xC000000000000000ULL; // Both coordinates offset by 2^31.
+    STATIC_CHECK(morton_encode(vector{}) == origin);
+    STATIC_CHECK(morton_encode(vector{1_q, 0_r}) == (origin | 1U));
+    STATIC_CHECK(morton_encode(vector{0_q, 1_r}) == (origin | 2U));
+    STATIC_CHECK(morton_encode(vector{1_q, 1_r}) == (origin | 3U));
+    STATIC_CHECK(morton_encode(vector{2_q, 0_r}) == (origin | 4U));
+    STATIC_CHECK(morton_decode(origin | 3U) == vector{1_q, 1_r});
+    STATIC_CHECK(morton_encode(vector{-1_q, 0_r}) < morton_encode(vector{0_q, 0_r}));
+
+    for (int q = -20; q <= 20; ++q)
+    {
+        for (int r = -20; r <= 20; ++r)
+        {
+            auto const vec = vector{q_coordinate(q), r_coordinate(r)};
+            CHECK(morton_decode(morton_encode(vec)) == vec);
+        }
+    }
+    auto const extreme = vector{q_coordinate<std::int32_t>(INT32_MIN), r_coordinate<std::int32_t>(INT32_MAX)};
+    CHECK(morton_decode<std::int32_t>(morton_encode(extreme)) == extreme);
+    auto const narrow = vector{q_coordinate<std::int16_t>(-5), r_coordinate<std::int16_t>(7)};
+    CHECK(morton_decode<std::int16_t>(morton_encode(narrow)) == narrow);
+}
+
+TEST_CASE("hilbert", "[space_filling_curve]")
+{
+    STATIC_CHECK(hilbert_decode(hilbert_encode(vector{3_q, -7_r})) == vector{3_q, -7_r});
+
+    for (int q = -20; q <= 20; ++q)
+    {
+        for (int r = -20; r <= 20; ++r)
+        {
+            auto const vec  = vector{q_coordinate(q), r_coordinate(r)};
+            auto const code = hilbert_encode(vec);
+            CHECK(hilbert_decode(code) == vec);
+
+            // The next position on the curve differs by 1 in exactly one of q and r.
+            auto const next = hilbert_decode(code + 1);
+            CHECK(std::abs(next.q().value() - q) + std::abs(next.r().value() - r) == 1);
+        }
+    }
+
+    SECTION("small squares")
+    {
+        for (unsigned order = 1; order <= 5; ++order)
+        {
+            auto const side = std::uint32_t{1} << order;
+            for (std::uint64_t index = 0; index < std::uint64_t{side} * side; ++index)
+            {
+                auto const [x, y] = detail::hilbert_point(index, order);
+                CHECK(x < side);
+                CHECK(y < side);
+                CHECK(detail::hilbert_index(x, y, order) == index);
+            }
+        }
+    }
+}
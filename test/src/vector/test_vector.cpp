@@ -26,8 +26,10 @@
 #include <catch2/catch_all.hpp>
 
 #include <array>
+#include <functional>
 #include <numbers>
 #include <ranges>
+#include <unordered_set>
 
 using namespace hex;
 
@@ -305,6 +307,26 @@ TEST_CASE("vector")
         CHECK_THAT(from_cartesian(std::array{0., std::numbers::sqrt3}).r().value(), WithinRel(1.));
     }
 
+    SECTION("hash")
+    {
+        constexpr std::hash<vector<int>> hasher;
+        STATIC_CHECK(hasher(vector{1_q, 2_r}) == hasher(vector{1_q, 2_r}));
+        STATIC_CHECK(hasher(vector{1_q, 2_r}) != hasher(vector{2_q, 1_r}));
+        STATIC_CHECK(hasher(vector{0_q, -1_r}) != hasher(vector{-1_q, 0_r}));
+
+        std::unordered_set<vector<int>> set;
+        for (int q = -10; q <= 10; ++q)
+        {
+            for (int r = -10; r <= 10; ++r)
+                set.insert(vector{q_coordinate{q}, r_coordinate{r}});
+        }
+        CHECK(set.size() == 21 * 21);
+        CHECK(set.contains(vector{-10_q, 10_r}));
+        CHECK_FALSE(set.contains(vector{11_q, 0_r}));
+
+        CHECK(std::hash<vector<double>>{}(vector{1._q, 2._r}) == std::hash<vector<double>>{}(vector{1._q, 2._r}));
+    }
+
     SECTION("format")
     {
         STATIC_CHECK(std::formattable<vector<int>, char>);
@@ -0,0 +1,146 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/vector/coordinate_axis.hpp"
+#include "hex/vector/rotation_steps.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/vector/vector_batch.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+
+namespace
+{
+// A batch whose size is not a multiple of any register width, so that every operation also runs its scalar tail.
+template<typename T>
+auto make_batch() -> vector_batch<T>
+{
+    vector_batch<T> batch;
+    for (int i = 0; i < 37; ++i) // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    {
+        auto const q = static_cast<T>(((i * 7) % 23) - 11); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        auto const r = static_cast<T>(((i * 5) % 19) - 9);  // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        batch.push_back(vector{q_coordinate<T>(q), r_coordinate<T>(r)});
+    }
+    return batch;
+}
+
+template<typename T, typename Fn>
+auto map(vector_batch<T> const& batch, Fn fn) -> vector_batch<T>
+{
+    vector_batch<T> result;
+    for (std::size_t i = 0; i < batch.size(); ++i)
+        result.push_back(fn(batch[i]));
+    return result;
+}
+
+constexpr auto constant_evaluation() -> bool
+{
+    auto batch = vector_batch<int>{vector{q_coordinate(1), r_coordinate(2)}, vector{q_coordinate(-3), r_coordinate(1)}};
+    batch      = rotate(batch * 2 + vector{q_coordinate(1), r_coordinate(0)}, rot_60_cw);
+    std::array<int, 2> norms{};
+    batch.norm(norms);
+    return batch[0] == rotate(vector{q_coordinate(3), r_coordinate(4)}, rot_60_cw) && norms[1] == 5;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("vector_batch", "", std::int32_t, std::int64_t, float)
+{
+    using T          = TestType;
+    auto const batch = make_batch<T>();
+    auto const other = rotate(make_batch<T>(), rot_120_cw);
+    auto const point = vector{q_coordinate<T>(3), r_coordinate<T>(-5)};
+
+    SECTION("stores the vectors in aligned arrays")
+    {
+        REQUIRE(batch.size() == 37);
+        CHECK(reinterpret_cast<std::uintptr_t>(batch.q_data()) % vector_batch<T>::alignment == 0);
+        CHECK(reinterpret_cast<std::uintptr_t>(batch.r_data()) % vector_batch<T>::alignment == 0);
+        CHECK(batch[3] == vector{q_coordinate<T>(T{10}), r_coordinate<T>(T{6})});
+
+        auto copy = batch;
+        copy.set(3, point);
+        CHECK(copy[3] == point);
+        CHECK(copy != batch);
+        copy.resize(40);
+        CHECK(copy[39] == vector<T>{});
+        CHECK(vector_batch<T>(2) == vector_batch<T>{vector<T>{}, vector<T>{}});
+    }
+
+    SECTION("matches the operations on single vectors")
+    {
+        CHECK(batch + point == map(batch, [&](auto v) { return v + point; }));
+        CHECK(point + batch == map(batch, [&](auto v) { return point + v; }));
+        CHECK(batch - point == map(batch, [&](auto v) { return v - point; }));
+        CHECK(batch * T{3} == map(batch, [](auto v) { return v * T{3}; }));
+        CHECK(T{-2} * batch == map(batch, [](auto v) { return T{-2} * v; }));
+
+        vector_batch<T> expected;
+        for (std::size_t i = 0; i < batch.size(); ++i)
+            expected.push_back(batch[i] + other[i]);
+        CHECK(batch + other == expected);
+        CHECK(batch + other - other == batch);
+
+        std::vector<T> out(batch.size());
+        batch.norm(out);
+        for (std::size_t i = 0; i < batch.size(); ++i)
+            CHECK(out[i] == batch[i].norm());
+        distance(batch, point, out);
+        for (std::size_t i = 0; i < batch.size(); ++i)
+            CHECK(out[i] == distance(batch[i], point));
+
+        for (std::int8_t steps = -6; steps <= 6; ++steps)
+        {
+            auto const rotation = rotation_steps(steps);
+            CHECK(rotate(batch, rotation) == map(batch, [&](auto v) { return rotate(v, rotation); }));
+        }
+        for (auto const axis : {coordinate_axis::q, coordinate_axis::r, coordinate_axis::s})
+            CHECK(reflect(batch, axis) == map(batch, [&](auto v) { return reflect(v, axis); }));
+    }
+
+    SECTION("rejects mismatched sizes")
+    {
+        // Sized off the batch rather than by a constant, so that the optimizer cannot see the allocation size and
+        // flag the vectorized loop that the throw skips (-Warray-bounds).
+        auto const     shorter = vector_batch<T>(batch.size() - 1);
+        std::vector<T> out(batch.size() - 1);
+        auto           copy = batch;
+        CHECK_THROWS_AS(copy += shorter, std::invalid_argument);
+        CHECK_THROWS_AS(copy -= shorter, std::invalid_argument);
+        CHECK_THROWS_AS(batch.norm(out), std::invalid_argument);
+        CHECK_THROWS_AS(distance(batch, point, out), std::invalid_argument);
+    }
+}
+
+TEST_CASE("vector_batch in constant evaluation")
+{
+    STATIC_CHECK(constant_evaluation());
+}
@@ -22,6 +22,8 @@
 // SOFTWARE.
 //
 #include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
 #include "hex/views/convex_polygon/detail/detail_convex_polygon_iterator.hpp"
 
 #include <catch2/catch_all.hpp>
@@ -29,6 +31,8 @@
 #include <iterator>
 #include <vector>
 
+#include <cstddef>
+
 using namespace hex;
 using namespace hex::detail;
 
@@ -36,6 +40,8 @@ TEST_CASE("convex_polygon_iterator", "[detail]")
 {
     using namespace hex::literals;
 
+    convex_polygon_view<int> const pentagon(convex_polygon_parameters{-2_q, -1_r, -1_s, 1_q, 2_r, 1_s});
+
     SECTION("concept checks")
     {
         STATIC_CHECK(std::weakly_incrementable<convex_polygon_iterator<int>>);
@@ -51,9 +57,10 @@ TEST_CASE("convex_polygon_iterator", "[detail]")
     {
         STATIC_CHECK(convex_polygon_iterator<int>() == convex_polygon_iterator<int>());
     }
+
     SECTION("++iter")
     {
-        convex_polygon_iterator<int> iter({-2_q, -1_r, -1_s, 1_q, 2_r, 1_s}, vector{-2_q, 1_r});
+        convex_polygon_iterator<int> iter(pentagon, vector{-2_q, 1_r});
         ++iter;
         CHECK(*iter == vector{-2_q, 2_r});
         ++iter;
@@ -61,13 +68,13 @@ TEST_CASE("convex_polygon_iterator", "[detail]")
     }
     SECTION("iter++")
     {
-        convex_polygon_iterator<int> iter({-2_q, -1_r, -1_s, 1_q, 2_r, 1_s}, vector{-2_q, 1_r});
+        convex_polygon_iterator<int> iter(pentagon, vector{-2_q, 1_r});
         CHECK(*(iter++) == vector{-2_q, 1_r});
         CHECK(*iter == vector{-2_q, 2_r});
     }
     SECTION("--iter")
     {
-        convex_polygon_iterator<int> iter({-2_q, -1_r, -1_s, 1_q, 2_r, 1_s}, vector{-1_q, 1_r});
+        convex_polygon_iterator<int> iter(pentagon, vector{-1_q, 1_r});
         --iter;
         CHECK(*iter == vector{-1_q, 0_r});
         --iter;
@@ -75,11 +82,59 @@ TEST_CASE("convex_polygon_iterator", "[detail]")
     }
     SECTION("iter--")
     {
-        convex_polygon_iterator<int> iter({-2_q, -1_r, -1_s, 1_q, 2_r, 1_s}, vector{-1_q, 1_r});
+        convex_polygon_iterator<int> iter(pentagon, vector{-1_q, 1_r});
         CHECK(*(iter--) == vector{-1_q, 1_r});
         CHECK(*iter == vector{-1_q, 0_r});
     }
 
+    SECTION("random access")
+    {
+        auto const begin = pentagon.begin();
+        auto       end   = pentagon.end();
+        CHECK(end - begin == 10);
+        CHECK(begin + 10 == end);
+        CHECK(end - 10 == begin);
+        CHECK(++(begin + 9) == end);
+        CHECK(*(begin + 3) == vector{-1_q, 1_r});
+        CHECK(begin[3] == vector{-1_q, 1_r});
+        CHECK(*(end - 8) == vector{-1_q, 0_r});
+        CHECK((begin + 7) - (begin + 2) == 5);
+        CHECK((begin + 2) - (begin + 7) == -5);
+        CHECK(begin + 2 < begin + 3);
+        CHECK(begin + 3 < begin + 7);
+        CHECK(begin + 9 < end);
+        CHECK(--end == begin + 9);
+    }
+
+    SECTION("random access matches the view's indices")
+    {
+        auto const shape = GENERATE(convex_polygon_parameters{-2_q, -1_r, -1_s, 1_q, 2_r, 1_s},
+                                    convex_polygon_parameters{-1_q, -2_r, -1_s, 1_q, 0_r, 1_s},
+                                    convex_polygon_parameters{-1_q, -1_r, 0_s, 1_q, 1_r, 2_s},
+                                    convex_polygon_parameters{-3_q, -1_r, -2_s, 0_q, 2_r, 2_s},
+                                    make_regular_hexagon_parameters(3, vector{1_q, -2_r}));
+        convex_polygon_view<int> const view(shape);
+        auto const                     begin = view.begin();
+        auto const                     size  = static_cast<std::ptrdiff_t>(view.size());
+        for (std::ptrdiff_t i = 0; i <= size; ++i)
+        {
+            auto const iter = begin + i;
+            CHECK(iter - begin == i);
+            CHECK(view.end() - iter == size - i);
+            if (i < size)
+                CHECK(*iter == view[static_cast<std::size_t>(i)]);
+            else
+                CHECK(iter == view.end());
+            CHECK(iter - i == begin);
+        }
+    }
+
+    SECTION("size")
+    {
+        STATIC_CHECK(sizeof(convex_polygon_iterator<int>) == 4 * sizeof(int) + sizeof(vector<int>));
+        STATIC_CHECK(sizeof(convex_polygon_iterator<int, 8>) == sizeof(void*) + sizeof(vector<int>));
+    }
+
     SECTION("default constructed iterator compares equal to itself")
     {
         STATIC_CHECK(convex_polygon_iterator<int>() == convex_polygon_iterator<int>());
@@ -89,8 +144,9 @@ TEST_CASE("convex_polygon_iterator", "[detail]")
     {
         SECTION("-q triangle")
         {
-            auto const begin = convex_polygon_iterator<int>({-1_q, -2_r, -1_s, 1_q, 0_r, 1_s}, vector{-1_q, 0_r});
-            auto const end   = ++convex_polygon_iterator<int>({-1_q, -2_r, -1_s, 1_q, 0_r, 1_s}, vector{1_q, 0_r});
+            convex_polygon_view<int> const shape(convex_polygon_parameters{-1_q, -2_r, -1_s, 1_q, 0_r, 1_s});
+            auto const begin = convex_polygon_iterator<int>(shape, vector{-1_q, 0_r});
+            auto const end   = ++convex_polygon_iterator<int>(shape, vector{1_q, 0_r});
 
             CHECK(std::ranges::distance(begin, end) == 6);
 
@@ -105,8 +161,9 @@ TEST_CASE("convex_polygon_iterator", "[detail]")
         }
         SECTION("+q triangle")
         {
-            auto const begin = convex_polygon_iterator<int>({-1_q, -1_r, 0_s, 1_q, 1_r, 2_s}, vector{-1_q, -1_r});
-            auto const end   = ++convex_polygon_iterator<int>({-1_q, -1_r, 0_s, 1_q, 1_r, 2_s}, vector{1_q, -1_r});
+            convex_polygon_view<int> const shape(convex_polygon_parameters{-1_q, -1_r, 0_s, 1_q, 1_r, 2_s});
+            auto const begin = convex_polygon_iterator<int>(shape, vector{-1_q, -1_r});
+            auto const end   = ++convex_polygon_iterator<int>(shape, vector{1_q, -1_r});
 
             CHECK(std::ranges::distance(begin, end) == 6);
 
@@ -121,8 +178,9 @@ TEST_CASE("convex_polygon_iterator", "[detail]")
         }
         SECTION("quadrangle")
         {
-            auto const begin = convex_polygon_iterator<int>({-1_q, -1_r, -1_s, 1_q, 0_r, 1_s}, vector{-1_q, 0_r});
-            auto const end   = ++convex_polygon_iterator<int>({-1_q, -1_r, -1_s, 1_q, 0_r, 1_s}, vector{1_q, 0_r});
+            convex_polygon_view<int> const shape(convex_polygon_parameters{-1_q, -1_r, -1_s, 1_q, 0_r, 1_s});
+            auto const begin = convex_polygon_iterator<int>(shape, vector{-1_q, 0_r});
+            auto const end   = ++convex_polygon_iterator<int>(shape, vector{1_q, 0_r});
 
             CHECK(std::ranges::distance(begin, end) == 5);
 
@@ -0,0 +1,90 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/convex_polygon/detail/detail_row_start_table.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+
+#include <cstddef>
+
+using namespace hex;
+using namespace hex::detail;
+
+namespace
+{
+// Checks that the table agrees with the closed-form conversions for every tile of the polygon.
+template<std::size_t MaxRows>
+constexpr auto agrees_with_closed_form(convex_polygon_parameters<int> const& params) -> bool
+{
+    row_start_table<int, MaxRows> const table(params);
+    if (!table.tabulated())
+        return false;
+
+    convex_polygon_view<int> const view(params);
+    for (std::size_t i = 0; i < view.size(); ++i)
+    {
+        if (table.position_of(i, params) != view[i] || table.index_of(view[i], params) != i)
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("row_start_table", "[detail]")
+{
+    using namespace literals;
+
+    SECTION("single element")
+    {
+        STATIC_CHECK(agrees_with_closed_form<1>({0_q, 0_r, 0_s, 0_q, 0_r, 0_s}));
+    }
+    SECTION("triangle")
+    {
+        STATIC_CHECK(agrees_with_closed_form<4>({-1_q, -1_r, -1_s, 2_q, 2_r, 2_s}));
+        STATIC_CHECK(agrees_with_closed_form<4>({-2_q, -2_r, -2_s, 1_q, 1_r, 1_s}));
+    }
+    SECTION("parallelogram")
+    {
+        STATIC_CHECK(agrees_with_closed_form<2>({-1_q, -1_r, 0_s, 0_q, 1_r, 1_s}));
+        STATIC_CHECK(agrees_with_closed_form<3>({-1_q, -2_r, 0_s, 1_q, 1_r, 1_s}));
+    }
+    SECTION("pentagon")
+    {
+        STATIC_CHECK(agrees_with_closed_form<3>({-1_q, -2_r, -1_s, 1_q, 1_r, 1_s}));
+    }
+    SECTION("hexagon")
+    {
+        STATIC_CHECK(agrees_with_closed_form<5>(make_regular_hexagon_parameters(2)));
+        STATIC_CHECK(agrees_with_closed_form<64>(make_regular_hexagon_parameters(7, vector{3_q, -5_r})));
+    }
+    SECTION("too many rows")
+    {
+        STATIC_CHECK(!row_start_table<int, 4>(make_regular_hexagon_parameters(2)).tabulated());
+        STATIC_CHECK(!row_start_table<int, 0>(make_regular_hexagon_parameters(0)).tabulated());
+    }
+}
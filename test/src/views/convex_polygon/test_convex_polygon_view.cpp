@@ -24,12 +24,17 @@
 #include "hex/vector/vector.hpp"
 #include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
 #include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/rows/rows_view.hpp"
 
 #include <catch2/catch_all.hpp>
 
 #include <algorithm>
+#include <concepts>
 #include <iterator>
 #include <ranges>
+#include <utility>
+
+#include <cstddef>
 
 using namespace hex;
 
@@ -66,6 +71,23 @@ TEST_CASE("convex_polygon_view")
                      == vector{-2_q, 1_r});
     }
 
+    SECTION("iterators of a temporary view")
+    {
+        auto const iter = std::ranges::find(views::convex_polygon(params), vector{0_q, 1_r});
+        STATIC_CHECK(std::same_as<decltype(iter), convex_polygon_view<int>::iterator const>);
+        CHECK(*iter == vector{0_q, 1_r});
+        CHECK(*(iter - 7) == vector{-2_q, 1_r});
+    }
+
+    SECTION("iterators while the view is alive")
+    {
+        constexpr auto view = views::convex_polygon(params);
+        STATIC_CHECK(*view.begin() == vector{-2_q, 1_r});
+        STATIC_CHECK(*view.find(vector{0_q, 1_r}) == vector{0_q, 1_r});
+        STATIC_CHECK(view.find(vector{0_q, 1_r}) - view.begin() == 7);
+        STATIC_CHECK(view.find(vector{2_q, 0_r}) == view.end());
+    }
+
     SECTION("constant range")
     {
         STATIC_CHECK(std::ranges::constant_range<convex_polygon_view<int>>);
@@ -88,6 +110,65 @@ TEST_CASE("convex_polygon_view")
             == 7);
     }
 
+    SECTION("row start table")
+    {
+        STATIC_CHECK(std::ranges::random_access_range<convex_polygon_view<int, 8>>);
+        STATIC_CHECK(std::ranges::common_range<convex_polygon_view<int, 8>>);
+        STATIC_CHECK(!std::ranges::borrowed_range<convex_polygon_view<int, 8>>);
+
+        constexpr auto hexagon = make_regular_hexagon_parameters(3, vector{1_q, -2_r});
+        constexpr auto check   = [](convex_polygon_parameters<int> const& p)
+        {
+            convex_polygon_view<int> const    closed_form(p);
+            convex_polygon_view<int, 8> const tabulated(p);
+            if (!std::ranges::equal(closed_form, tabulated) || tabulated.size() != closed_form.size())
+                return false;
+            auto const begin = tabulated.begin();
+            for (std::size_t i = 0; i < tabulated.size(); ++i)
+            {
+                auto const n = static_cast<std::ptrdiff_t>(i);
+                if (tabulated[i] != closed_form[i] || tabulated[closed_form[i]] != i || begin[n] != closed_form[i]
+                    || tabulated.find(closed_form[i]) - begin != n
+                    || *(tabulated.end() - (n + 1)) != *(closed_form.end() - (n + 1)))
+                    return false;
+            }
+            return true;
+        };
+        STATIC_CHECK(check(params));
+        STATIC_CHECK(check(hexagon));
+        STATIC_CHECK(check(make_regular_hexagon_parameters(5))); // 11 rows, falls back to the closed form
+    }
+
+    SECTION("rows")
+    {
+        STATIC_CHECK(std::ranges::random_access_range<decltype(std::declval<convex_polygon_view<int>>().rows())>);
+
+        constexpr auto rows_match = [](convex_polygon_parameters<int> const& p)
+        {
+            auto const  view   = views::convex_polygon(p);
+            std::size_t offset = 0;
+            for (auto const& row : view.rows())
+            {
+                if (row.offset != offset || row.step != vector{0_q, 1_r})
+                    return false;
+                for (std::size_t i = 0; i < row.size; ++i)
+                {
+                    if (view[row.offset + i] != row[i])
+                        return false;
+                }
+                offset += row.size;
+            }
+            return offset == view.size();
+        };
+        STATIC_CHECK(views::convex_polygon(params).rows().size() == 4);
+        STATIC_CHECK(views::convex_polygon(params).rows()[1]
+                     == row_span<int>{vector{-1_q, 0_r}, vector{0_q, 1_r}, 2, 3});
+        STATIC_CHECK(rows_match(params));
+        STATIC_CHECK(rows_match(make_regular_hexagon_parameters(4, vector{1_q, 2_r})));
+        STATIC_CHECK(rows_match(make_regular_triangle_parameters(-3_q, 1_r, 0_s)));
+        STATIC_CHECK(rows_match({-1_q, -2_r, -1_s, 1_q, 1_r, 1_s}));
+    }
+
     SECTION("default constructed iterator compares equal to itself")
     {
         STATIC_CHECK(std::ranges::const_iterator_t<convex_polygon_view<int>>()
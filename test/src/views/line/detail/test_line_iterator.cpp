@@ -25,9 +25,15 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <algorithm>
 #include <array>
 #include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
 
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 
 using namespace hex;
@@ -41,6 +47,115 @@ TEST_CASE("line_iterator", "[detail]")
     {
         STATIC_CHECK(std::input_iterator<line_iterator<int>>);
         STATIC_CHECK(std::forward_iterator<line_iterator<int>>);
+        STATIC_CHECK(std::random_access_iterator<line_iterator<int>>);
+        STATIC_CHECK(std::forward_iterator<sextant_line_iterator<int, 0>>);
+    }
+
+    SECTION("sextants")
+    {
+        STATIC_CHECK(line_sextant(4, 2) == 0);
+        STATIC_CHECK(line_sextant(4, -1) == 1);
+        STATIC_CHECK(line_sextant(3, -5) == 2);
+        STATIC_CHECK(line_sextant(-1, -5) == 3);
+        STATIC_CHECK(line_sextant(-5, 2) == 4);
+        STATIC_CHECK(line_sextant(-3, 4) == 5);
+        STATIC_CHECK(line_sextant(0, 0) == 2);
+    }
+
+    SECTION("terminates after the last position in every sextant")
+    {
+        auto const to = GENERATE(vector{8_q, -4_r},
+                                 vector{4_q, 4_r},
+                                 vector{-4_q, 8_r},
+                                 vector{-8_q, 4_r},
+                                 vector{-4_q, -4_r},
+                                 vector{4_q, -8_r},
+                                 vector{0_q, 0_r});
+        auto const from = vector{2_q, -1_r};
+        auto const last = from + to;
+
+        auto const  end   = line_iterator<int>(from, last, distance(from, last) + 1);
+        std::size_t count = 0;
+        auto        iter  = line_iterator<int>(from, last);
+        for (; iter != end && count <= 16; ++iter)
+            ++count;
+        CHECK(count == static_cast<std::size_t>(distance(from, last)) + 1);
+
+        std::vector<vector<int>> positions;
+        for_each_line_position(from, last, [&](vector<int> const& v) { positions.push_back(v); });
+        REQUIRE(positions.size() == count);
+        CHECK(positions.front() == from);
+        CHECK(positions.back() == last);
+        CHECK(std::ranges::equal(positions, std::ranges::subrange(line_iterator<int>(from, last), end)));
+    }
+
+    SECTION("random access matches stepping")
+    {
+        auto const from = GENERATE(vector{0_q, 0_r}, vector{-3_q, 5_r});
+        for (int dq = -9; dq <= 9; ++dq)
+        {
+            for (int dr = -9; dr <= 9; ++dr)
+            {
+                auto const to     = from + vector{q_coordinate{dq}, r_coordinate{dr}};
+                auto const length = distance(from, to) + 1;
+                auto const begin  = line_iterator<int>(from, to);
+
+                auto iter = begin;
+                for (std::ptrdiff_t k = 0; k <= length; ++k, ++iter)
+                {
+                    REQUIRE((begin + k) == iter);
+                    CHECK(*(begin + k) == *iter);
+                    CHECK(begin[k] == *iter);
+                    CHECK(iter - begin == k);
+                    CHECK(*(iter - k) == *begin);
+                    CHECK(*line_iterator<int>(from, to, k) == *iter);
+                }
+                for (std::ptrdiff_t k = length; k >= 0; --k)
+                {
+                    --iter;
+                    CHECK(*iter == begin[k]);
+                }
+                CHECK(iter == begin);
+                CHECK(*(begin + (length - 1)) == to);
+            }
+        }
+    }
+
+    SECTION("sextant_line_iterator matches line_iterator")
+    {
+        sextant_line_iterator<int, 4> iter({0_q, 0_r}, {-5_q, 2_r});
+        line_iterator<int>            expected({0_q, 0_r}, {-5_q, 2_r});
+        for (; expected != line_iterator<int>({0_q, 0_r}, {-5_q, 2_r}, 6); ++expected, ++iter)
+            CHECK(*iter == *expected);
+        CHECK(iter == sextant_line_iterator<int, 4>());
+    }
+
+    SECTION("narrow coordinate types")
+    {
+        using narrow    = vector<std::int8_t>;
+        auto const make = [](int q, int r)
+        { return narrow{q_coordinate{static_cast<std::int8_t>(q)}, r_coordinate{static_cast<std::int8_t>(r)}}; };
+        auto const [from, to] = GENERATE_COPY(std::pair{make(-63, 0), make(63, 0)},
+                                              std::pair{make(0, 63), make(0, -63)},
+                                              std::pair{make(-63, 63), make(63, -63)},
+                                              std::pair{make(66, -50), make(-60, -3)});
+        auto const wide_from  = coordinate_cast<int>(from);
+        auto const wide_to    = coordinate_cast<int>(to);
+        auto const length     = distance(wide_from, wide_to) + 1;
+        REQUIRE(length == 127);
+
+        auto const begin      = line_iterator<std::int8_t>(from, to);
+        auto const wide_begin = line_iterator<int>(wide_from, wide_to);
+        auto       iter       = begin;
+        for (std::ptrdiff_t k = 0; k < length; ++k, ++iter)
+        {
+            CHECK(coordinate_cast<int>(*iter) == wide_begin[k]);
+            CHECK(coordinate_cast<int>(begin[k]) == wide_begin[k]);
+        }
+
+        std::vector<vector<int>> positions;
+        for_each_line_position(from, to, [&](narrow const& v) { positions.push_back(coordinate_cast<int>(v)); });
+        CHECK(std::ranges::equal(positions, std::ranges::subrange(wide_begin, wide_begin + length)));
     }
 
     SECTION("generates the expected positions")
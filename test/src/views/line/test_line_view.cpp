@@ -29,6 +29,7 @@
 #include <array>
 #include <iterator>
 #include <ranges>
+#include <utility>
 
 #include <cstddef>
 
@@ -42,7 +43,7 @@ TEST_CASE("line_view")
     {
         STATIC_CHECK(std::ranges::sized_range<line_view<int>>);
         STATIC_CHECK(std::ranges::common_range<line_view<int>>);
-        STATIC_CHECK(std::ranges::forward_range<line_view<int>>);
+        STATIC_CHECK(std::ranges::random_access_range<line_view<int>>);
         STATIC_CHECK(std::ranges::borrowed_range<line_view<int>>);
         STATIC_CHECK(std::ranges::constant_range<line_view<int>>);
     }
@@ -56,6 +57,22 @@ TEST_CASE("line_view")
         CHECK(std::ranges::distance(views::line(from, to)) == distance(from, to) + 1);
     }
 
+    SECTION("random access")
+    {
+        auto const line = views::line(vector{-2_q, 1_r}, vector{15_q, -41_r});
+        std::ptrdiff_t k = 0;
+        for (auto const& v : line)
+        {
+            CHECK(line[static_cast<std::size_t>(k)] == v);
+            CHECK(*std::ranges::next(line.begin(), k) == v);
+            ++k;
+        }
+        CHECK(std::cmp_equal(k, line.size()));
+        CHECK(std::ranges::distance(line.begin(), line.end()) == k);
+        CHECK(line.back() == vector{15_q, -41_r});
+        CHECK(*std::ranges::prev(line.end()) == vector{15_q, -41_r});
+    }
+
     SECTION("content")
     {
         SECTION("category 1")
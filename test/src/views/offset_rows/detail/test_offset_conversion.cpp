@@ -67,4 +67,18 @@ TEST_CASE("offset_conversion", "[detail]")
     STATIC_CHECK(to_even_s(from_even_s(0, 1)) == std::array{0, 1});
     STATIC_CHECK(to_even_s(from_even_s(1, 2)) == std::array{1, 2});
     STATIC_CHECK(to_even_s(from_even_s(42, 99)) == std::array{42, 99});
+
+    STATIC_CHECK(from_offset<coordinate_axis::q, offset_parity::odd>(3, 7) == from_odd_q(3, 7));
+    STATIC_CHECK(from_offset<coordinate_axis::q, offset_parity::even>(3, 7) == from_even_q(3, 7));
+    STATIC_CHECK(from_offset<coordinate_axis::r, offset_parity::odd>(3, 7) == from_odd_r(3, 7));
+    STATIC_CHECK(from_offset<coordinate_axis::r, offset_parity::even>(3, 7) == from_even_r(3, 7));
+    STATIC_CHECK(from_offset<coordinate_axis::s, offset_parity::odd>(3, 7) == from_odd_s(3, 7));
+    STATIC_CHECK(from_offset<coordinate_axis::s, offset_parity::even>(3, 7) == from_even_s(3, 7));
+
+    STATIC_CHECK(to_offset<coordinate_axis::q, offset_parity::odd>(from_odd_q(3, 7)) == std::array{3, 7});
+    STATIC_CHECK(to_offset<coordinate_axis::q, offset_parity::even>(from_even_q(3, 7)) == std::array{3, 7});
+    STATIC_CHECK(to_offset<coordinate_axis::r, offset_parity::odd>(from_odd_r(3, 7)) == std::array{3, 7});
+    STATIC_CHECK(to_offset<coordinate_axis::r, offset_parity::even>(from_even_r(3, 7)) == std::array{3, 7});
+    STATIC_CHECK(to_offset<coordinate_axis::s, offset_parity::odd>(from_odd_s(3, 7)) == std::array{3, 7});
+    STATIC_CHECK(to_offset<coordinate_axis::s, offset_parity::even>(from_even_s(3, 7)) == std::array{3, 7});
 }
\ No newline at end of file
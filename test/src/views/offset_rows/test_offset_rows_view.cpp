@@ -21,12 +21,19 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 //
+#include "hex/vector/vector.hpp"
+#include "hex/views/neighbors/neighbors_view.hpp"
 #include "hex/views/offset_rows/offset_rows_view.hpp"
 
 #include <catch2/catch_all.hpp>
 
 #include <algorithm>
+#include <concepts>
 #include <ranges>
+#include <stdexcept>
+#include <utility>
+
+#include <cstddef>
 
 using namespace hex;
 
@@ -43,6 +50,101 @@ TEST_CASE("offset_rows_view")
         STATIC_CHECK(std::ranges::borrowed_range<offset_rows_view<int>>);
     }
 
+    SECTION("class template argument deduction")
+    {
+        offset_rows_parameters<int> const params{3, 5, coordinate_axis::q, offset_parity::even};
+        offset_rows_view const            view(params);
+        STATIC_CHECK(std::same_as<decltype(view), offset_rows_view<int> const>);
+        CHECK(view.size() == 15);
+    }
+
+    SECTION("rows")
+    {
+        constexpr auto rows_match = [](offset_rows_view<int> const& view)
+        {
+            std::size_t offset = 0;
+            for (auto const& row : view.rows())
+            {
+                if (row.offset != offset || row.size != view.parameters().height())
+                    return false;
+                for (std::size_t i = 0; i < row.size; ++i)
+                {
+                    if (view.begin()[static_cast<std::ptrdiff_t>(row.offset + i)] != row[i])
+                        return false;
+                }
+                offset += row.size;
+            }
+            return offset == view.size();
+        };
+
+        STATIC_CHECK(std::ranges::random_access_range<decltype(std::declval<offset_rows_view<int>>().rows())>);
+        constexpr auto view = views::offset_rows({3, 5, coordinate_axis::q, offset_parity::odd, {-1_q, -2_r}});
+        STATIC_CHECK(view.rows().size() == 3);
+        for (auto const axis : {coordinate_axis::q, coordinate_axis::r, coordinate_axis::s})
+        {
+            for (auto const parity : {offset_parity::odd, offset_parity::even})
+            {
+                CHECK(rows_match(views::offset_rows({3, 5, axis, parity, {-1_q, -2_r}})));
+                CHECK(rows_match(views::offset_rows({4, 1, axis, parity, {2_q, 1_r}})));
+            }
+        }
+    }
+
+    SECTION("static axis and parity")
+    {
+        STATIC_CHECK(std::ranges::random_access_range<offset_rows_view<int, coordinate_axis::r, offset_parity::odd>>);
+        STATIC_CHECK(std::ranges::sized_range<offset_rows_view<int, coordinate_axis::r, offset_parity::odd>>);
+        STATIC_CHECK(std::ranges::constant_range<offset_rows_view<int, coordinate_axis::r, offset_parity::odd>>);
+        STATIC_CHECK(std::ranges::common_range<offset_rows_view<int, coordinate_axis::r, offset_parity::odd>>);
+        STATIC_CHECK(std::ranges::borrowed_range<offset_rows_view<int, coordinate_axis::r, offset_parity::odd>>);
+
+        constexpr auto matches_runtime_view = []<coordinate_axis Axis, offset_parity Parity>(std::size_t width,
+                                                                                             std::size_t height)
+        {
+            auto const corner  = vector{-1_q, -2_r};
+            auto const view    = views::offset_rows<Axis, Parity>(width, height, corner);
+            auto const runtime = views::offset_rows({width, height, Axis, Parity, corner});
+            if (!std::ranges::equal(view, runtime) || !std::ranges::equal(view | std::views::reverse,
+                                                                          runtime | std::views::reverse))
+                return false;
+            if (offset_rows_view<int>(view) != runtime || view.size() != runtime.size())
+                return false;
+            for (std::size_t i = 0; i < runtime.size(); ++i)
+            {
+                auto const v = runtime.begin()[static_cast<std::ptrdiff_t>(i)];
+                if (view.begin()[static_cast<std::ptrdiff_t>(i)] != v || view[v] != i
+                    || std::cmp_not_equal(view.find(v) - view.begin(), i))
+                    return false;
+                for (auto const n : views::neighbors(v))
+                {
+                    if (view.contains(n) != runtime.contains(n))
+                        return false;
+                }
+            }
+            return std::ranges::equal(view.rows(), runtime.rows());
+        };
+
+        auto const check_all = [&]<coordinate_axis Axis>()
+        {
+            CHECK(matches_runtime_view.template operator()<Axis, offset_parity::odd>(3, 5));
+            CHECK(matches_runtime_view.template operator()<Axis, offset_parity::even>(3, 5));
+            CHECK(matches_runtime_view.template operator()<Axis, offset_parity::odd>(4, 1));
+            CHECK(matches_runtime_view.template operator()<Axis, offset_parity::even>(1, 4));
+        };
+        check_all.template operator()<coordinate_axis::q>();
+        check_all.template operator()<coordinate_axis::r>();
+        check_all.template operator()<coordinate_axis::s>();
+
+        constexpr auto view = views::offset_rows<coordinate_axis::q, offset_parity::odd>(3, 5, vector{-1_q, -2_r});
+        STATIC_CHECK(view.size() == 15);
+        STATIC_CHECK(*(view.begin() + 10) == vector{1_q, -3_r});
+        STATIC_CHECK(std::ranges::empty(views::offset_rows<coordinate_axis::q, offset_parity::odd>(0, 5)));
+        STATIC_CHECK(std::ranges::empty(views::offset_rows<coordinate_axis::q, offset_parity::odd>(3, 0)));
+        CHECK_THROWS_AS((offset_rows_view<int, coordinate_axis::q, offset_parity::odd>(
+                            offset_rows_parameters<int>{3, 5, coordinate_axis::q, offset_parity::even})),
+                        std::invalid_argument);
+    }
+
     SECTION("q axis")
     {
         SECTION("odd")
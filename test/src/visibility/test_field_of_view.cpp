@@ -0,0 +1,157 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/visibility/field_of_view.hpp"
+#include "hex/visibility/field_of_view_mode.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <ranges>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+using namespace hex::literals;
+
+namespace
+{
+using opacity_grid = grid<std::uint8_t, convex_polygon_view<int>>;
+
+auto make_opacity(std::size_t every) -> opacity_grid
+{
+    opacity_grid opacity(views::convex_polygon(make_regular_hexagon_parameters(8)));
+    std::size_t  i = 0;
+    for (auto& opaque : opacity | std::views::values)
+        opaque = every != 0 && (i++ * 7919) % every == 0 ? 1 : 0; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    return opacity;
+}
+
+auto visible_positions(opacity_grid const& opacity, vector<int> const& origin, std::ptrdiff_t radius,
+                       field_of_view_mode mode) -> std::vector<vector<int>>
+{
+    std::vector<vector<int>> visible;
+    field_of_view(opacity, origin, radius, [&](vector<int> const& v) { visible.push_back(v); }, mode);
+    return visible;
+}
+
+} // namespace
+
+TEST_CASE("field_of_view")
+{
+    auto const mode = GENERATE(field_of_view_mode::symmetric, field_of_view_mode::permissive);
+
+    SECTION("radius")
+    {
+        auto const opacity = make_opacity(0);
+        CHECK(visible_positions(opacity, vector<int>{}, -1, mode).empty());
+        CHECK(visible_positions(opacity, vector<int>{}, 0, mode) == std::vector{vector<int>{}});
+        CHECK(visible_positions(opacity, vector{9_q, 0_r}, 3, mode).empty());
+
+        auto const radius = GENERATE(1, 2, 5, 8);
+        auto       actual = visible_positions(opacity, vector<int>{}, radius, mode);
+        auto       hexagon = views::convex_polygon(make_regular_hexagon_parameters(radius));
+        auto       expected = std::vector<vector<int>>(hexagon.begin(), hexagon.end());
+        std::ranges::sort(actual);
+        std::ranges::sort(expected);
+        CHECK(actual == expected);
+    }
+
+    SECTION("positions outside of the grid are opaque")
+    {
+        auto actual = visible_positions(make_opacity(0), vector{6_q, 0_r}, 4, mode);
+        CHECK(std::ranges::all_of(actual, [](auto const& v) { return distance(v, vector<int>{}) <= 8; }));
+        CHECK(std::ranges::count(actual, vector{8_q, 0_r}) == 1);
+    }
+
+    SECTION("shadows")
+    {
+        auto opacity                = make_opacity(0);
+        opacity[vector{2_q, 0_r}]   = 1;
+        opacity[vector{0_q, -3_r}]  = 1;
+        opacity[vector{-3_q, 3_r}]  = 1;
+        auto const actual           = visible_positions(opacity, vector<int>{}, 8, mode);
+        auto const visible          = [&](vector<int> const& v) { return std::ranges::count(actual, v) == 1; };
+        CHECK(visible(vector{2_q, 0_r}));
+        CHECK_FALSE(visible(vector{3_q, 0_r}));
+        CHECK_FALSE(visible(vector{8_q, 0_r}));
+        CHECK(visible(vector{3_q, -1_r}));
+        CHECK(visible(vector{0_q, -3_r}));
+        CHECK_FALSE(visible(vector{0_q, -4_r}));
+        CHECK_FALSE(visible(vector{-6_q, 6_r}));
+        CHECK(visible(vector{-7_q, 6_r}) == (mode == field_of_view_mode::permissive));
+    }
+
+    SECTION("every position is visited at most once")
+    {
+        auto const opacity = make_opacity(GENERATE(5, 11));
+        auto const origin  = GENERATE(vector{0_q, 0_r}, vector{-3_q, 5_r}, vector{6_q, -1_r});
+        auto       actual  = visible_positions(opacity, origin, 8, mode);
+        std::ranges::sort(actual);
+        CHECK(std::ranges::adjacent_find(actual) == actual.end());
+        CHECK(std::ranges::all_of(actual, [&](auto const& v) { return distance(v, origin) <= 8; }));
+    }
+
+    SECTION("grid output")
+    {
+        auto const   opacity = make_opacity(7);
+        opacity_grid visible(opacity.shape());
+        std::ranges::fill(visible | std::views::values, 1);
+        field_of_view(opacity, vector{1_q, 1_r}, 5, visible, mode);
+        auto const expected = visible_positions(opacity, vector{1_q, 1_r}, 5, mode);
+        for (auto const& [position, value] : visible)
+            CHECK((value != 0) == (std::ranges::count(expected, position) == 1));
+    }
+}
+
+TEST_CASE("field_of_view symmetric")
+{
+    auto const opacity = make_opacity(GENERATE(4, 7, 11));
+    auto const shape   = opacity.shape();
+    auto const size    = shape.size();
+
+    std::vector<bool> sees(size * size);
+    for (auto const& from : shape)
+    {
+        field_of_view(opacity, from, 16, [&](vector<int> const& to) { sees[(shape[from] * size) + shape[to]] = true; });
+    }
+    for (auto const& from : shape)
+    {
+        for (auto const& to : shape)
+        {
+            bool const forward  = sees[(shape[from] * size) + shape[to]];
+            bool const backward = sees[(shape[to] * size) + shape[from]];
+            if (opacity[from] == 0 && opacity[to] == 0 && forward != backward)
+            {
+                FAIL_CHECK("asymmetric between (" << from.q().value() << ", " << from.r().value() << ") and ("
+                                                  << to.q().value() << ", " << to.r().value() << ")");
+            }
+        }
+    }
+}
@@ -0,0 +1,133 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "hex/grid/grid.hpp"
+#include "hex/grid/neighbor_table.hpp"
+#include "hex/vector/vector.hpp"
+#include "hex/views/convex_polygon/convex_polygon_parameters.hpp"
+#include "hex/views/convex_polygon/convex_polygon_view.hpp"
+#include "hex/views/line/line_view.hpp"
+#include "hex/visibility/line_of_sight.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <array>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hex;
+using namespace hex::literals;
+
+namespace
+{
+using blocker_grid = grid<std::uint8_t, convex_polygon_view<int>>;
+
+// Reference implementation walking views::line.
+auto line_of_sight_reference(blocker_grid const& blockers, vector<int> const& from, vector<int> const& to) -> bool
+{
+    auto const line = views::line(from, to);
+    if (line.size() <= 2)
+        return true;
+    return std::ranges::none_of(line | std::views::drop(1) | std::views::take(line.size() - 2),
+                                [&](auto const& v) { return !blockers.contains(v) || blockers[v] != 0; });
+}
+
+auto make_blockers() -> blocker_grid
+{
+    blocker_grid blockers(views::convex_polygon(make_regular_hexagon_parameters(7)));
+    std::size_t  i = 0;
+    for (auto& blocked : blockers | std::views::values)
+        blocked = (i++ * 7919) % 11 == 0 ? 1 : 0; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    blockers[vector<int>{}] = 0;
+    return blockers;
+}
+} // namespace
+
+TEST_CASE("line_of_sight")
+{
+    auto const blockers = make_blockers();
+    auto const table    = neighbor_table<>(blockers.shape());
+
+    SECTION("end points are not checked")
+    {
+        auto walls              = blockers;
+        walls[vector{0_q, 0_r}] = 1;
+        walls[vector{1_q, 0_r}] = 1;
+        walls[vector{2_q, 0_r}] = 0;
+        CHECK(line_of_sight(walls, vector{0_q, 0_r}, vector{1_q, 0_r}));
+        CHECK(line_of_sight(walls, vector{0_q, 0_r}, vector{0_q, 0_r}));
+        CHECK_FALSE(line_of_sight(walls, vector{0_q, 0_r}, vector{2_q, 0_r}));
+        CHECK_FALSE(line_of_sight(walls, table, vector{0_q, 0_r}, vector{2_q, 0_r}));
+    }
+
+    SECTION("positions outside of the grid block")
+    {
+        blocker_grid const     open(views::convex_polygon(make_regular_hexagon_parameters(2)));
+        neighbor_table<> const open_table(open.shape());
+        CHECK(line_of_sight(open, vector{-2_q, 0_r}, vector{2_q, 0_r}));
+        CHECK(line_of_sight(open, vector{-2_q, 0_r}, vector{4_q, 0_r}) == false);
+        CHECK(line_of_sight(open, open_table, vector{-2_q, 0_r}, vector{4_q, 0_r}) == false);
+        CHECK(line_of_sight(open, vector{-2_q, 0_r}, vector{3_q, 0_r}));
+    }
+
+    SECTION("matches walking the line")
+    {
+        auto const from = GENERATE(vector{0_q, 0_r}, vector{-3_q, 5_r}, vector{6_q, -1_r});
+        for (auto const& to : views::convex_polygon(make_regular_hexagon_parameters(9)))
+        {
+            auto const expected = line_of_sight_reference(blockers, from, to);
+            CHECK(line_of_sight(blockers, from, to) == expected);
+            if (blockers.contains(from))
+                CHECK(line_of_sight(blockers, table, from, to) == expected);
+        }
+    }
+
+    SECTION("many")
+    {
+        auto const from    = GENERATE(vector{0_q, 0_r}, vector{2_q, -4_r});
+        auto const hexagon = views::convex_polygon(make_regular_hexagon_parameters(7));
+        auto       targets = std::vector<vector<int>>(hexagon.begin(), hexagon.end());
+        targets.push_back(from + vector{6_q, -3_r});
+        targets.push_back(from + vector{2_q, -1_r});
+        targets.push_back(from);
+
+        std::array<bool, 256> storage{}; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        REQUIRE(targets.size() <= storage.size());
+        auto const visible  = std::span(storage).first(targets.size());
+        auto const expected = [&](std::size_t i) { return line_of_sight(blockers, from, targets[i]); };
+
+        line_of_sight_many(blockers, from, targets, visible);
+        for (std::size_t i = 0; i < targets.size(); ++i)
+            CHECK(visible[i] == expected(i));
+
+        std::ranges::fill(visible, false);
+        line_of_sight_many(blockers, table, from, targets, visible);
+        for (std::size_t i = 0; i < targets.size(); ++i)
+            CHECK(visible[i] == expected(i));
+    }
+}